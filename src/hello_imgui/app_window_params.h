@@ -188,6 +188,16 @@ struct AppWindowParams
     // Full screen windows cannot be hidden.
     bool hidden = false;
 
+    // `fastStartup`: _bool, default = false_. Show the window sooner at startup.
+    // By default, the window is shown on the 4th frame: the first frames handle the DPI
+    // and measure the widgets (for auto-sized windows). With fastStartup:
+    //   - the DPI factor is applied before the window creation, if it is already known
+    //     (from dpiAwareParams, hello_imgui.ini, or the monitor where the window will be created)
+    //   - the first frame is a layout-only pass (it is not rendered), which measures
+    //     the widgets size for auto-sized windows
+    //   - the window is shown on the second frame
+    bool fastStartup = false;
+
 
     // --------------- Borderless window params ------------------
 
@@ -243,6 +253,23 @@ struct AppWindowParams
     // Do read https://github.com/pthom/hello_imgui/issues/112 for info about the possible gotchas
     // (This API is not stable, as the name suggests, and this is not supported)
     bool repaintDuringResize_GotchaReentrantRepaint = false;
+
+    // ----------------- coalesce the resize events -----------------
+    // `resizeCoalescing`: _bool, default = false_.
+    // If true, the resize events do not trigger a full frame each: while the user drags the window border,
+    // the previous frame is presented again (stretched to the new window size) at most at resizeRedrawMaxFps,
+    // and the GUI is laid out again once the window size is stable during resizeStableDelaySeconds.
+    // The resize events are queued and the GUI code is never reentered, so that this is safe
+    // with all backends (repaintDuringResize_GotchaReentrantRepaint is ignored when this is set).
+    // Note: on platforms where the event loop is blocked during the resize (e.g. Windows),
+    // the relayout happens when the user releases the mouse.
+    bool resizeCoalescing = false;
+    // `resizeRedrawMaxFps`: _float, default = 0_. Max rate of the redraws during resize
+    // (0: use the refresh rate of the monitor)
+    float resizeRedrawMaxFps = 0.f;
+    // `resizeStableDelaySeconds`: _float, default = 0.1_. The GUI is laid out again once the window size
+    // did not change during this delay
+    float resizeStableDelaySeconds = 0.1f;
 };
 // @@md
 
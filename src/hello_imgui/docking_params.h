@@ -7,6 +7,7 @@
 #include <utility>
 #include <optional>
 #include <stdio.h>
+#include <cstddef>
 
 namespace HelloImGui
 {
@@ -203,6 +204,15 @@ struct DockingSplit
 
 
 
+// DockableWindowBudgetAction: what happens when a dockable window keeps exceeding its time budget
+// (see DockableWindow.guiTimeBudgetMs)
+enum class DockableWindowBudgetAction
+{
+    Log,          // Log a warning
+    SkipFrames    // Log a warning, and call GuiFunction less often (the last content is replayed in between)
+};
+
+
 // @@md#DockableWindow
 
 // DockableWindow is a struct that represents a window that can be docked.
@@ -278,6 +288,39 @@ struct DockableWindow
     ImGuiCond  windowPositionCondition = ImGuiCond_FirstUseEver;
 
 
+    // --------------- Visibility & refresh rate ----------------
+    //            (only if callBeginEnd is true)
+
+    // `skipGuiWhenOccluded`: _bool, default=false_.
+    //  If true, GuiFunction is not called when the window is outside of its viewport,
+    //  or fully covered by another window (ImGui::Begin already skips collapsed windows and inactive tabs).
+    //  Occlusion is computed from the windows positions at the previous frame.
+    bool skipGuiWhenOccluded = false;
+
+    // `refreshRate`: _float, default=0 (i.e. refresh at each frame)_.
+    //  If > 0, GuiFunction is called at most refreshRate times per second, and the window content
+    //  drawn by the last call is replayed in between (e.g. use 5 for a status panel).
+    //  The window is refreshed at each frame while it is hovered, focused or used, when it is resized or
+    //  scrolled, and when it contains child windows (whose content cannot be replayed).
+    float refreshRate = 0.f;
+
+
+    // --------------- Time budget ------------------------------
+
+    // `guiTimeBudgetMs`: _float, default=0 (i.e. no budget)_.
+    //  Soft budget for the time spent in GuiFunction per frame (in milliseconds).
+    //  A warning is logged when the window exceeds it during 30 consecutive calls.
+    //  The cost of each window is displayed in the "View/Windows cost" window
+    //  (see ImGuiWindowParams.measureGuiCost).
+    float guiTimeBudgetMs = 0.f;
+
+    // `guiTimeBudgetAction`: _DockableWindowBudgetAction, default=Log_.
+    //  With SkipFrames, a window over budget is refreshed only once every N frames (N <= 8, so that
+    //  its average cost per frame fits the budget), while still being refreshed when it is used.
+    //  Only effective if callBeginEnd is true and the window content can be replayed (see refreshRate).
+    DockableWindowBudgetAction guiTimeBudgetAction = DockableWindowBudgetAction::Log;
+
+
     // --------------- Constructor ------------------------------
     // Constructor
     DockableWindow(
@@ -295,6 +338,45 @@ struct DockableWindow
 // @@md
 
 
+// @@md#DockableWindowStats
+
+// DockableWindowVisibility: visibility of a dockable window, as computed by HelloImGui
+enum class DockableWindowVisibility
+{
+    Hidden,        // isVisible is false
+    Collapsed,     // collapsed, or not drawn by ImGui::Begin for another reason
+    InactiveTab,   // docked in a dock node where another tab is selected
+    OffScreen,     // outside of its viewport
+    Occluded,      // fully covered by another window
+    Visible
+};
+
+// DockableWindowStats: visibility and cost of the GuiFunction of a dockable window
+// (see DockableWindowsStats() and GuiCostStats() in hello_imgui.h)
+struct DockableWindowStats
+{
+    std::string label;
+    DockableWindowVisibility visibility = DockableWindowVisibility::Hidden;
+
+    double guiTimeLast = 0.;       // Time spent in GuiFunction during its last call (seconds)
+    double guiTimeAverage = 0.;    // Smoothed time spent in GuiFunction per call (seconds)
+    double guiTimeTotal = 0.;      // Total time spent in GuiFunction (seconds)
+
+    std::size_t nbGuiCalls = 0;        // Number of frames where GuiFunction was called
+    std::size_t nbSkippedFrames = 0;   // Number of frames where GuiFunction was not called because the window was not visible
+    std::size_t nbReplayedFrames = 0;  // Number of frames where the content was replayed (see DockableWindow.refreshRate)
+
+    int nbVerticesLast = 0;       // Vertices drawn by the last call (including child windows)
+    int nbAllocationsLast = 0;    // ImGui allocations during the last call (0 if IMGUI_DISABLE_DEBUG_TOOLS is defined)
+
+    float guiTimeBudgetMs = 0.f;          // See DockableWindow.guiTimeBudgetMs
+    bool isOverBudget = false;            // True while the window is considered over budget
+    std::size_t nbCallsOverBudget = 0;    // Number of calls that exceeded the budget
+};
+
+// @@md
+
+
 enum class DockingLayoutCondition
 {
     FirstUseEver,
@@ -357,6 +439,7 @@ struct DockingParams
 
     // `DockableWindow * dockableWindowOfName(const std::string & name)`:
     // returns a pointer to a dockable window
+    // (O(1) via a hashed index of the labels, which is rebuilt when dockableWindows was modified)
     DockableWindow * dockableWindowOfName(const std::string& name);
 
     // `bool focusDockableWindow(const std::string& name)`:
@@ -7,15 +7,18 @@
 
 #include "hello_imgui/dpi_aware.h"
 #include "hello_imgui/hello_imgui_assets.h"
+#include "hello_imgui/hello_imgui_async.h"
 #include "hello_imgui/hello_imgui_error.h"
 #include "hello_imgui/hello_imgui_logger.h"
 #include "hello_imgui/image_from_asset.h"
+#include "hello_imgui/pixel_conversion.h"
 #include "hello_imgui/imgui_theme.h"
 #include "hello_imgui/hello_imgui_theme.h"
 #include "hello_imgui/hello_imgui_font.h"
 #include "hello_imgui/runner_params.h"
 #include "hello_imgui/hello_imgui_widgets.h"
 #include <string>
+#include <vector>
 
 #include <cstddef>
 #include <cstdint>
@@ -177,6 +180,18 @@ namespace ManualRender
 //  (Will only lead to accurate values if you call it at each frame)
 float FrameRate(float durationForMean = 0.5f);
 
+// `GetFramePacingStats()`: returns the measured input latency and frame pacing stats
+//  (see RendererBackendOptions.framePacing)
+FramePacingStats GetFramePacingStats();
+
+// `GetViewportsRenderStats()`: returns the render stats of the secondary viewports (i.e. the additional
+//  native windows, when ImGuiWindowParams.enableViewports is true)
+std::vector<ViewportRenderStats> GetViewportsRenderStats();
+
+// `GetImGuiAllocationStats()`: returns the allocations performed by ImGui, per frame and per phase of the frame
+//  (see RunnerParams.imGuiAllocatorParams)
+ImGuiAllocationStats GetImGuiAllocationStats();
+
 // `ImGuiTestEngine* GetImGuiTestEngine()`: returns a pointer to the global instance
 //  of ImGuiTestEngine that was initialized by HelloImGui
 //  (iif ImGui Test Engine is active).
@@ -227,6 +242,27 @@ void AddDockableWindow(const DockableWindow& dockableWindow, bool forceDockspace
 // (dockableWindowName is the label of the window, as provided in the DockableWindow struct)
 void RemoveDockableWindow(const std::string& dockableWindowName);
 
+// `AddDockableWindows()` / `RemoveDockableWindows()`: batched versions of the functions above.
+// All the additions and removals requested during a frame are applied in a single pass
+// before the next frame (use them when adding or removing many windows at once).
+void AddDockableWindows(const std::vector<DockableWindow>& dockableWindows, bool forceDockspace = false);
+void RemoveDockableWindows(const std::vector<std::string>& dockableWindowNames);
+
+// `CurrentDockableWindowVisibility()`: returns the visibility of the dockable window whose GuiFunction
+// is being called. For windows with callBeginEnd=false, this is the visibility at the previous frame
+// (use it to skip expensive work when the window is not visible).
+DockableWindowVisibility CurrentDockableWindowVisibility();
+
+// `DockableWindowsStats()`: returns the visibility and the time spent in GuiFunction
+// for each dockable window of the current layout
+// (the time, vertices and allocations are only measured if imGuiWindowParams.measureGuiCost is true)
+std::vector<DockableWindowStats> DockableWindowsStats();
+
+// `GuiCostStats()`: same as DockableWindowsStats(), plus the cost of the menus, status bar
+// and toolbars callbacks (whose labels are "[Menus]", "[Status bar]", "[Toolbar <edge>]").
+// Also displayed in the "View/Windows cost" window (see imGuiWindowParams.measureGuiCost).
+std::vector<DockableWindowStats> GuiCostStats();
+
 // @@md
 
 
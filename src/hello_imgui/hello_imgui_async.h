@@ -0,0 +1,181 @@
+#pragma once
+#include "imgui.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+
+namespace HelloImGui
+{
+namespace internal
+{
+    // Implemented with the JobSystem of the runner (see internal/job_system.h).
+    // When no application is running, the job and the function are run immediately on the calling thread.
+    void Async_PushJob(std::function<void()> job);
+    void Async_PostToMainThread(std::function<void()> fn);
+    // Runs a pending job on the calling thread (used while waiting for a result). Returns false if none was pending.
+    bool Async_RunPendingJob();
+    // Waits until isReady (guarded by mutex) is true, running the pending jobs meanwhile.
+    // On the main thread, the Python GIL is released while waiting (when using the python bindings).
+    void Async_Wait(std::mutex& mutex, std::condition_variable& condition, const bool& isReady);
+
+    template<typename T> struct AsyncContinuation { using type = std::function<void(T&)>; };
+    template<> struct AsyncContinuation<void> { using type = std::function<void()>; };
+
+    template<typename T>
+    struct AsyncState
+    {
+        using StoredValue = std::conditional_t<std::is_void_v<T>, bool, T>;
+        using Continuation = typename AsyncContinuation<T>::type;
+
+        std::mutex Mutex;
+        std::condition_variable Condition;
+        bool IsReady = false;
+        std::optional<StoredValue> Value;
+        std::exception_ptr Error;
+        Continuation Then;
+        bool IsContinuationPosted = false;
+
+        static void RunContinuation(const std::shared_ptr<AsyncState>& state)
+        {
+            if (state->Error)
+                return;
+            if constexpr (std::is_void_v<T>)
+                state->Then();
+            else
+                state->Then(*state->Value);
+        }
+
+        static void PostContinuation(const std::shared_ptr<AsyncState>& state)
+        {
+            Async_PostToMainThread([state]() { RunContinuation(state); });
+        }
+
+        // Called on the worker thread, once the value or the error was stored
+        static void Complete(const std::shared_ptr<AsyncState>& state)
+        {
+            bool shallPostContinuation;
+            {
+                std::lock_guard<std::mutex> lock(state->Mutex);
+                state->IsReady = true;
+                shallPostContinuation = state->Then && !state->IsContinuationPosted;
+                state->IsContinuationPosted = state->IsContinuationPosted || shallPostContinuation;
+            }
+            state->Condition.notify_all();
+            if (shallPostContinuation)
+                PostContinuation(state);
+        }
+    };
+}
+
+
+// @@md#Async
+
+//
+// Run a function on a worker thread, and use its result on the main thread.
+//
+// HelloImGui owns a pool of worker threads, started by the first call to Async(), and joined when the application exits
+// (see RunnerParams.nbAsyncWorkerThreads).
+// `HelloImGui::Async(fn)` runs `fn` on a worker thread, and returns an `AsyncResult<T>` (T is the return type of fn).
+// The continuation given to `AsyncResult::Then()` is called on the main thread, before ImGui::NewFrame(),
+// during the first frame after `fn` completed (the idling main loop is woken up).
+//
+// Example:
+//     HelloImGui::Async([]() { return LoadBigFile("data.bin"); })
+//         .Then([](std::vector<char>& data) { gData = std::move(data); });
+//
+// Notes:
+// - `fn` shall not call ImGui (it runs on another thread). It is copied into the job system.
+// - `fn` may itself call Async(): the nested jobs are run first by the same worker, and may be stolen by the others.
+// - if `fn` throws, the continuation is not called, and `Get()` rethrows the exception.
+// - when no application is running, `fn` and the continuation are called immediately, on the calling thread.
+// - the continuations still pending when the application exits are called after the last frame.
+
+template<typename T>
+class AsyncResult
+{
+public:
+    AsyncResult() = default;
+    explicit AsyncResult(std::shared_ptr<internal::AsyncState<T>> state) : mState(std::move(state)) {}
+
+    // `IsValid()`: false if this result was default constructed
+    bool IsValid() const { return mState != nullptr; }
+
+    // `IsReady()`: true once fn completed (or threw)
+    bool IsReady() const
+    {
+        IM_ASSERT(IsValid());
+        std::lock_guard<std::mutex> lock(mState->Mutex);
+        return mState->IsReady;
+    }
+
+    // `Get()`: waits until fn completed (running the other pending jobs meanwhile), and returns its result.
+    // Rethrows the exception thrown by fn.
+    // When called on the main thread, it blocks the GUI: prefer Then(). The Python GIL is released while waiting.
+    std::add_lvalue_reference_t<T> Get()
+    {
+        IM_ASSERT(IsValid());
+        internal::Async_Wait(mState->Mutex, mState->Condition, mState->IsReady);
+        if (mState->Error)
+            std::rethrow_exception(mState->Error);
+        if constexpr (!std::is_void_v<T>)
+            return *mState->Value;
+    }
+
+    // `Then(continuation)`: sets the function called on the main thread once fn completed,
+    // with the result of fn (or without parameter if fn returns void). Shall be called at most once.
+    AsyncResult& Then(typename internal::AsyncState<T>::Continuation continuation)
+    {
+        IM_ASSERT(IsValid());
+        bool shallPostContinuation;
+        {
+            std::lock_guard<std::mutex> lock(mState->Mutex);
+            mState->Then = std::move(continuation);
+            shallPostContinuation = mState->IsReady && !mState->IsContinuationPosted;
+            mState->IsContinuationPosted = mState->IsContinuationPosted || shallPostContinuation;
+        }
+        if (shallPostContinuation)
+            internal::AsyncState<T>::PostContinuation(mState);
+        return *this;
+    }
+
+private:
+    std::shared_ptr<internal::AsyncState<T>> mState;
+};
+
+
+// `Async(fn)`: runs fn on a worker thread
+template<typename Fn>
+AsyncResult<std::invoke_result_t<std::decay_t<Fn>&>> Async(Fn&& fn)
+{
+    using T = std::invoke_result_t<std::decay_t<Fn>&>;
+    auto state = std::make_shared<internal::AsyncState<T>>();
+    internal::Async_PushJob([state, fn = std::forward<Fn>(fn)]() mutable
+    {
+        try
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                fn();
+                state->Value.emplace(true);
+            }
+            else
+                state->Value.emplace(fn());
+        }
+        catch (...)
+        {
+            state->Error = std::current_exception();
+        }
+        internal::AsyncState<T>::Complete(state);
+    });
+    return AsyncResult<T>(state);
+}
+
+// @@md
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
 #include <cstdint>
+#include <string>
 #include <vector>
 
 
@@ -26,4 +27,59 @@ namespace HelloImGui
 
     ImageBuffer FinalAppWindowScreenshotRgbBuffer();
     float FinalAppWindowScreenshotFramebufferScale();
+
+
+/**
+@@md#HelloImGui::Recording
+
+HelloImGui can record the app window into a lossless image sequence or a raw video stream.
+Frames are captured through the renderer screenshot path into a pool of reused buffers,
+and are encoded and written on a background thread.
+If the writer cannot keep up, frames are dropped (and counted) instead of stalling the rendering.
+
+* `StartRecording(path, options)`: starts a recording.
+    - For image sequences (`PpmSequence`, `PngSequence`), `path` is a folder
+      (which will be created if needed), and frames are written as `frame_000000.ppm`, `frame_000001.ppm`, etc.
+    - For `Y4mStream`, `path` is the output file (a raw YUV 4:4:4 stream, readable by ffmpeg, vlc, etc.)
+  Returns false if the recording could not be started.
+* `StopRecording()`: stops the recording, after all pending frames were written.
+* `IsRecording()`: returns true if a recording is in progress.
+* `GetRecordingStats()`: returns the number of captured, written and dropped frames.
+
+Note: recording is only available with the OpenGL3 rendering backend.
+
+@@md
+*/
+    enum class RecordingFormat
+    {
+        PpmSequence,   // One binary PPM file per frame (fastest)
+        PngSequence,   // One PNG file per frame (smaller, but slower to encode)
+        Y4mStream      // A single raw YUV4MPEG2 file (C444)
+    };
+
+    struct RecordingOptions
+    {
+        RecordingFormat format = RecordingFormat::PpmSequence;
+        // Capture one frame every N rendered frames
+        int captureEveryNFrames = 1;
+        // Number of capture buffers shared between the render thread and the writer thread.
+        // When all of them are waiting to be written, new frames are dropped.
+        int bufferPoolSize = 4;
+        // Frame rate written in the Y4M header (only used with RecordingFormat::Y4mStream)
+        int y4mFrameRate = 30;
+    };
+
+    struct RecordingStats
+    {
+        bool isRecording = false;
+        std::size_t capturedFrames = 0;
+        std::size_t writtenFrames = 0;
+        std::size_t droppedFrames = 0;
+        std::string lastError;
+    };
+
+    bool StartRecording(const std::string& path, const RecordingOptions& options = RecordingOptions());
+    void StopRecording();
+    bool IsRecording();
+    RecordingStats GetRecordingStats();
 }
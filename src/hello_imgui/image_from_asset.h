@@ -131,6 +131,10 @@ struct ImageAndSize
 {
     ImTextureID textureId = ImTextureID(0);
     ImVec2 size = ImVec2(0.f, 0.f);
+    // The UV coordinates of the image inside the texture
+    // (they differ from (0,0)-(1,1) only when the image is packed into an atlas, see ImageAtlasParams)
+    ImVec2 uv0 = ImVec2(0.f, 0.f);
+    ImVec2 uv1 = ImVec2(1.f, 1.f);
 };
 // `HelloImGui::ImageAndSize HelloImGui::ImageAndSizeFromAsset(assetPath)`:
 // will return the texture ID and the size of an image loaded from the assets.
@@ -149,6 +153,52 @@ ImageAndSize ImageAndSizeFromMemory(const char *assetName, MemoryImage image);
 ImageAndSize ImageAndSizeFromMemory(const char *assetName); 
 
 
+// `ImageAtlasParams`: small images from the assets can be packed into shared textures ("atlas pages").
+// Toolbars and icon grids then use a single texture, instead of one texture (and one draw call) per icon.
+//   - ImageFromAsset and ImageButtonFromAsset handle this transparently
+//     (their uv0 / uv1 parameters are relative to the image, as usual).
+//   - ImageAndSizeFromAsset returns the texture of the page, and the UVs of the image inside it.
+//   - Warning: ImTextureIdFromAsset returns the texture of the whole page:
+//     use ImageAndSizeFromAsset instead, if you enable the atlas.
+// Set it via RunnerParams.imageAtlasParams.
+struct ImageAtlasParams
+{
+    // `enabled`: _bool, default=false_.
+    bool enabled = false;
+    // `maxImageSize`: _int, default=64_. Images whose width and height are <= maxImageSize are packed.
+    int maxImageSize = 64;
+    // `pageSize`: _int, default=1024_. Width and height of the atlas pages.
+    int pageSize = 1024;
+    // `maxPages`: _int, default=4_. When all the pages are full, the images which do not fit use their own texture,
+    // and at the start of the next frame, the images which were not displayed recently are evicted
+    // and the pages are repacked (the evicted images are reloaded when displayed again).
+    int maxPages = 4;
+    // `padding`: _int, default=1_. Border around each image, filled with its edge pixels,
+    // so that the linear filtering does not bleed the neighbour images.
+    int padding = 1;
+};
+
+
+// `ImageLoadingParams`: how the images from the assets are stored on the GPU.
+// Set it via RunnerParams.imageLoadingParams.
+//   - Pre-compressed textures (.ktx2 or .dds files, in BC1/BC3/BC7, ETC2 or ASTC 4x4 formats) use 4 to 8 times
+//     less memory than RGBA8: ImageFromAsset("maps/world.ktx2") loads them as is, and
+//     ImageFromAsset("maps/world.png") uses "maps/world.ktx2" or "maps/world.dds" if it exists in the assets.
+//     If the rendering backend does not support their format, the .png or .jpg version is used instead
+//     (the mip levels stored in the file are used; KTX2 supercompression is not supported).
+//   - Compressed textures and mipmaps are implemented with OpenGL only:
+//     the other rendering backends always use RGBA8, without mipmaps.
+struct ImageLoadingParams
+{
+    // `useCompressedTextures`: _bool, default=false_. Use the .ktx2 / .dds versions of the images, if available.
+    bool useCompressedTextures = false;
+    // `generateMipmaps`: _bool, default=false_. Generate the mipmaps of the images which are not pre-compressed,
+    // and use trilinear filtering: large images (backgrounds, maps) do not alias when displayed downscaled
+    // (this uses 33% more memory). Small images packed into an atlas (see ImageAtlasParams) do not use mipmaps.
+    bool generateMipmaps = false;
+};
+
+
 // `ImVec2 HelloImGui::ImageProportionalSize(askedSize, imageSize)`:
 //  will return the displayed size of an image.
 //     - if askedSize.x or askedSize.y is 0, then the corresponding dimension
@@ -164,5 +214,8 @@ ImVec2 ImageProportionalSize(const ImVec2& askedSize, const ImVec2& imageSize);
 namespace internal
 {
     void Free_ImageFromAssetMap();
+    // Updates the textures of the image atlas (see ImageAtlasParams): called at the start of each frame
+    void ImageAtlas_FlushUploads();
+    bool ImageAtlas_HasPendingUploads();
 }
 }
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+
+namespace HelloImGui
+{
+// @@md#ImGuiAllocatorParams
+
+// ImGuiAllocatorParams: instrumentation of the memory allocations performed by ImGui
+// (i.e. ImGui::MemAlloc / ImGui::MemFree, which are also used by ImPlot, ImGui Test Engine, etc.)
+// When enabled, HelloImGui installs its allocator functions (ImGui::SetAllocatorFunctions)
+// before creating the ImGui context: ImGui must not have allocated memory before HelloImGui::Run.
+// The allocations are counted per frame, and per phase of the frame (see GetImGuiAllocationStats()).
+struct ImGuiAllocatorParams
+{
+    // `enableTracking`: _bool, default=false_.
+    //  Count the allocations, frees and allocated bytes (the stats are also shown in the FPS tooltip
+    //  of the status bar).
+    bool enableTracking = false;
+
+    // `useSizeClassPool`: _bool, default=false_.
+    //  Serve the small allocations (<= 2 KB) from free lists of blocks of the same size class:
+    //  once the application reached its steady state, they do not reach the heap anymore.
+    //  The memory of the pool is kept until the application exits.
+    bool useSizeClassPool = false;
+
+    // `warnOnHeapAllocationsAfterFrame`: _int, default=-1_.
+    //  If >= 0, a warning is logged for each frame (after this frame index) which performed
+    //  heap allocations (at most 20 warnings).
+    //  Use it to check that the steady state frames of your application do not allocate.
+    int warnOnHeapAllocationsAfterFrame = -1;
+};
+
+
+// ImGuiAllocationCounters: number of allocations and frees, and allocated bytes
+struct ImGuiAllocationCounters
+{
+    size_t allocations = 0;
+    size_t frees = 0;
+    size_t bytesAllocated = 0;
+    // `heapAllocations`: allocations which reached the heap (i.e. not served by the size class pool)
+    size_t heapAllocations = 0;
+};
+
+
+// ImGuiAllocationStats: see GetImGuiAllocationStats() (requires ImGuiAllocatorParams.enableTracking)
+struct ImGuiAllocationStats
+{
+    bool isTracking = false;
+
+    // Last rendered frame, and its phases:
+    //   - BeforeNewFrame: idling, events polling, fonts and layout handling
+    //   - NewFrame: backends NewFrame, ImGui::NewFrame
+    //   - Gui: background, GUI functions (including the user callbacks)
+    //   - Render: ImGui::Render, rendering, swap, and callbacks after the swap
+    // (the allocations performed between two frames are accounted to the next frame)
+    ImGuiAllocationCounters lastFrame;
+    ImGuiAllocationCounters lastFrame_BeforeNewFrame;
+    ImGuiAllocationCounters lastFrame_NewFrame;
+    ImGuiAllocationCounters lastFrame_Gui;
+    ImGuiAllocationCounters lastFrame_Render;
+
+    // Since the tracking started
+    ImGuiAllocationCounters total;
+    size_t nbFrames = 0;
+
+    // High-water marks: maximum of lastFrame over all frames
+    size_t frameAllocations_HighWaterMark = 0;
+    size_t frameBytesAllocated_HighWaterMark = 0;
+
+    // Memory currently allocated by ImGui, and its maximum
+    size_t liveAllocations = 0;
+    size_t liveBytes = 0;
+    size_t liveBytes_HighWaterMark = 0;
+
+    // Number of consecutive frames (up to the last one) which did not allocate from the heap
+    size_t nbFramesWithoutHeapAllocation = 0;
+
+    // Memory reserved by the size class pool (see ImGuiAllocatorParams.useSizeClassPool)
+    size_t poolBytesReserved = 0;
+};
+// @@md
+}
@@ -80,6 +80,11 @@ namespace ImGuiTheme
 
     // PushTweakedTheme() / PopTweakedTheme()
     // Push and pop a tweaked theme
+    // (the style of each (theme, tweaks) is computed once and cached, and pushes can be nested without limit)
+    //
+    // Note: PopTweakedTheme() restores the colors, and only the style variables that were changed by the push.
+    //       Other modifications of the style made between the push and the pop (e.g. a rounding that
+    //       the pushed theme did not change) are kept after the pop. Previous versions restored the whole style.
     //
     // Note: If you want the theme to apply globally to a window, you need to apply it
     //       *before* calling ImGui::Begin
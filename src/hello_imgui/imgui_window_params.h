@@ -53,9 +53,32 @@ struct ImGuiWindowParams
     // in order to put their content into new native windows.
     bool enableViewports = false;
 
+    // `viewportsSkipUnchangedFrames`: _bool, default=false_.
+    // If true, a secondary viewport whose content did not change since it was last presented
+    // is neither rendered nor presented (its previous image stays on screen).
+    // This saves a lot when many windows were moved out of the main window.
+    // Note: the content is compared by its draw commands. If you update a texture in place (i.e. with the same
+    //       ImTextureID), and display it in a secondary viewport, its viewport will not be refreshed.
+    bool viewportsSkipUnchangedFrames = false;
+
+    // `viewportsNonBlockingSwap`: _bool, default=false_.
+    // If true, the secondary viewports are presented without waiting for the vertical blank:
+    // only the main window waits for it (otherwise, each viewport waits for its own vblank, one after the other,
+    // and the frame rate is divided by the number of viewports).
+    // Note: their swap interval is set to 0, so that they may show tearing.
+    // Used with OpenGL only (the DirectX backends of ImGui already present the secondary viewports this way).
+    bool viewportsNonBlockingSwap = false;
+
     // Make windows only movable from the title bar
     bool configWindowsMoveFromTitleBarOnly = true;
 
+    // `measureGuiCost`: _bool, default=false_.
+    // If true, the cost of the GuiFunction of each dockable window, and of the menus, status bar and toolbars
+    // callbacks, is measured at each frame (time, vertices, allocations: see GuiCostStats()),
+    // and a "Windows cost" window is available in the View menu.
+    // (the dockable windows with a guiTimeBudgetMs are always timed)
+    bool measureGuiCost = false;
+
 
     // ------------ Menus & Status bar --------------------------------------------------
 
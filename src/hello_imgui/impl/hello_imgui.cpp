@@ -2,6 +2,8 @@
 #include "hello_imgui/internal/backend_impls/runner_factory.h"
 #include "hello_imgui/internal/menu_statusbar.h"
 #include "hello_imgui/internal/docking_details.h"
+#include "hello_imgui/internal/imgui_allocator.h"
+#include "hello_imgui_test_engine_integration/test_engine_integration.h"
 #include "imgui_internal.h"
 #include <deque>
 #include <set>
@@ -226,6 +228,11 @@ namespace ManualRender
 
 void Run(RunnerParams& runnerParams)
 {
+#ifdef HELLOIMGUI_WITH_TEST_ENGINE
+    // Headless tests may be run in worker processes (see TestEngineParams.nbWorkerProcesses)
+    if (TestEngineCallbacks::RunInWorkerProcessesIfNeeded(runnerParams))
+        return;
+#endif
     Priv_SetupRunner(runnerParams, SetupMode::Run);
     gLastRunner->Run();
     Priv_TearDown();
@@ -432,6 +439,26 @@ void UseWindowFullMonitorWorkArea()
 }
 
 
+FramePacingStats GetFramePacingStats()
+{
+    if (gLastRunner == nullptr)
+        return {};
+    return gLastRunner->GetFramePacingStats();
+}
+
+std::vector<ViewportRenderStats> GetViewportsRenderStats()
+{
+    if (gLastRunner == nullptr)
+        return {};
+    return gLastRunner->GetViewportsRenderStats();
+}
+
+ImGuiAllocationStats GetImGuiAllocationStats()
+{
+    return ImGuiAllocator::GetStats();
+}
+
+
 bool ShouldRemoteDisplay()
 {
     return gLastRunner->ShouldRemoteDisplay();
@@ -0,0 +1,60 @@
+#include "hello_imgui/hello_imgui_async.h"
+#include "hello_imgui/internal/job_system.h"
+
+#ifdef IMGUI_TEST_ENGINE_WITH_PYTHON_GIL
+#include "imgui_test_engine/imgui_te_python_gil.h"
+#define SCOPED_RELEASE_GIL_ON_MAIN_THREAD ImGuiTestEnginePythonGIL::ReleaseGilOnMainThread_Scoped _gilRelease
+#else
+#define SCOPED_RELEASE_GIL_ON_MAIN_THREAD
+#endif
+
+#include <chrono>
+
+
+namespace HelloImGui
+{
+namespace internal
+{
+    void Async_PushJob(std::function<void()> job)
+    {
+        JobSystem* jobSystem = JobSystem::Current();
+        if (jobSystem != nullptr)
+            jobSystem->Push(std::move(job));
+        else
+            job();
+    }
+
+    void Async_PostToMainThread(std::function<void()> fn)
+    {
+        JobSystem* jobSystem = JobSystem::Current();
+        if (jobSystem != nullptr)
+            jobSystem->PostToMainThread(std::move(fn));
+        else
+            fn();
+    }
+
+    bool Async_RunPendingJob()
+    {
+        JobSystem* jobSystem = JobSystem::Current();
+        return (jobSystem != nullptr) && jobSystem->RunPendingJob();
+    }
+
+    void Async_Wait(std::mutex& mutex, std::condition_variable& condition, const bool& isReady)
+    {
+        // The workers may need the GIL to complete the job (e.g. a python function given to Async)
+        SCOPED_RELEASE_GIL_ON_MAIN_THREAD;
+        auto isReadyLocked = [&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return isReady;
+        };
+        while (!isReadyLocked())
+        {
+            if (!Async_RunPendingJob())
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait_for(lock, std::chrono::milliseconds(1), [&isReady]() { return isReady; });
+            }
+        }
+    }
+}
+}
@@ -1,6 +1,8 @@
 #include "hello_imgui/hello_imgui_screenshot.h"
 #include "hello_imgui/internal/backend_impls/abstract_runner.h"
 
+#include <cstdio>
+
 
 namespace HelloImGui
 {
@@ -34,4 +36,36 @@ namespace HelloImGui
         return gFinalAppWindowScreenshotFramebufferScale;
     }
 
+    bool StartRecording(const std::string& path, const RecordingOptions& options)
+    {
+        auto runner = GetAbstractRunner();
+        if (runner == nullptr)
+        {
+            fprintf(stderr, "HelloImGui::StartRecording() shall be called while an app is running\n");
+            return false;
+        }
+        return runner->GetFrameRecorder().Start(path, options);
+    }
+
+    void StopRecording()
+    {
+        auto runner = GetAbstractRunner();
+        if (runner != nullptr)
+            runner->GetFrameRecorder().Stop();
+    }
+
+    bool IsRecording()
+    {
+        auto runner = GetAbstractRunner();
+        return (runner != nullptr) && runner->GetFrameRecorder().IsRecording();
+    }
+
+    RecordingStats GetRecordingStats()
+    {
+        auto runner = GetAbstractRunner();
+        if (runner == nullptr)
+            return RecordingStats();
+        return runner->GetFrameRecorder().Stats();
+    }
+
 }
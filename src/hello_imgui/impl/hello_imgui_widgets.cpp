@@ -1,13 +1,12 @@
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include "hello_imgui/hello_imgui_widgets.h"
 #include "hello_imgui/dpi_aware.h"
+#include "hello_imgui/internal/widget_state_storage.h"
 #include "imgui.h"
 #include "imgui_stdlib.h"
 #include "imgui_internal.h"
 #include "nlohmann/json.hpp"
 
-#include <unordered_map>
-
 
 namespace HelloImGui
 {
@@ -31,14 +30,7 @@ namespace HelloImGui
         ImVec2 MousePosition = ImVec2();
     };
 
-    static std::unordered_map<ImGuiID, WidgetResizingState_> gWidgetResizingStates;
-
-    static WidgetResizingState_* GetWidgetResizingState_(ImGuiID widget_id)
-    {
-        if (gWidgetResizingStates.find(widget_id) == gWidgetResizingStates.end())
-            gWidgetResizingStates[widget_id] = WidgetResizingState_();
-        return &gWidgetResizingStates.at(widget_id);
-    }
+    static WidgetStateStorage<WidgetResizingState_> gWidgetResizingStates;
 
 
     ImVec2 WidgetWithResizeHandle(
@@ -69,7 +61,9 @@ namespace HelloImGui
         //
         // Get and update resizing state
         //
-        WidgetResizingState_* resizingState = GetWidgetResizingState_(widget_id);
+        // (onItemResized may add other widgets states to the storage, which would invalidate resizingState:
+        //  it is called after the state update)
+        WidgetResizingState_* resizingState = gWidgetResizingStates.Get(widget_id, ImGui::GetFrameCount());
         WidgetResizingState_ previousResizingState = *resizingState; // This is a copy
 
         resizingState->MousePosition = ImGui::GetIO().MousePos;
@@ -96,21 +90,20 @@ namespace HelloImGui
 
         ImGui::GetWindowDrawList()->AddTriangleFilled(br, bl, tr, color);
 
+        int nbOnItemResizedCalls = 0;
         if (mouseInZoneBeforeAfter)
 
         if (!resizingState->Resizing)
         {
             if (wasMouseJustClicked && mouseInZoneBeforeAfter)
             {
-                if (onItemResized.has_value() && onItemResized)
-                    onItemResized.value()();
+                ++nbOnItemResizedCalls;
                 resizingState->Resizing = true;
             }
         }
         if (resizingState->Resizing)
         {
-            if (onItemResized.has_value() && onItemResized)
-                onItemResized.value()();
+            ++nbOnItemResizedCalls;
             if (ImGui::IsMouseDown(0))
             {
                 if (mouseDelta.x != 0.0f || mouseDelta.y != 0.0f)
@@ -126,6 +119,9 @@ namespace HelloImGui
             }
         }
 
+        if (onItemResized.has_value() && onItemResized)
+            for (int i = 0; i < nbOnItemResizedCalls; ++i)
+                onItemResized.value()();
         return widget_size;
     }
 
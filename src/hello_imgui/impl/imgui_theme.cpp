@@ -5,8 +5,14 @@
 // Some themes were adapted by themes posted by ImGui users at https://github.com/ocornut/imgui/issues/707
 //
 #include "hello_imgui/imgui_theme.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string>
-#include <stack>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ImGuiTheme
 {
@@ -993,28 +999,150 @@ namespace ImGuiTheme
         return style;
     }
 
+    namespace TweakedThemeCache
+    {
+        // Styles computed by TweakedThemeThemeToStyle, keyed by (theme, tweaks)
+        static_assert(sizeof(ImGuiThemeTweaks) == 9 * sizeof(float),
+                      "A field was added to ImGuiThemeTweaks: add it to TweakedThemeCache::Key");
+        struct Key
+        {
+            ImGuiTheme_ Theme;
+            float Tweaks[9];
+
+            explicit Key(const ImGuiTweakedTheme& tweaked_theme)
+            {
+                const ImGuiThemeTweaks& t = tweaked_theme.Tweaks;
+                Theme = tweaked_theme.Theme;
+                float values[9] = {
+                    t.Rounding, t.RoundingScrollbarRatio, t.AlphaMultiplier, t.Hue, t.SaturationMultiplier,
+                    t.ValueMultiplierFront, t.ValueMultiplierBg, t.ValueMultiplierText, t.ValueMultiplierFrameBg };
+                memcpy(Tweaks, values, sizeof(Tweaks));
+            }
+            bool operator==(const Key& other) const
+            {
+                return Theme == other.Theme && memcmp(Tweaks, other.Tweaks, sizeof(Tweaks)) == 0;
+            }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const
+            {
+                // FNV-1a over the theme and the tweaks
+                uint64_t h = 14695981039346656037ull;
+                auto hashBytes = [&h](const void* data, size_t size) {
+                    const unsigned char* bytes = (const unsigned char*)data;
+                    for (size_t i = 0; i < size; ++i)
+                        h = (h ^ bytes[i]) * 1099511628211ull;
+                };
+                hashBytes(&key.Theme, sizeof(key.Theme));
+                hashBytes(key.Tweaks, sizeof(key.Tweaks));
+                return (size_t)h;
+            }
+        };
+
+        // The cache is dropped when it grows beyond this size (e.g. while the user plays with the tweak sliders)
+        constexpr size_t MaxCachedStyles = 64;
+        std::unordered_map<Key, ImGuiStyle, KeyHash> gCachedStyles;
+
+        const ImGuiStyle& GetStyle(const ImGuiTweakedTheme& tweaked_theme)
+        {
+            Key key(tweaked_theme);
+            auto it = gCachedStyles.find(key);
+            if (it != gCachedStyles.end())
+                return it->second;
+            if (gCachedStyles.size() >= MaxCachedStyles)
+                gCachedStyles.clear();
+            return gCachedStyles.emplace(key, TweakedThemeThemeToStyle(tweaked_theme)).first->second;
+        }
+    }
+
     void ApplyTweakedTheme(const ImGuiTweakedTheme& tweaked_theme)
     {
-        ImGui::GetStyle() = TweakedThemeThemeToStyle(tweaked_theme);
+        ImGui::GetStyle() = TweakedThemeCache::GetStyle(tweaked_theme);
     }
 
-    std::stack<ImGuiStyle> gPreviousStyles_PushTweakedTheme;
+    namespace PushedThemes
+    {
+        // PushTweakedTheme() does not save the whole style: it saves the color table,
+        // and the scalars (compared as 32 bits words) that differ from the pushed style.
+        // The words are read and written with memcpy (ImGuiStyle is trivially copyable). A word may include
+        // padding bytes: they are then saved and restored with the fields around them, which is harmless.
+        static_assert(std::is_trivially_copyable<ImGuiStyle>::value, "ImGuiStyle is compared and restored as raw memory");
+        static_assert(sizeof(ImGuiStyle) % sizeof(uint32_t) == 0, "ImGuiStyle is compared as 32 bits words");
+        constexpr size_t ColorsBegin = offsetof(ImGuiStyle, Colors) / sizeof(uint32_t);
+        constexpr size_t ColorsEnd = ColorsBegin + ImGuiCol_COUNT * sizeof(ImVec4) / sizeof(uint32_t);
+        constexpr size_t NbWords = sizeof(ImGuiStyle) / sizeof(uint32_t);
+
+        struct SavedStyle
+        {
+            ImVec4 Colors[ImGuiCol_COUNT];
+            std::vector<std::pair<uint32_t, uint32_t>> Words;   // (word index, previous value)
+        };
+
+        // Saved styles are kept when popped, so that nested pushes do not allocate once warmed up
+        std::vector<SavedStyle> gSavedStyles;
+        size_t gDepth = 0;
+
+        uint32_t ReadStyleWord(const ImGuiStyle& style, size_t index)
+        {
+            uint32_t word;
+            memcpy(&word, reinterpret_cast<const unsigned char*>(&style) + index * sizeof(uint32_t), sizeof(uint32_t));
+            return word;
+        }
+        void WriteStyleWord(ImGuiStyle& style, size_t index, uint32_t word)
+        {
+            memcpy(reinterpret_cast<unsigned char*>(&style) + index * sizeof(uint32_t), &word, sizeof(uint32_t));
+        }
+
+        void Push(const ImGuiStyle& new_style)
+        {
+            if (gDepth == gSavedStyles.size())
+                gSavedStyles.emplace_back();
+            SavedStyle& saved = gSavedStyles[gDepth++];
+
+            ImGuiStyle& style = ImGui::GetStyle();
+            memcpy(saved.Colors, style.Colors, sizeof(saved.Colors));
+            memcpy(style.Colors, new_style.Colors, sizeof(style.Colors));
+
+            saved.Words.clear();
+            for (size_t i = 0; i < NbWords; ++i)
+            {
+                if (i == ColorsBegin)
+                    i = ColorsEnd;
+                if (i >= NbWords)
+                    break;
+                uint32_t word = ReadStyleWord(style, i), newWord = ReadStyleWord(new_style, i);
+                if (word != newWord)
+                {
+                    saved.Words.push_back({(uint32_t)i, word});
+                    WriteStyleWord(style, i, newWord);
+                }
+            }
+        }
+
+        void Pop()
+        {
+            IM_ASSERT(gDepth > 0 && "PopTweakedTheme() called without a matching PushTweakedTheme()");
+            if (gDepth == 0)
+                return;
+            const SavedStyle& saved = gSavedStyles[--gDepth];
+
+            ImGuiStyle& style = ImGui::GetStyle();
+            memcpy(style.Colors, saved.Colors, sizeof(style.Colors));
+            for (const auto& word: saved.Words)
+                WriteStyleWord(style, word.first, word.second);
+        }
+    }
 
     void PushTweakedTheme(const ImGuiTweakedTheme& tweaked_theme)
     {
-        gPreviousStyles_PushTweakedTheme.push(ImGui::GetStyle());
-        ApplyTweakedTheme(tweaked_theme);
-
-        bool tooManyThemes = gPreviousStyles_PushTweakedTheme.size() > 10;
-        if (tooManyThemes)
-            IM_ASSERT(false && "Too many PushTweakedTheme() calls without matching PopTweakedTheme()");
+        PushedThemes::Push(TweakedThemeCache::GetStyle(tweaked_theme));
     }
 
     void PopTweakedTheme()
     {
-        IM_ASSERT(!gPreviousStyles_PushTweakedTheme.empty());
-        ImGui::GetStyle() = gPreviousStyles_PushTweakedTheme.top();
-        gPreviousStyles_PushTweakedTheme.pop();
+        PushedThemes::Pop();
     }
 
 
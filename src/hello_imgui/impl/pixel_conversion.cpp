@@ -0,0 +1,638 @@
+#include "hello_imgui/pixel_conversion.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)) && !defined(__EMSCRIPTEN__)
+    #define HELLOIMGUI_PIXEL_CONVERSION_X86
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    // NEON is always available on ARM64 (and vmaxnmq_f32 is ARM64 only)
+    #define HELLOIMGUI_PIXEL_CONVERSION_NEON
+    #include <arm_neon.h>
+#endif
+
+// With gcc and clang, the SSE2 and AVX2 kernels are compiled for their instruction set only,
+// so that the library does not need -mavx2 (they are called only if the CPU supports them)
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define HELLOIMGUI_TARGET_SSE2 __attribute__((target("sse2")))
+    #define HELLOIMGUI_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define HELLOIMGUI_TARGET_SSE2
+    #define HELLOIMGUI_TARGET_AVX2
+#endif
+
+
+namespace HelloImGui
+{
+namespace PixelConversion
+{
+    //
+    // Instruction set selection
+    //
+    static SimdLevel _DetectSimdLevel()
+    {
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+    #if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int nbIds = info[0];
+        __cpuid(info, 1);
+        bool hasSse2 = (info[3] & (1 << 26)) != 0;
+        bool hasOsXSave = (info[2] & (1 << 27)) != 0;
+        bool hasAvx = (info[2] & (1 << 28)) != 0;
+        bool hasAvx2 = false;
+        // AVX2 also requires the OS to save the YMM registers
+        if (nbIds >= 7 && hasOsXSave && hasAvx && (_xgetbv(0) & 6) == 6)
+        {
+            __cpuidex(info, 7, 0);
+            hasAvx2 = (info[1] & (1 << 5)) != 0;
+        }
+    #else
+        __builtin_cpu_init();
+        bool hasSse2 = __builtin_cpu_supports("sse2");
+        bool hasAvx2 = __builtin_cpu_supports("avx2");
+    #endif
+        if (hasAvx2)
+            return SimdLevel::AVX2;
+        if (hasSse2)
+            return SimdLevel::SSE2;
+        return SimdLevel::Scalar;
+#elif defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+        return SimdLevel::NEON;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    static SimdLevel _BestSimdLevel()
+    {
+        static SimdLevel bestLevel = _DetectSimdLevel();
+        return bestLevel;
+    }
+
+    static std::atomic<int> gForcedSimdLevel { -1 };  // -1: use the best level
+
+    SimdLevel GetSimdLevel()
+    {
+        int forcedLevel = gForcedSimdLevel.load(std::memory_order_relaxed);
+        return forcedLevel < 0 ? _BestSimdLevel() : (SimdLevel)forcedLevel;
+    }
+
+    void SetSimdLevel(SimdLevel level)
+    {
+        SimdLevel bestLevel = _BestSimdLevel();
+        bool isSupported =
+               (level == SimdLevel::Scalar)
+            || (level == bestLevel)
+            || (level == SimdLevel::SSE2 && bestLevel == SimdLevel::AVX2);
+        gForcedSimdLevel = (int)(isSupported ? level : bestLevel);
+    }
+
+    const char* SimdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+            case SimdLevel::Scalar: return "Scalar";
+            case SimdLevel::SSE2: return "SSE2";
+            case SimdLevel::AVX2: return "AVX2";
+            case SimdLevel::NEON: return "NEON";
+        }
+        return "";
+    }
+
+
+    //
+    // Scalar kernels (also used for the remaining pixels of the SIMD kernels)
+    //
+    static void _RgbToRgba_Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        for (size_t i = 0; i < nbPixels; ++i, src += 3, dst += 4)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 255;
+        }
+    }
+
+    static void _RgbaToRgb_Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        for (size_t i = 0; i < nbPixels; ++i, src += 4, dst += 3)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+        }
+    }
+
+    static void _SwapRedBlue_Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        for (size_t i = 0; i < nbPixels; ++i, src += 4, dst += 4)
+        {
+            uint8_t r = src[0], g = src[1], b = src[2], a = src[3];
+            dst[0] = b;
+            dst[1] = g;
+            dst[2] = r;
+            dst[3] = a;
+        }
+    }
+
+    static void _GrayToRgba_Scalar(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        for (size_t i = 0; i < nbPixels; ++i, dst += 4)
+        {
+            uint8_t g = src[i];
+            dst[0] = g;
+            dst[1] = g;
+            dst[2] = g;
+            dst[3] = 255;
+        }
+    }
+
+    // The windowing formula, shared by all the kernels (which give the exact same results):
+    // t = clamp((v - minValue) * scale, 0, 255) (NaN => 0), and gray = (int)(t + 0.5)
+    struct _Window
+    {
+        float MinValue, Scale;
+        explicit _Window(float minValue, float maxValue)
+            : MinValue(minValue), Scale(maxValue > minValue ? 255.f / (maxValue - minValue) : 0.f) {}
+    };
+
+    static inline void _WindowToRgba_Scalar(float v, const _Window& window, uint8_t* dst)
+    {
+        float t = (v - window.MinValue) * window.Scale;
+        if (!(t > 0.f))
+            t = 0.f;
+        if (t > 255.f)
+            t = 255.f;
+        uint8_t g = (uint8_t)(t + 0.5f);
+        dst[0] = g;
+        dst[1] = g;
+        dst[2] = g;
+        dst[3] = 255;
+    }
+
+    template<typename T>
+    static void _WindowToRgba_Scalar(const T* src, uint8_t* dst, size_t nbPixels, const _Window& window)
+    {
+        for (size_t i = 0; i < nbPixels; ++i, dst += 4)
+            _WindowToRgba_Scalar((float)src[i], window, dst);
+    }
+
+
+    //
+    // SSE2 and AVX2 kernels: they return the number of processed pixels
+    // (the SSE2 level has no byte shuffle instruction: RGB <-> RGBA use the scalar kernels)
+    //
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+    HELLOIMGUI_TARGET_SSE2
+    static size_t _SwapRedBlue_Sse2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        const __m128i maskGreenAlpha = _mm_set1_epi32((int)0xFF00FF00);
+        const __m128i maskLowByte = _mm_set1_epi32(0x000000FF);
+        size_t i = 0;
+        for (; i + 4 <= nbPixels; i += 4)
+        {
+            __m128i p = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+            __m128i greenAlpha = _mm_and_si128(p, maskGreenAlpha);
+            __m128i redToBlue = _mm_slli_epi32(_mm_and_si128(p, maskLowByte), 16);
+            __m128i blueToRed = _mm_and_si128(_mm_srli_epi32(p, 16), maskLowByte);
+            _mm_storeu_si128((__m128i*)(dst + 4 * i), _mm_or_si128(greenAlpha, _mm_or_si128(redToBlue, blueToRed)));
+        }
+        return i;
+    }
+
+    HELLOIMGUI_TARGET_SSE2
+    static size_t _GrayToRgba_Sse2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        const __m128i alpha = _mm_set1_epi8((char)0xFF);
+        size_t i = 0;
+        for (; i + 16 <= nbPixels; i += 16)
+        {
+            __m128i g = _mm_loadu_si128((const __m128i*)(src + i));
+            __m128i grayGrayLow = _mm_unpacklo_epi8(g, g);
+            __m128i grayGrayHigh = _mm_unpackhi_epi8(g, g);
+            __m128i grayAlphaLow = _mm_unpacklo_epi8(g, alpha);
+            __m128i grayAlphaHigh = _mm_unpackhi_epi8(g, alpha);
+            __m128i* out = (__m128i*)(dst + 4 * i);
+            _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(grayGrayLow, grayAlphaLow));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(grayGrayLow, grayAlphaLow));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(grayGrayHigh, grayAlphaHigh));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(grayGrayHigh, grayAlphaHigh));
+        }
+        return i;
+    }
+
+    // 4 values => 4 gray RGBA pixels
+    HELLOIMGUI_TARGET_SSE2
+    static inline __m128i _WindowToRgba_Sse2(__m128 v, __m128 minValue, __m128 scale)
+    {
+        __m128 t = _mm_mul_ps(_mm_sub_ps(v, minValue), scale);
+        t = _mm_max_ps(t, _mm_setzero_ps());  // also NaN => 0
+        t = _mm_min_ps(t, _mm_set1_ps(255.f));
+        __m128i g = _mm_cvttps_epi32(_mm_add_ps(t, _mm_set1_ps(0.5f)));
+        __m128i gg = _mm_or_si128(g, _mm_slli_epi32(g, 8));
+        return _mm_or_si128(_mm_or_si128(gg, _mm_slli_epi32(g, 16)), _mm_set1_epi32((int)0xFF000000));
+    }
+
+    HELLOIMGUI_TARGET_SSE2
+    static size_t _FloatToRgba_Sse2(const float* src, uint8_t* dst, size_t nbPixels, const _Window& window)
+    {
+        const __m128 minValue = _mm_set1_ps(window.MinValue), scale = _mm_set1_ps(window.Scale);
+        size_t i = 0;
+        for (; i + 4 <= nbPixels; i += 4)
+            _mm_storeu_si128((__m128i*)(dst + 4 * i), _WindowToRgba_Sse2(_mm_loadu_ps(src + i), minValue, scale));
+        return i;
+    }
+
+    HELLOIMGUI_TARGET_SSE2
+    static size_t _Uint16ToRgba_Sse2(const uint16_t* src, uint8_t* dst, size_t nbPixels, const _Window& window)
+    {
+        const __m128 minValue = _mm_set1_ps(window.MinValue), scale = _mm_set1_ps(window.Scale);
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 8 <= nbPixels; i += 8)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+            __m128 low = _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero));
+            __m128 high = _mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero));
+            __m128i* out = (__m128i*)(dst + 4 * i);
+            _mm_storeu_si128(out + 0, _WindowToRgba_Sse2(low, minValue, scale));
+            _mm_storeu_si128(out + 1, _WindowToRgba_Sse2(high, minValue, scale));
+        }
+        return i;
+    }
+
+    HELLOIMGUI_TARGET_AVX2
+    static size_t _RgbToRgba_Avx2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        // Each 128 bits lane holds 4 RGB pixels (12 bytes), and is expanded to 4 RGBA pixels
+        const __m256i shuffle = _mm256_setr_epi8(
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+            0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m256i alpha = _mm256_set1_epi32((int)0xFF000000);
+        size_t i = 0;
+        // The second lane reads 16 bytes at offset 12: stop 2 pixels early, in order not to read past the end
+        for (; i + 10 <= nbPixels; i += 8)
+        {
+            const uint8_t* s = src + 3 * i;
+            __m256i p = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)s)),
+                _mm_loadu_si128((const __m128i*)(s + 12)), 1);
+            p = _mm256_or_si256(_mm256_shuffle_epi8(p, shuffle), alpha);
+            _mm256_storeu_si256((__m256i*)(dst + 4 * i), p);
+        }
+        return i;
+    }
+
+    HELLOIMGUI_TARGET_AVX2
+    static size_t _RgbaToRgb_Avx2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        // Packs the 12 RGB bytes at the start of each lane, and then the 24 bytes at the start of the register
+        const __m256i shuffle = _mm256_setr_epi8(
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        const __m256i permute = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+        size_t i = 0;
+        for (; i + 8 <= nbPixels; i += 8)
+        {
+            __m256i p = _mm256_loadu_si256((const __m256i*)(src + 4 * i));
+            p = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(p, shuffle), permute);
+            uint8_t* d = dst + 3 * i;
+            _mm_storeu_si128((__m128i*)d, _mm256_castsi256_si128(p));
+            _mm_storel_epi64((__m128i*)(d + 16), _mm256_extracti128_si256(p, 1));
+        }
+        return i;
+    }
+
+    HELLOIMGUI_TARGET_AVX2
+    static size_t _SwapRedBlue_Avx2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(
+            2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+            2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+        size_t i = 0;
+        for (; i + 8 <= nbPixels; i += 8)
+        {
+            __m256i p = _mm256_loadu_si256((const __m256i*)(src + 4 * i));
+            _mm256_storeu_si256((__m256i*)(dst + 4 * i), _mm256_shuffle_epi8(p, shuffle));
+        }
+        return i;
+    }
+
+    HELLOIMGUI_TARGET_AVX2
+    static size_t _GrayToRgba_Avx2(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        // 8 gray bytes are broadcast to both lanes: the first lane expands bytes 0-3, the second bytes 4-7
+        const __m256i shuffle = _mm256_setr_epi8(
+            0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1,
+            4, 4, 4, -1, 5, 5, 5, -1, 6, 6, 6, -1, 7, 7, 7, -1);
+        const __m256i alpha = _mm256_set1_epi32((int)0xFF000000);
+        size_t i = 0;
+        for (; i + 8 <= nbPixels; i += 8)
+        {
+            __m256i g = _mm256_broadcastq_epi64(_mm_loadl_epi64((const __m128i*)(src + i)));
+            _mm256_storeu_si256((__m256i*)(dst + 4 * i), _mm256_or_si256(_mm256_shuffle_epi8(g, shuffle), alpha));
+        }
+        return i;
+    }
+
+    // 8 values => 8 gray RGBA pixels
+    HELLOIMGUI_TARGET_AVX2
+    static inline __m256i _WindowToRgba_Avx2(__m256 v, __m256 minValue, __m256 scale)
+    {
+        __m256 t = _mm256_mul_ps(_mm256_sub_ps(v, minValue), scale);
+        t = _mm256_max_ps(t, _mm256_setzero_ps());  // also NaN => 0
+        t = _mm256_min_ps(t, _mm256_set1_ps(255.f));
+        __m256i g = _mm256_cvttps_epi32(_mm256_add_ps(t, _mm256_set1_ps(0.5f)));
+        __m256i gg = _mm256_or_si256(g, _mm256_slli_epi32(g, 8));
+        return _mm256_or_si256(_mm256_or_si256(gg, _mm256_slli_epi32(g, 16)), _mm256_set1_epi32((int)0xFF000000));
+    }
+
+    HELLOIMGUI_TARGET_AVX2
+    static size_t _FloatToRgba_Avx2(const float* src, uint8_t* dst, size_t nbPixels, const _Window& window)
+    {
+        const __m256 minValue = _mm256_set1_ps(window.MinValue), scale = _mm256_set1_ps(window.Scale);
+        size_t i = 0;
+        for (; i + 8 <= nbPixels; i += 8)
+            _mm256_storeu_si256((__m256i*)(dst + 4 * i), _WindowToRgba_Avx2(_mm256_loadu_ps(src + i), minValue, scale));
+        return i;
+    }
+
+    HELLOIMGUI_TARGET_AVX2
+    static size_t _Uint16ToRgba_Avx2(const uint16_t* src, uint8_t* dst, size_t nbPixels, const _Window& window)
+    {
+        const __m256 minValue = _mm256_set1_ps(window.MinValue), scale = _mm256_set1_ps(window.Scale);
+        size_t i = 0;
+        for (; i + 8 <= nbPixels; i += 8)
+        {
+            __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(src + i))));
+            _mm256_storeu_si256((__m256i*)(dst + 4 * i), _WindowToRgba_Avx2(v, minValue, scale));
+        }
+        return i;
+    }
+#endif // HELLOIMGUI_PIXEL_CONVERSION_X86
+
+
+    //
+    // NEON kernels: they return the number of processed pixels
+    //
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+    static size_t _RgbToRgba_Neon(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        for (; i + 16 <= nbPixels; i += 16)
+        {
+            uint8x16x3_t rgb = vld3q_u8(src + 3 * i);
+            uint8x16x4_t rgba;
+            rgba.val[0] = rgb.val[0];
+            rgba.val[1] = rgb.val[1];
+            rgba.val[2] = rgb.val[2];
+            rgba.val[3] = vdupq_n_u8(255);
+            vst4q_u8(dst + 4 * i, rgba);
+        }
+        return i;
+    }
+
+    static size_t _RgbaToRgb_Neon(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        for (; i + 16 <= nbPixels; i += 16)
+        {
+            uint8x16x4_t rgba = vld4q_u8(src + 4 * i);
+            uint8x16x3_t rgb;
+            rgb.val[0] = rgba.val[0];
+            rgb.val[1] = rgba.val[1];
+            rgb.val[2] = rgba.val[2];
+            vst3q_u8(dst + 3 * i, rgb);
+        }
+        return i;
+    }
+
+    static size_t _SwapRedBlue_Neon(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        for (; i + 16 <= nbPixels; i += 16)
+        {
+            uint8x16x4_t p = vld4q_u8(src + 4 * i);
+            uint8x16_t red = p.val[0];
+            p.val[0] = p.val[2];
+            p.val[2] = red;
+            vst4q_u8(dst + 4 * i, p);
+        }
+        return i;
+    }
+
+    static size_t _GrayToRgba_Neon(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        for (; i + 16 <= nbPixels; i += 16)
+        {
+            uint8x16_t g = vld1q_u8(src + i);
+            uint8x16x4_t rgba;
+            rgba.val[0] = g;
+            rgba.val[1] = g;
+            rgba.val[2] = g;
+            rgba.val[3] = vdupq_n_u8(255);
+            vst4q_u8(dst + 4 * i, rgba);
+        }
+        return i;
+    }
+
+    // 4 values => 4 gray RGBA pixels
+    static inline uint32x4_t _WindowToRgba_Neon(float32x4_t v, float32x4_t minValue, float32x4_t scale)
+    {
+        float32x4_t t = vmulq_f32(vsubq_f32(v, minValue), scale);
+        t = vmaxnmq_f32(t, vdupq_n_f32(0.f));  // also NaN => 0
+        t = vminq_f32(t, vdupq_n_f32(255.f));
+        uint32x4_t g = vcvtq_u32_f32(vaddq_f32(t, vdupq_n_f32(0.5f)));
+        uint32x4_t gg = vorrq_u32(g, vshlq_n_u32(g, 8));
+        return vorrq_u32(vorrq_u32(gg, vshlq_n_u32(g, 16)), vdupq_n_u32(0xFF000000));
+    }
+
+    static size_t _FloatToRgba_Neon(const float* src, uint8_t* dst, size_t nbPixels, const _Window& window)
+    {
+        const float32x4_t minValue = vdupq_n_f32(window.MinValue), scale = vdupq_n_f32(window.Scale);
+        size_t i = 0;
+        for (; i + 4 <= nbPixels; i += 4)
+            vst1q_u8(dst + 4 * i, vreinterpretq_u8_u32(_WindowToRgba_Neon(vld1q_f32(src + i), minValue, scale)));
+        return i;
+    }
+
+    static size_t _Uint16ToRgba_Neon(const uint16_t* src, uint8_t* dst, size_t nbPixels, const _Window& window)
+    {
+        const float32x4_t minValue = vdupq_n_f32(window.MinValue), scale = vdupq_n_f32(window.Scale);
+        size_t i = 0;
+        for (; i + 8 <= nbPixels; i += 8)
+        {
+            uint16x8_t v = vld1q_u16(src + i);
+            float32x4_t low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(v)));
+            float32x4_t high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(v)));
+            vst1q_u8(dst + 4 * i, vreinterpretq_u8_u32(_WindowToRgba_Neon(low, minValue, scale)));
+            vst1q_u8(dst + 4 * i + 16, vreinterpretq_u8_u32(_WindowToRgba_Neon(high, minValue, scale)));
+        }
+        return i;
+    }
+#endif // HELLOIMGUI_PIXEL_CONVERSION_NEON
+
+
+    //
+    // Public API: the SIMD kernels process most of the pixels, the scalar kernels process the remaining ones
+    //
+    void RgbToRgba(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        SimdLevel level = GetSimdLevel();
+        (void)level;
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+        if (level == SimdLevel::AVX2)
+            i = _RgbToRgba_Avx2(src, dst, nbPixels);
+#elif defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+        if (level == SimdLevel::NEON)
+            i = _RgbToRgba_Neon(src, dst, nbPixels);
+#endif
+        _RgbToRgba_Scalar(src + 3 * i, dst + 4 * i, nbPixels - i);
+    }
+
+    void RgbaToRgb(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        SimdLevel level = GetSimdLevel();
+        (void)level;
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+        if (level == SimdLevel::AVX2)
+            i = _RgbaToRgb_Avx2(src, dst, nbPixels);
+#elif defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+        if (level == SimdLevel::NEON)
+            i = _RgbaToRgb_Neon(src, dst, nbPixels);
+#endif
+        _RgbaToRgb_Scalar(src + 4 * i, dst + 3 * i, nbPixels - i);
+    }
+
+    void BgraToRgba(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        SimdLevel level = GetSimdLevel();
+        (void)level;
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+        if (level == SimdLevel::AVX2)
+            i = _SwapRedBlue_Avx2(src, dst, nbPixels);
+        else if (level == SimdLevel::SSE2)
+            i = _SwapRedBlue_Sse2(src, dst, nbPixels);
+#elif defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+        if (level == SimdLevel::NEON)
+            i = _SwapRedBlue_Neon(src, dst, nbPixels);
+#endif
+        _SwapRedBlue_Scalar(src + 4 * i, dst + 4 * i, nbPixels - i);
+    }
+
+    void RgbaToBgra(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        BgraToRgba(src, dst, nbPixels);
+    }
+
+    void GrayToRgba(const uint8_t* src, uint8_t* dst, size_t nbPixels)
+    {
+        size_t i = 0;
+        SimdLevel level = GetSimdLevel();
+        (void)level;
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+        if (level == SimdLevel::AVX2)
+            i = _GrayToRgba_Avx2(src, dst, nbPixels);
+        else if (level == SimdLevel::SSE2)
+            i = _GrayToRgba_Sse2(src, dst, nbPixels);
+#elif defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+        if (level == SimdLevel::NEON)
+            i = _GrayToRgba_Neon(src, dst, nbPixels);
+#endif
+        _GrayToRgba_Scalar(src + i, dst + 4 * i, nbPixels - i);
+    }
+
+    void FloatToRgba(const float* src, uint8_t* dst, size_t nbPixels, float minValue, float maxValue)
+    {
+        _Window window(minValue, maxValue);
+        size_t i = 0;
+        SimdLevel level = GetSimdLevel();
+        (void)level;
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+        if (level == SimdLevel::AVX2)
+            i = _FloatToRgba_Avx2(src, dst, nbPixels, window);
+        else if (level == SimdLevel::SSE2)
+            i = _FloatToRgba_Sse2(src, dst, nbPixels, window);
+#elif defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+        if (level == SimdLevel::NEON)
+            i = _FloatToRgba_Neon(src, dst, nbPixels, window);
+#endif
+        _WindowToRgba_Scalar(src + i, dst + 4 * i, nbPixels - i, window);
+    }
+
+    void Uint16ToRgba(const uint16_t* src, uint8_t* dst, size_t nbPixels, float minValue, float maxValue)
+    {
+        _Window window(minValue, maxValue);
+        size_t i = 0;
+        SimdLevel level = GetSimdLevel();
+        (void)level;
+#if defined(HELLOIMGUI_PIXEL_CONVERSION_X86)
+        if (level == SimdLevel::AVX2)
+            i = _Uint16ToRgba_Avx2(src, dst, nbPixels, window);
+        else if (level == SimdLevel::SSE2)
+            i = _Uint16ToRgba_Sse2(src, dst, nbPixels, window);
+#elif defined(HELLOIMGUI_PIXEL_CONVERSION_NEON)
+        if (level == SimdLevel::NEON)
+            i = _Uint16ToRgba_Neon(src, dst, nbPixels, window);
+#endif
+        _WindowToRgba_Scalar(src + i, dst + 4 * i, nbPixels - i, window);
+    }
+
+    ValueWindow MinMax(const float* src, size_t nbPixels)
+    {
+        ValueWindow r;
+        bool isFirst = true;
+        for (size_t i = 0; i < nbPixels; ++i)
+        {
+            float v = src[i];
+            if (std::isnan(v))
+                continue;
+            if (isFirst || v < r.minValue)
+                r.minValue = v;
+            if (isFirst || v > r.maxValue)
+                r.maxValue = v;
+            isFirst = false;
+        }
+        return r;
+    }
+
+    ValueWindow MinMax(const uint16_t* src, size_t nbPixels)
+    {
+        if (nbPixels == 0)
+            return {};
+        auto minMax = std::minmax_element(src, src + nbPixels);
+        return {(float)*minMax.first, (float)*minMax.second};
+    }
+
+    void FlipVertically(uint8_t* pixels, size_t width, size_t height, size_t bytesPerPixel)
+    {
+        // Swaps the rows through a small buffer (memcpy is already vectorized)
+        uint8_t buffer[4096];
+        size_t stride = width * bytesPerPixel;
+        for (size_t y = 0; y < height / 2; ++y)
+        {
+            uint8_t* rowA = pixels + y * stride;
+            uint8_t* rowB = pixels + (height - 1 - y) * stride;
+            for (size_t offset = 0; offset < stride; offset += sizeof(buffer))
+            {
+                size_t size = std::min(sizeof(buffer), stride - offset);
+                memcpy(buffer, rowA + offset, size);
+                memcpy(rowA + offset, rowB + offset, size);
+                memcpy(rowB + offset, buffer, size);
+            }
+        }
+    }
+}
+}
@@ -1,14 +1,18 @@
 #include "hello_imgui/internal/backend_impls/abstract_runner.h"
 #include "hello_imgui/hello_imgui_theme.h"
+#include "hello_imgui/hello_imgui_logger.h"
 #include "hello_imgui/internal/borderless_movable.h"
 #include "hello_imgui/internal/clock_seconds.h"
 #include "hello_imgui/internal/docking_details.h"
+#include "hello_imgui/internal/hello_imgui_assets_prefetch.h"
 #include "hello_imgui/internal/hello_imgui_ini_settings.h"
 #include "hello_imgui/internal/hello_imgui_ini_any_parent_folder.h"
+#include "hello_imgui/internal/imgui_allocator.h"
 #include "hello_imgui/internal/menu_statusbar.h"
 #include "hello_imgui/internal/platform/ini_folder_locations.h"
 #include "hello_imgui/internal/inicpp.h"
 #include "hello_imgui/internal/poor_man_log.h"
+#include "hello_imgui/internal/startup_tracer.h"
 #include "imgui.h"
 
 #include "hello_imgui/internal/imgui_global_context.h" // must be included before imgui_internal.h
@@ -25,6 +29,7 @@
 
 #include <chrono>
 #include <cassert>
+#include <cstdlib>
 #include <filesystem>
 #include <cstdio>
 #include <optional>
@@ -86,14 +91,7 @@ bool ShouldRemoteDisplay();
 
 // Encapsulated inside docking_details.cpp
 void ShowThemeTweakGuiWindow_Static();
-
-// Encapsulated inside docking_details.cpp
-namespace AddDockableWindowHelper
-{
-    void Callback_1_GuiRender();
-    void Callback_2_PreNewFrame();
-}
-
+void ShowWindowsCostWindow_Static();
 
 
 struct AbstractRunnerStatics
@@ -146,11 +144,6 @@ void AbstractRunner::Run()
 }
 
 
-#ifdef HELLO_IMGUI_IMGUI_SHARED
-static void*   MyMallocWrapper(size_t size, void* user_data)    { IM_UNUSED(user_data); return malloc(size); }
-static void    MyFreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_data); free(ptr); }
-#endif
-
 void AbstractRunner::PrepareWindowGeometry()
 {
     mGeometryHelper = std::make_unique<WindowGeometryHelper>(
@@ -206,7 +199,8 @@ bool AbstractRunner::WantAutoSize()
 #else
     // AutoSize at startup happens on the second frame, 
     // since the window may have been resized to handle DPI scaling on the first frame
-    bool autosizeAtStartup = (mIdxFrame == 1) &&  !mGeometryHelper->HasInitialWindowSizeInfo();
+    // (or on the first frame with fastStartup, since the DPI was handled before)
+    bool autosizeAtStartup = (mIdxFrame == IdxFrameStartupAutoSize()) &&  !mGeometryHelper->HasInitialWindowSizeInfo();
     bool autosizeAtNextFrame = params.appWindowParams.windowGeometry.resizeAppWindowAtNextFrame;
     return autosizeAtStartup || autosizeAtNextFrame;
 #endif
@@ -415,11 +409,52 @@ void AbstractRunner::SetupDpiAwareParams()
 }
 
 
+// fastStartup: if the DPI factor is known before the window creation (from dpiAwareParams, hello_imgui.ini,
+// or the monitor where the window will be created), the window is directly created with the correct size.
+void AbstractRunner::ApplyDpiBeforeWindowCreation_IfFastStartup()
+{
+    if (!params.appWindowParams.fastStartup || !ShallSizeWindowRelativeTo96Ppi())
+        return;
+    auto monitorsWorkAreas = mBackendWindowHelper->GetMonitorsWorkAreas();
+    if (monitorsWorkAreas.empty())
+        return;
+    int monitorIdx = SearchForMonitor(monitorsWorkAreas, params.appWindowParams).monitorIdx;
+
+    ReadDpiAwareParams(&params.dpiAwareParams);
+    float scaleFactor = params.dpiAwareParams.dpiWindowSizeFactor;
+    if (scaleFactor == 0.f)
+        scaleFactor = mBackendWindowHelper->GetMonitorDpiScaleFactor(monitorIdx);
+    if (scaleFactor <= 0.f)
+        return; // Unknown: the window will be resized on the first frame, when its DPI is known
+    mDpiWindowSizeFactorAtCreation = scaleFactor;
+    if (scaleFactor == 1.f)
+        return;
+
+    auto& windowGeometry = params.appWindowParams.windowGeometry;
+    ScreenBounds bounds { windowGeometry.position, windowGeometry.size };
+    bounds.size = {(int)((float)bounds.size[0] * scaleFactor),
+                   (int)((float)bounds.size[1] * scaleFactor)};
+    // (with MonitorCenter and OsDefault, the position is computed by the window creation)
+    if (windowGeometry.positionMode == HelloImGui::WindowPositionMode::FromCoords)
+    {
+        ForDim2(dim)
+            bounds.position[dim] = (int)((float)bounds.position[dim] * scaleFactor);
+    }
+    bounds = monitorsWorkAreas[monitorIdx].EnsureWindowFitsThisMonitor(bounds);
+    windowGeometry.position = bounds.position;
+    windowGeometry.size = bounds.size;
+}
+
+
 void AbstractRunner::MakeWindowSizeRelativeTo96Ppi_IfRequired()
 {
     if (ShallSizeWindowRelativeTo96Ppi())
     {
         float scaleFactor = params.dpiAwareParams.dpiWindowSizeFactor;
+        // With fastStartup, the window may have been created with the correct size already:
+        // only correct it if the actual DPI factor is different
+        if (mDpiWindowSizeFactorAtCreation > 0.f)
+            scaleFactor /= mDpiWindowSizeFactorAtCreation;
         if (scaleFactor != 1.f)
         {
             auto bounds = mBackendWindowHelper->GetWindowBounds(mWindow);
@@ -455,7 +490,8 @@ void AbstractRunner::MakeWindowSizeRelativeTo96Ppi_IfRequired()
 }
 
 // This will change the window size if we want a size relative to 96ppi and rescale the imgui style
-void AbstractRunner::HandleDpiOnSecondFrame()
+// (called on the second frame, or at the end of Setup() with fastStartup)
+void AbstractRunner::HandleDpiOnFirstFrames()
 {
 #ifndef __ANDROID__
     MakeWindowSizeRelativeTo96Ppi_IfRequired();
@@ -537,11 +573,30 @@ void AbstractRunner::LayoutSettings_Save()
 void AbstractRunner::InitImGuiContext()
 {
     IMGUI_CHECKVERSION();
+
+    // The allocator functions are installed before the context is created (every block freed by
+    // ImGuiAllocator::Free shall come from ImGuiAllocator::Alloc), and are never uninstalled.
+    {
+        const auto& allocatorParams = params.imGuiAllocatorParams;
+        ImGuiAllocator::Configure(allocatorParams.enableTracking, allocatorParams.useSizeClassPool);
+        ImGuiAllocator::ResetStats();
+        bool shallInstallAllocator = allocatorParams.enableTracking || allocatorParams.useSizeClassPool;
+#ifdef HELLO_IMGUI_IMGUI_SHARED
+        shallInstallAllocator = true; // ImGui and the application may not share the same heap
+#endif
+        static bool wasAllocatorInstalled = false;
+        if (shallInstallAllocator && !wasAllocatorInstalled)
+        {
+            ImGui::SetAllocatorFunctions(ImGuiAllocator::Alloc, ImGuiAllocator::Free);
+            wasAllocatorInstalled = true;
+        }
+        mNbHeapAllocationWarnings = 0;
+    }
+
 #ifdef HELLO_IMGUI_IMGUI_SHARED
     auto ctx = ImGui::CreateContext();
     GImGui = ctx;
     ImGui::SetCurrentContext(ctx);
-    ImGui::SetAllocatorFunctions(MyMallocWrapper, MyFreeWrapper);
 #else
     ImGui::CreateContext();
 #endif
@@ -698,30 +753,86 @@ void AbstractRunner::InitRenderBackendCallbacks()
 }
 
 
+// The assets which are read on a worker thread at startup (see AssetsPrefetch):
+// the window icon, the default fonts (if used), and the user's RunnerParams.assetsToPrefetch
+static std::vector<std::string> AssetsToPrefetchAtStartup(const RunnerParams& params)
+{
+    std::vector<std::string> r = params.assetsToPrefetch;
+    r.push_back("app_settings/icon.png");  // see Impl_SetWindowIcon()
+
+    using LoadFontsFunctionPtr = void(*)();
+    auto loadFontsFunction = params.callbacks.LoadAdditionalFonts.target<LoadFontsFunctionPtr>();
+    if (loadFontsFunction != nullptr && *loadFontsFunction == ImGuiDefaultSettings::LoadDefaultFont_WithFontAwesomeIcons)
+    {
+        r.push_back("fonts/DroidSans.ttf");
+        if (params.callbacks.defaultIconFont == DefaultIconFont::FontAwesome4)
+            r.push_back("fonts/fontawesome-webfont.ttf");
+        else if (params.callbacks.defaultIconFont == DefaultIconFont::FontAwesome6)
+            r.push_back("fonts/Font_Awesome_6_Free-Solid-900.otf");
+    }
+    return r;
+}
+
+
 void AbstractRunner::Setup()
 {
     auto& self = *this;
-    InitRenderBackendCallbacks();
 
-    InitImGuiContext();
-    CheckPrefs();
+    if (params.startupTraceFilename.empty())
+    {
+        const char* startupTraceFilename = std::getenv("HELLOIMGUI_STARTUP_TRACE");
+        if (startupTraceFilename != nullptr)
+            params.startupTraceFilename = startupTraceFilename;
+    }
+    if (!params.startupTraceFilename.empty())
+        StartupTracer::Start();
+    StartupTracer::ScopedEvent setupTraceEvent("AbstractRunner::Setup");
+
+    // The worker threads are available to the callbacks (PostInit, LoadAdditionalFonts, ...),
+    // and are started by the first call to Async()
+    #if !defined(__EMSCRIPTEN__) || defined(HELLOIMGUI_EMSCRIPTEN_PTHREAD)
+    mJobSystem.StartLazily(params.nbAsyncWorkerThreads);
+    #endif
+
+    {
+        StartupTracer::ScopedEvent traceEvent("InitImGuiContext");
+        InitRenderBackendCallbacks();
+        InitImGuiContext();
+        CheckPrefs();
+    }
+
+    // The ini file and the assets needed during startup (fonts, icon) are read on worker threads,
+    // while the platform backend, the window and the rendering context are being initialized.
+    // (the ImGui calls and the rendering backend calls stay on the main thread)
+    HelloImGuiIniSettings::PrefetchIniFile(IniSettingsLocation(params));
+    AssetsPrefetch::Prefetch(AssetsToPrefetchAtStartup(params));
 
     // Init platform backend (SDL, Glfw)
-    Impl_InitPlatformBackend();
+    {
+        StartupTracer::ScopedEvent traceEvent("Impl_InitPlatformBackend");
+        Impl_InitPlatformBackend();
 
-    #ifdef HELLOIMGUI_HAS_OPENGL
-        if (params.rendererBackendType == RendererBackendType::OpenGL3)
-            Impl_Select_Gl_Version();
-    #endif
+        #ifdef HELLOIMGUI_HAS_OPENGL
+            if (params.rendererBackendType == RendererBackendType::OpenGL3)
+                Impl_Select_Gl_Version();
+        #endif
+    }
 
-    PrepareWindowGeometry();
+    {
+        StartupTracer::ScopedEvent traceEvent("PrepareWindowGeometry");
+        PrepareWindowGeometry();
+        ApplyDpiBeforeWindowCreation_IfFastStartup();
+    }
 
     auto fnRenderCallbackDuringResize = [this]()
     {
         if (! mWasWindowResizedByCodeDuringThisFrame)
         {
             //printf("Window resized by user\n");
-            CreateFramesAndRender(true);
+            if (params.appWindowParams.resizeCoalescing)
+                OnResizeEvent_Coalesced();
+            else
+                CreateFramesAndRender(true);
         }
         else
         {
@@ -729,35 +840,53 @@ void AbstractRunner::Setup()
         }
     };
 
-    Impl_CreateWindow(fnRenderCallbackDuringResize);
+    {
+        StartupTracer::ScopedEvent traceEvent("Impl_CreateWindow");
+        Impl_CreateWindow(fnRenderCallbackDuringResize);
+    }
+    // When an Async result is available, the idling main loop is woken up
+    mJobSystem.SetWakeUpCallback([this]() { mBackendWindowHelper->WakeUp(); });
 
     #ifdef HELLOIMGUI_HAS_OPENGL
         if (params.rendererBackendType == RendererBackendType::OpenGL3)
         {
+            StartupTracer::ScopedEvent traceEvent("Impl_CreateGlContext");
             Impl_CreateGlContext();
             Impl_InitGlLoader();
         }
     #endif
 
-    Impl_SetWindowIcon();
-
-    // The order is important: first read the DPI aware params
-    SetupDpiAwareParams();
-    // Then adjust window size if needed
-    AdjustWindowBoundsAfterCreation_IfDpiChangedBetweenRuns();
+    {
+        StartupTracer::ScopedEvent traceEvent("Impl_SetWindowIcon");
+        Impl_SetWindowIcon();
+    }
 
+    {
+        StartupTracer::ScopedEvent traceEvent("SetupDpiAwareParams");
+        // The order is important: first read the DPI aware params
+        SetupDpiAwareParams();
+        // Then adjust window size if needed
+        AdjustWindowBoundsAfterCreation_IfDpiChangedBetweenRuns();
+    }
 
-    // This should be done before Impl_LinkPlatformAndRenderBackends()
-    // because, in the case of glfw ImGui_ImplGlfw_InstallCallbacks
-    // will chain the user callbacks with ImGui callbacks;
-	// and PostInit() is a good place for the user to install callbacks
-    if (params.callbacks.PostInit_AddPlatformBackendCallbacks)
-        params.callbacks.PostInit_AddPlatformBackendCallbacks();
 
-    Impl_LinkPlatformAndRenderBackends();
+    {
+        StartupTracer::ScopedEvent traceEvent("Impl_LinkPlatformAndRenderBackends");
+        // This should be done before Impl_LinkPlatformAndRenderBackends()
+        // because, in the case of glfw ImGui_ImplGlfw_InstallCallbacks
+        // will chain the user callbacks with ImGui callbacks;
+        // and PostInit() is a good place for the user to install callbacks
+        if (params.callbacks.PostInit_AddPlatformBackendCallbacks)
+            params.callbacks.PostInit_AddPlatformBackendCallbacks();
+
+        Impl_LinkPlatformAndRenderBackends();
+    }
 
     if (params.callbacks.PostInit)
+    {
+        StartupTracer::ScopedEvent traceEvent("callbacks.PostInit");
         params.callbacks.PostInit();
+    }
 
     params.callbacks.SetupImGuiConfig();
 
@@ -769,14 +898,19 @@ void AbstractRunner::Setup()
     //
     // load fonts & set ImGui::GetIO().FontGlobalScale
     //
-
-    // LoadAdditionalFonts will load fonts and resize them by 1./FontGlobalScale
-    // (if and only if it uses HelloImGui::LoadFontTTF instead of ImGui's font loading functions)
-    ImGui::GetIO().Fonts->Clear();
-    params.callbacks.LoadAdditionalFonts();
-    params.callbacks.LoadAdditionalFonts = nullptr;
-    bool buildSuccess = ImGui::GetIO().Fonts->Build();
-    IM_ASSERT(buildSuccess && "ImGui::GetIO().Fonts->Build() failed!");
+    {
+        // LoadAdditionalFonts will load fonts and resize them by 1./FontGlobalScale
+        // (if and only if it uses HelloImGui::LoadFontTTF instead of ImGui's font loading functions)
+        StartupTracer::ScopedEvent traceEvent("callbacks.LoadAdditionalFonts");
+        ImGui::GetIO().Fonts->Clear();
+        params.callbacks.LoadAdditionalFonts();
+        params.callbacks.LoadAdditionalFonts = nullptr;
+    }
+    {
+        StartupTracer::ScopedEvent traceEvent("Fonts->Build");
+        bool buildSuccess = ImGui::GetIO().Fonts->Build();
+        IM_ASSERT(buildSuccess && "ImGui::GetIO().Fonts->Build() failed!");
+    }
     {
         // Reset FontGlobalScale if we did not use HelloImGui font loading mechanism
         if (! HelloImGui::DidCallHelloImGuiLoadFontTTF())
@@ -786,21 +920,31 @@ void AbstractRunner::Setup()
         }
     }
 
-    DockingDetails::ConfigureImGuiDocking(params.imGuiWindowParams);
-    HelloImGuiIniSettings::LoadHelloImGuiMiscSettings(IniSettingsLocation(params), &params);
-    SetLayoutResetIfNeeded();
-
-    ImGuiTheme::ApplyTweakedTheme(params.imGuiWindowParams.tweakedTheme);
+    {
+        StartupTracer::ScopedEvent traceEvent("LoadHelloImGuiMiscSettings");
+        DockingDetails::ConfigureImGuiDocking(params.imGuiWindowParams);
+        HelloImGuiIniSettings::LoadHelloImGuiMiscSettings(IniSettingsLocation(params), &params);
+        SetLayoutResetIfNeeded();
+    }
 
-    // Fix issue with ImGui & Viewports: title bar cannot be transparent
-    if (params.imGuiWindowParams.enableViewports)
     {
-        auto& style = ImGui::GetStyle();
-        style.Colors[ImGuiCol_TitleBg].w = 1.f;
-        style.Colors[ImGuiCol_TitleBgActive].w = 1.f;
-        style.Colors[ImGuiCol_TitleBgCollapsed].w = 1.f;
+        StartupTracer::ScopedEvent traceEvent("Setup style");
+        ImGuiTheme::ApplyTweakedTheme(params.imGuiWindowParams.tweakedTheme);
+
+        // Fix issue with ImGui & Viewports: title bar cannot be transparent
+        if (params.imGuiWindowParams.enableViewports)
+        {
+            auto& style = ImGui::GetStyle();
+            style.Colors[ImGuiCol_TitleBg].w = 1.f;
+            style.Colors[ImGuiCol_TitleBgActive].w = 1.f;
+            style.Colors[ImGuiCol_TitleBgCollapsed].w = 1.f;
+        }
+        params.callbacks.SetupImGuiStyle();
     }
-    params.callbacks.SetupImGuiStyle();
+
+    // With fastStartup, the first frame is already a layout pass with the final window size and style
+    if (params.appWindowParams.fastStartup)
+        HandleDpiOnFirstFrames();
 
     // Create a remote display handler if needed
     mRemoteDisplayHandler.Create();
@@ -810,6 +954,73 @@ void AbstractRunner::Setup()
 }
 
 
+// Called by the platform backend when the window is resized by the user (with AppWindowParams.resizeCoalescing):
+// the resize is only queued, and the previous frame may be presented again.
+// The GUI code is not reentered: the next full frame is done by the main loop, once the size is stable.
+void AbstractRunner::OnResizeEvent_Coalesced()
+{
+    ResizeCoalescer::Params coalescerParams;
+    float maxFps = params.appWindowParams.resizeRedrawMaxFps;
+    if (maxFps <= 0.f)
+        maxFps = mBackendWindowHelper->GetWindowMonitorRefreshRate(mWindow);
+    coalescerParams.maxRedrawFps = (maxFps > 0.f) ? (double)maxFps : 60.;
+    coalescerParams.stableDelaySeconds = (double)params.appWindowParams.resizeStableDelaySeconds;
+    mResizeCoalescer.SetParams(coalescerParams);
+
+    double now = Internal::ClockSeconds();
+    mResizeCoalescer.OnResizeEvent(now);
+    if (mResizeCoalescer.ShallRedrawPreviousFrame(now))
+        RedrawPreviousFrame_Stretched();
+}
+
+
+// Presents the draw data of the previous frame again, stretched to the current window size.
+// Only the rendering backend is used: no ImGui frame, and no user callback.
+void AbstractRunner::RedrawPreviousFrame_Stretched()
+{
+    ImDrawData* drawData = ImGui::GetDrawData();
+    if (drawData == nullptr || !drawData->Valid || drawData->DisplaySize.x <= 0.f || drawData->DisplaySize.y <= 0.f)
+        return;
+    ScreenSize windowSize = mBackendWindowHelper->GetWindowBounds(mWindow).size;
+    if (windowSize[0] <= 0 || windowSize[1] <= 0)
+        return;
+
+    // The backends compute the framebuffer size from DisplaySize * FramebufferScale
+    ImVec2 framebufferScale = drawData->FramebufferScale;
+    drawData->FramebufferScale = ImVec2(
+        framebufferScale.x * (float)windowSize[0] / drawData->DisplaySize.x,
+        framebufferScale.y * (float)windowSize[1] / drawData->DisplaySize.y);
+
+    mRenderingBackendCallbacks->Impl_NewFrame_3D();
+    mRenderingBackendCallbacks->Impl_Frame_3D_ClearColor(params.imGuiWindowParams.backgroundColor);
+    mRenderingBackendCallbacks->Impl_RenderDrawData_To_3D();
+    Impl_SwapBuffers();
+
+    drawData->FramebufferScale = framebufferScale;
+}
+
+
+// Frame pacing: with targetFps or justInTime, sleeps before polling the events (see FramePacer)
+void AbstractRunner::SleepBeforePollEvents_FramePacing()
+{
+    const auto& framePacing = params.rendererBackendOptions.framePacing;
+
+    // The refresh rate is queried from time to time, since the window may be moved to another monitor
+    if (mFramePacingMonitorRefreshRate < 0.f || mIdxFrame % 120 == 0)
+        mFramePacingMonitorRefreshRate = mBackendWindowHelper->GetWindowMonitorRefreshRate(mWindow);
+
+    bool presentWaitsForVblank = framePacing.vsync;
+    if (params.rendererBackendType == RendererBackendType::Vulkan && framePacing.vulkanPresentMode != VulkanPresentMode::Fifo)
+        presentWaitsForVblank = false;
+    mFramePacer.SetOptions(framePacing, (double)mFramePacingMonitorRefreshRate, presentWaitsForVblank);
+
+    double sleepSeconds = mFramePacer.SecondsToSleepBeforePoll(Internal::ClockSeconds());
+    if (sleepSeconds > 0.)
+        FramePacer::SleepPrecise(sleepSeconds);
+    mFramePacer.OnPacingSleep(sleepSeconds);
+}
+
+
 void AbstractRunner::SetLayoutResetIfNeeded()
 {
     if (params.imGuiWindowParams.defaultImGuiWindowType == DefaultImGuiWindowType::ProvideFullScreenDockSpace)
@@ -871,6 +1082,7 @@ void AbstractRunner::RenderGui()
             mGeometryHelper->TrySetWindowSize(
                 mBackendWindowHelper.get(), mWindow, userWidgetsSize,
                 this->setWasWindowResizedByCodeDuringThisFrame);
+            mWasWindowAutoResizedOnPreviousFrame = true;
         }
     }
 
@@ -880,6 +1092,7 @@ void AbstractRunner::RenderGui()
         Menu_StatusBar::ShowStatusBar(params);
 
     ShowThemeTweakGuiWindow_Static();
+    ShowWindowsCostWindow_Static();
 
     if (params.callbacks.PostRenderDockableWindows)
         params.callbacks.PostRenderDockableWindows();
@@ -955,6 +1168,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
                 mRenderingBackendCallbacks->Impl_DestroyFontTexture();
                 mRenderingBackendCallbacks->Impl_CreateFontTexture();
                 mRemoteDisplayHandler.SendFonts();
+                mViewportsRenderer.Invalidate();  // the font texture ID may be reused
             }
         }
     };
@@ -984,6 +1198,8 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
                 params.callbacks.registerTestsCalled = true;
             }
         }
+        if (params.useImGuiTestEngine)
+            TestEngineCallbacks::HeadlessRun_OnFrame();
         #endif
     };
 
@@ -999,13 +1215,18 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
         // iv/  At the beginning of the third frame (mIdxFrame==2 / mWasWindowAutoResizedOnPreviousFrame), we may apply the auto-size and recenter the window to the center of the monitor
         // v/   At the 4th frame (mIdxFrame >= 3), we finally show the window
         // Phew...
+        //
+        // With appWindowParams.fastStartup, this is shortened:
+        // ii/ is done at the end of Setup() (and the window may have been created with the correct size),
+        // the first frame is a layout-only pass which measures the widgets size (iii/), and the window
+        // is shown at the beginning of the second frame (after iv/). See IdxFrameShowWindow().
 
         // ii/ On the second frame (mIdxFrame == 1), we may multiply this size by the Dpi factor (if > 1), to handle windows and linux High DPI
-        if (mIdxFrame == 1)
+        if (mIdxFrame == 1 && !params.appWindowParams.fastStartup)
         {
             // We might resize the window on the second frame on window and linux
             // (and rescale ImGui style)
-            HandleDpiOnSecondFrame();
+            HandleDpiOnFirstFrames();
         }
 
         // iv/ At the beginning of the third frame (mIdxFrame==2 / mWasWindowAutoResizedOnPreviousFrame), we may apply the auto-size and recenter the window to the center of the monitor
@@ -1019,7 +1240,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
             // we do this on the third frame (mIdxFrame == 2), since the initial autosize happens on the second
             // (see WantAutoSize())
             if (params.appWindowParams.windowGeometry.positionMode == HelloImGui::WindowPositionMode::MonitorCenter &&
-                (mIdxFrame == 2))
+                (mIdxFrame == IdxFrameStartupAutoSize() + 1))
                 mGeometryHelper->CenterWindowOnMonitor(mBackendWindowHelper.get(), mWindow, this->setWasWindowResizedByCodeDuringThisFrame);
 
             mWasWindowAutoResizedOnPreviousFrame = false;
@@ -1028,7 +1249,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
 
 
         // v/   At the 4th frame (mIdxFrame >= 3), we finally show the window
-        if (mIdxFrame == 3)
+        if (mIdxFrame == IdxFrameShowWindow())
         {
             if (params.appWindowParams.hidden)
                 mBackendWindowHelper->HideWindow(mWindow);
@@ -1037,7 +1258,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
             gStatics.lastHiddenState = params.appWindowParams.hidden;
         }
         // On subsequent frames, we take into account user modifications of appWindowParams.hidden
-        if (mIdxFrame > 3)
+        if (mIdxFrame > IdxFrameShowWindow())
         {
             if (params.appWindowParams.hidden != gStatics.lastHiddenState)
             {
@@ -1051,7 +1272,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
 
         // Transmit window size to remote server (if needed)
         #ifdef HELLOIMGUI_WITH_REMOTE_DISPLAY
-        if ((mIdxFrame > 3) && params.remoteParams.transmitWindowSize)
+        if ((mIdxFrame > IdxFrameShowWindow()) && params.remoteParams.transmitWindowSize)
         {
             auto windowSize = params.appWindowParams.windowGeometry.size;
             mRemoteDisplayHandler.TransmitWindowSizeToDisplay(windowSize);
@@ -1068,7 +1289,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
     //  - idling is enabled
     // - no recent event was received, and the app is not in the first frames
     // - no test running
-    // - not in remote display mode
+    // - not in remote display mode (unless the remote display paces the frames)
     auto fnCanIdle = [this]() -> bool
     {
         double now = Internal::ClockSeconds();
@@ -1091,7 +1312,17 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
         // If the app started recently, do not idle
         bool startedRecently = mIdxFrame < 12;
 
-        bool preventIdling = isIdlingDisabledByParams || hasRecentEvent || isTestEngineRunning || ShouldRemoteDisplay() || startedRecently;
+        // If displaying remotely, do not idle (unless the remote display paces the frames)
+        bool isRemoteDisplayUnpaced = ShouldRemoteDisplay() && !mRemoteDisplayHandler.IsFramePacingActive();
+
+        // If images were added to the atlas, their textures are updated at the start of the next frame
+        bool hasPendingAtlasUploads = HelloImGui::internal::ImageAtlas_HasPendingUploads();
+
+        // If Async results are available, their continuations are called at the start of the next frame
+        bool hasPendingAsyncContinuations = mJobSystem.HasMainThreadContinuations();
+
+        bool preventIdling = isIdlingDisabledByParams || hasRecentEvent || isTestEngineRunning || isRemoteDisplayUnpaced || startedRecently
+                             || hasPendingAtlasUploads || hasPendingAsyncContinuations;
         return ! preventIdling;
     };
 
@@ -1184,6 +1415,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
             params.callbacks.LoadAdditionalFonts = nullptr;
 
             mRemoteDisplayHandler.SendFonts();
+            mViewportsRenderer.Invalidate();  // the font texture ID may be reused
         }
     };
 
@@ -1262,10 +1494,18 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
         ImGui::Render();
         mRenderingBackendCallbacks->Impl_RenderDrawData_To_3D();
 
+        // Capture the main viewport before additional platform windows change the current context,
+        // and before the buffers are swapped
+        mFrameRecorder.Heartbeat_PostRender([this](ImageBuffer& buffer, std::vector<uint8_t>& scratch) {
+            return ScreenshotRgbInto(buffer, scratch);
+        });
+
         if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
             Impl_UpdateAndRenderAdditionalPlatformWindows();
 
+        mFramePacer.OnBeforeSwap(Internal::ClockSeconds());
         Impl_SwapBuffers();
+        mFramePacer.OnPresented(Internal::ClockSeconds());
 
         mRemoteDisplayHandler.Heartbeat_PostImGuiRender();
     };
@@ -1346,16 +1586,25 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
     //                                           std::function<void()> renderCallbackDuringResize) = 0;
     // Where renderCallbackDuringResize is set to CreateFramesAndRender(skipPollEvents=true)
 
+    ImGuiAllocator::SetPhase(ImGuiAllocator::Phase::BeforeNewFrame);
+
+    // The first frames (until the window is shown) are part of the startup trace
+    std::optional<StartupTracer::ScopedEvent> firstFramesTraceEvent;
+    if (mIdxFrame <= IdxFrameShowWindow() && !insideReentrantCall && StartupTracer::IsRecording())
+    {
+        static const char* firstFramesNames[] = { "Frame 0", "Frame 1", "Frame 2", "Frame 3" };
+        firstFramesTraceEvent.emplace(IsLayoutOnlyFrame() ? "Frame 0 (layout only)" : firstFramesNames[mIdxFrame]);
+    }
+
     // Will display on remote server if needed
     mRemoteDisplayHandler.Heartbeat_PreImGuiNewFrame();
 
-    if (ShouldRemoteDisplay()) // FIXME, unrelated
+    if (ShouldRemoteDisplay())
     {
-        // if displaying remote, the FPS is limited on the server to a value between 30 and 60 fps
-        // We cannot idle too slow, other the GUI becomes really sluggish
-        // Ideally, we should ask the server about it current refresh rate
-        // (At the moment, we can only deliver 30fps)
-        params.fpsIdling.fpsIdle = 30.f;
+        // if displaying remote, the FPS is limited by the clients:
+        // with imgui-ws, it is adapted to the rate at which the clients acknowledge frames
+        // (see RemotePacingController), with netImgui it is RemoteParams::fpsWithoutPacing
+        params.fpsIdling.fpsIdle = mRemoteDisplayHandler.RecommendedFps();
     }
 
     {
@@ -1382,6 +1631,16 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
             return;
     }
 
+    // Frame pacing (targetFps / justInTime): sleep before polling the events
+    // (not while idling, not during the first frames, and not when the remote display paces the frames)
+    #if !defined(__EMSCRIPTEN__)
+    if (!insideReentrantCall && !params.fpsIdling.isIdling && mIdxFrame > IdxFrameShowWindow() && !ShouldRemoteDisplay())
+    {
+        SCOPED_RELEASE_GIL_ON_MAIN_THREAD;
+        SleepBeforePollEvents_FramePacing();
+    }
+    #endif
+
     // Handle poll events
     // Warning: Due to severe gotcha inside GLFW and SDL: PollEvent is supposed to return immediately,
     // but it doesn't when resizing the window!
@@ -1392,10 +1651,27 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
         fnHandlePollEvents_MayReRenderDuringResize_GotchaReentrant();
     }
 
+    // Resize coalescing: while the window is being resized, the full frames are postponed,
+    // and the previous frame is presented again (see OnResizeEvent_Coalesced)
+    if (!insideReentrantCall && params.appWindowParams.resizeCoalescing
+        && mResizeCoalescer.IsResizing(Internal::ClockSeconds()))
+    {
+        SCOPED_RELEASE_GIL_ON_MAIN_THREAD;
+        double now = Internal::ClockSeconds();
+        if (mResizeCoalescer.ShallRedrawPreviousFrame(now))
+            RedrawPreviousFrame_Stretched();
+        else
+            mBackendWindowHelper->WaitForEventTimeout(mResizeCoalescer.SecondsUntilNextEvent(now));
+        return;
+    }
+
     // Detect if an event was received, and store the time of the last event
     {
-        if (ImGui::GetCurrentContext()->InputEventsQueue.size() > nbEventsBeforePollAndIdle)
+        bool receivedInputEvents = ImGui::GetCurrentContext()->InputEventsQueue.size() > nbEventsBeforePollAndIdle;
+        if (receivedInputEvents)
             gStatics.timeLastEvent = Internal::ClockSeconds();
+        if (!insideReentrantCall)
+            mFramePacer.OnEventsPolled(Internal::ClockSeconds(), receivedInputEvents);
     }
 
     {
@@ -1405,20 +1681,29 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
     }
 
     // Handle AddDockableWindow(): this call should be done before ImGui::NewFrame
-    if (!insideReentrantCall && mIdxFrame > 3)
+    if (!insideReentrantCall && mIdxFrame > IdxFrameShowWindow())
         AddDockableWindowHelper::Callback_2_PreNewFrame();
 
+    // The continuations of Async() run on the main thread, before ImGui::NewFrame
+    // (they are user callbacks, so they are not inside SCOPED_RELEASE_GIL_ON_MAIN_THREAD)
+    if (!insideReentrantCall)
+        mJobSystem.RunMainThreadContinuations();
+
     if ((params.callbacks.PreNewFrame) && !insideReentrantCall)
         params.callbacks.PreNewFrame();
 
+    ImGuiAllocator::SetPhase(ImGuiAllocator::Phase::NewFrame);
     {
         SCOPED_RELEASE_GIL_ON_MAIN_THREAD;
+        // The atlas textures are updated before any draw command of this frame uses them
+        HelloImGui::internal::ImageAtlas_FlushUploads();
         fnNewFrameRenderingAndPlatformBackend();
     }
 
     // ImGui::NewFrame may call ImGuiTestEngine_PostNewFrame, which in turn handles the GIL in its own way,
     // so that it can *NOT* be called inside SCOPED_RELEASE_GIL_ON_MAIN_THREAD
     ImGui::NewFrame();
+    ImGuiAllocator::SetPhase(ImGuiAllocator::Phase::Gui);
 
     {
         fnCheckOpenGlErrorOnFirstFrame_WarnPotentialFontError(); // not in a SCOPED_RELEASE_GIL_ON_MAIN_THREAD, because it is very fast and rare
@@ -1427,7 +1712,7 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
     }
 
     // Handle AddDockableWindow(): this call should be done when ImGui is accepting widgets
-    if (mIdxFrame > 3)
+    if (mIdxFrame > IdxFrameShowWindow())
         AddDockableWindowHelper::Callback_1_GuiRender();
 
     // iii/ At the end of the second frame, we measure the size of the widgets and use it as the application window size,
@@ -1439,14 +1724,23 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
     if (params.callbacks.BeforeImGuiRender)
         params.callbacks.BeforeImGuiRender();
 
+    ImGuiAllocator::SetPhase(ImGuiAllocator::Phase::Render);
+    if (IsLayoutOnlyFrame())
     {
-        SCOPED_RELEASE_GIL_ON_MAIN_THREAD;
-        fnRenderAndSwap();
+        // fastStartup: the first frame is only used to lay out the widgets (the window is still hidden)
+        ImGui::EndFrame();
     }
+    else
+    {
+        {
+            SCOPED_RELEASE_GIL_ON_MAIN_THREAD;
+            fnRenderAndSwap();
+        }
 
-    // AfterSwap is a user callback, so it should not be inside SCOPED_RELEASE_GIL_ON_MAIN_THREAD
-    if (params.callbacks.AfterSwap)
-        params.callbacks.AfterSwap();
+        // AfterSwap is a user callback, so it should not be inside SCOPED_RELEASE_GIL_ON_MAIN_THREAD
+        if (params.callbacks.AfterSwap)
+            params.callbacks.AfterSwap();
+    }
 
     // TestEngineCallbacks::PostSwap() handles the GIL in its own way,
     // it can not be called inside SCOPED_RELEASE_GIL_ON_MAIN_THREAD
@@ -1457,9 +1751,62 @@ void AbstractRunner::CreateFramesAndRender(bool insideReentrantCall)
 
     gStatics.lastRefreshTime = Internal::ClockSeconds();
 
+    // The window was shown during this frame: the startup is finished
+    // (the prefetched assets may be used until then, e.g. by PostInit or by the first frames)
+    if (mIdxFrame == IdxFrameShowWindow() && !insideReentrantCall)
+    {
+        HelloImGuiIniSettings::DiscardPrefetchedIniFile();
+        AssetsPrefetch::DiscardPrefetchedAssets();
+        if (StartupTracer::IsRecording())
+        {
+            firstFramesTraceEvent.reset();
+            StartupTracer::AddInstantEvent("First visible frame");
+            if (StartupTracer::StopAndSave(params.startupTraceFilename))
+                printf("HelloImGui: startup trace saved to %s\n", params.startupTraceFilename.c_str());
+            else
+                fprintf(stderr, "HelloImGui: failed to save startup trace to %s\n", params.startupTraceFilename.c_str());
+        }
+    }
+
+    if (!insideReentrantCall)
+    {
+        size_t nbHeapAllocations = ImGuiAllocator::OnFrameEnd();
+        ImGuiAllocator::SetPhase(ImGuiAllocator::Phase::BeforeNewFrame);
+        WarnOnImGuiHeapAllocations(nbHeapAllocations);
+    }
+
     mIdxFrame += 1;
 }
 
+void AbstractRunner::RenderAdditionalPlatformWindows()
+{
+    std::function<void(ImGuiViewport*)> fnOnFirstRender;
+#ifdef HELLOIMGUI_HAS_OPENGL
+    // Only the main window waits for the vblank: otherwise each secondary viewport would wait for its own vblank,
+    // one after the other
+    if (params.imGuiWindowParams.viewportsNonBlockingSwap && params.rendererBackendType == RendererBackendType::OpenGL3)
+        fnOnFirstRender = [this](ImGuiViewport*) { Impl_SetSwapInterval_CurrentGlContext(0); };
+#endif
+    mViewportsRenderer.RenderPlatformWindows(params.imGuiWindowParams.viewportsSkipUnchangedFrames, fnOnFirstRender);
+}
+
+void AbstractRunner::WarnOnImGuiHeapAllocations(size_t nbHeapAllocations)
+{
+    const int maxNbWarnings = 20;
+    int afterFrame = params.imGuiAllocatorParams.warnOnHeapAllocationsAfterFrame;
+    if (afterFrame < 0 || mIdxFrame <= afterFrame || nbHeapAllocations == 0 || mNbHeapAllocationWarnings >= maxNbWarnings)
+        return;
+    auto stats = ImGuiAllocator::GetStats();
+    HelloImGui::Log(LogLevel::Warning,
+                    "ImGui made %zu heap allocation(s) during frame %d (before NewFrame: %zu, NewFrame: %zu, Gui: %zu, Render: %zu)",
+                    nbHeapAllocations, mIdxFrame,
+                    stats.lastFrame_BeforeNewFrame.heapAllocations, stats.lastFrame_NewFrame.heapAllocations,
+                    stats.lastFrame_Gui.heapAllocations, stats.lastFrame_Render.heapAllocations);
+    mNbHeapAllocationWarnings += 1;
+    if (mNbHeapAllocationWarnings == maxNbWarnings)
+        HelloImGui::Log(LogLevel::Warning, "ImGui heap allocations: no more warnings will be emitted");
+}
+
 void AbstractRunner::OnPause()
 {
     #ifdef HELLOIMGUI_MOBILEDEVICE
@@ -1496,6 +1843,16 @@ void AbstractRunner::TearDown(bool gotException)
 {
     IM_ASSERT(!mWasTearedDown && "TearDown() called twice!");
     mWasTearedDown = true;
+    HelloImGuiIniSettings::DiscardPrefetchedIniFile();
+    AssetsPrefetch::DiscardPrefetchedAssets();
+
+    // Wait for the pending Async jobs (they may need the GIL), then call their continuations while ImGui is alive
+    {
+        SCOPED_RELEASE_GIL_ON_MAIN_THREAD;
+        mJobSystem.Stop();
+    }
+    mJobSystem.SetWakeUpCallback(nullptr);
+    mJobSystem.RunMainThreadContinuations();
     if (! gotException)
     {
         // Store screenshot before exiting
@@ -1512,6 +1869,9 @@ void AbstractRunner::TearDown(bool gotException)
         HelloImGuiIniSettings::SaveHelloImGuiMiscSettings(IniSettingsLocation(params), params);
     }
 
+    // Flush the pending frames of a recording in progress
+    mFrameRecorder.Stop();
+
     HelloImGui::internal::Free_ImageFromAssetMap();
 
     if (!gotException && params.callbacks.BeforeExit)
@@ -1546,6 +1906,14 @@ std::string AbstractRunner::LoadUserPref(const std::string& userPrefName)
     return HelloImGuiIniSettings::LoadUserPref(IniSettingsLocation(params), userPrefName);
 }
 
+bool AbstractRunner::ScreenshotRgbInto(ImageBuffer& buffer, std::vector<uint8_t>& scratch)
+{
+    if (mRenderingBackendCallbacks->Impl_ScreenshotRgbInto_3D)
+        return mRenderingBackendCallbacks->Impl_ScreenshotRgbInto_3D(buffer, scratch);
+    buffer = mRenderingBackendCallbacks->Impl_ScreenshotRgb_3D();
+    return buffer.width > 0 && buffer.height > 0;
+}
+
 bool AbstractRunner::ShouldRemoteDisplay()
 {
     return mRemoteDisplayHandler.ShouldRemoteDisplay();
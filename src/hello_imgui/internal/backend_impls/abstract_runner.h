@@ -3,12 +3,18 @@
 #include "hello_imgui/hello_imgui_screenshot.h"
 #include "hello_imgui/internal/backend_impls/backend_window_helper/backend_window_helper.h"
 #include "hello_imgui/internal/backend_impls/backend_window_helper/window_geometry_helper.h"
+#include "hello_imgui/internal/backend_impls/frame_pacer.h"
+#include "hello_imgui/internal/backend_impls/frame_recorder.h"
 #include "hello_imgui/internal/backend_impls/rendering_callbacks.h"
 #include "hello_imgui/internal/backend_impls/remote_display_handler.h"
+#include "hello_imgui/internal/backend_impls/resize_coalescer.h"
+#include "hello_imgui/internal/backend_impls/viewports_renderer.h"
+#include "hello_imgui/internal/job_system.h"
 #include "hello_imgui/runner_params.h"
 
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace HelloImGui
 {
@@ -38,6 +44,20 @@ public:
 
     // For jupyter notebook, which displays a screenshot post execution
     ImageBuffer ScreenshotRgb() { return mRenderingBackendCallbacks->Impl_ScreenshotRgb_3D(); }
+    // Same as ScreenshotRgb(), but reuses the given buffers when the rendering backend supports it
+    // (`scratch` is a work buffer owned by the caller)
+    bool ScreenshotRgbInto(ImageBuffer& buffer, std::vector<uint8_t>& scratch);
+
+    // See StartRecording() in hello_imgui_screenshot.h
+    FrameRecorder& GetFrameRecorder() { return mFrameRecorder; }
+
+    // Used by ImageFromAsset, to mirror the user textures on the remote display
+    RemoteDisplayHandler& GetRemoteDisplayHandler() { return mRemoteDisplayHandler; }
+
+    // See GetFramePacingStats() in hello_imgui.h
+    FramePacingStats GetFramePacingStats() const { return mFramePacer.GetStats(); }
+    // See GetViewportsRenderStats() in hello_imgui.h
+    std::vector<ViewportRenderStats> GetViewportsRenderStats() const { return mViewportsRenderer.GetStats(); }
 
     void ChangeWindowSize(ScreenSize windowSize);
     void UseWindowFullMonitorWorkArea();
@@ -69,6 +89,10 @@ protected:
     virtual void Impl_Cleanup() = 0;
     virtual void Impl_SetWindowIcon() {}
 
+    // Renders and presents the secondary viewports (to be called by Impl_UpdateAndRenderAdditionalPlatformWindows,
+    // instead of ImGui::RenderPlatformWindowsDefault)
+    void RenderAdditionalPlatformWindows();
+
     //
     // Linking the platform backend (SDL, Glfw, ...) to the rendering backend (OpenGL, ...)
     //
@@ -81,6 +105,8 @@ protected:
         virtual void Impl_InitGlLoader() = 0;
         virtual std::string Impl_GlslVersion() const = 0;
         virtual void Impl_CreateGlContext() = 0;
+        // Sets the swap interval of the current OpenGL context (0: do not wait for the vblank)
+        virtual void Impl_SetSwapInterval_CurrentGlContext(int interval) { (void)interval; }
     #endif
 
 private:
@@ -93,13 +119,29 @@ private:
     bool CheckDpiAwareParamsChanges();
     void PrepareWindowGeometry();
     void AdjustWindowBoundsAfterCreation_IfDpiChangedBetweenRuns();
-    void HandleDpiOnSecondFrame();
+    void ApplyDpiBeforeWindowCreation_IfFastStartup();
+    void HandleDpiOnFirstFrames();
     void MakeWindowSizeRelativeTo96Ppi_IfRequired();
     bool ShallSizeWindowRelativeTo96Ppi();
     bool WantAutoSize();
 
+    // Startup frames: see fnHandleWindowSizeAndPositionOnFirstFrames_AndAfterResize
+    int IdxFrameStartupAutoSize() const { return params.appWindowParams.fastStartup ? 0 : 1; }
+    int IdxFrameShowWindow() const { return params.appWindowParams.fastStartup ? 1 : 3; }
+    bool IsLayoutOnlyFrame() const { return params.appWindowParams.fastStartup && mIdxFrame == 0; }
+
     void SetLayoutResetIfNeeded();
 
+    // See AppWindowParams.resizeCoalescing
+    void OnResizeEvent_Coalesced();
+    void RedrawPreviousFrame_Stretched();
+
+    // See RendererBackendOptions.framePacing
+    void SleepBeforePollEvents_FramePacing();
+
+    // See ImGuiAllocatorParams.warnOnHeapAllocationsAfterFrame
+    void WarnOnImGuiHeapAllocations(size_t nbHeapAllocations);
+
     void LayoutSettings_HandleChanges();
     void LayoutSettings_Load();
     void LayoutSettings_Save();
@@ -113,6 +155,8 @@ private:
     bool mPotentialFontLoadingError = false;
     int mIdxFrame = 0;
     bool mWasWindowAutoResizedOnPreviousFrame = false;
+    // The DPI factor applied to the window size before its creation (fastStartup only, 0 if none)
+    float mDpiWindowSizeFactorAtCreation = 0.f;
     bool mWasTearedDown = false;
 
     // Differentiate between cases where the window was resized by code
@@ -127,6 +171,20 @@ private:
     RenderingCallbacksPtr mRenderingBackendCallbacks;
 
     RemoteDisplayHandler mRemoteDisplayHandler;
+
+    FrameRecorder mFrameRecorder;
+
+    ResizeCoalescer mResizeCoalescer;
+
+    FramePacer mFramePacer;
+    float mFramePacingMonitorRefreshRate = -1.f;  // -1: not queried yet
+
+    int mNbHeapAllocationWarnings = 0;
+
+    ViewportsRenderer mViewportsRenderer;
+
+    // Worker threads of HelloImGui::Async()
+    JobSystem mJobSystem;
 };
 
 
@@ -68,6 +68,8 @@ namespace HelloImGui { namespace BackendApi
         virtual void SetWindowBounds(WindowPointer window, ScreenBounds windowBounds) = 0;
 
         virtual void WaitForEventTimeout(double timeout_seconds) = 0;
+        // Thread safe: makes a pending WaitForEventTimeout() return (e.g. when an Async result is available)
+        virtual void WakeUp() {}
 
         // (ImGui backends handle this by themselves)
         //virtual ImVec2 GetDisplayFramebufferScale(WindowPointer window) = 0;
@@ -76,6 +78,13 @@ namespace HelloImGui { namespace BackendApi
         // (i.e. the same size given at creation create the same physical size in mm on the screen)
         virtual float GetWindowSizeDpiScaleFactor(WindowPointer window) = 0;
 
+        // Same as GetWindowSizeDpiScaleFactor, for a window that would be created on this monitor
+        // (used to create the window with the correct size). Returns 0 if unknown.
+        virtual float GetMonitorDpiScaleFactor(int monitorIdx) { (void)monitorIdx; return 0.f; }
+
+        // Refresh rate (Hz) of the monitor which displays the window. Returns 0 if unknown.
+        virtual float GetWindowMonitorRefreshRate(WindowPointer window) { (void)window; return 0.f; }
+
         virtual void HideWindow(WindowPointer window) = 0;
         virtual void ShowWindow(WindowPointer window) = 0;
         virtual bool IsWindowHidden(WindowPointer window) = 0;
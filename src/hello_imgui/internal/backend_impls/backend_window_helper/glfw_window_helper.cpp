@@ -213,6 +213,11 @@ namespace HelloImGui { namespace BackendApi
         glfwWaitEventsTimeout(timeout_seconds);
     }
 
+    void GlfwWindowHelper::WakeUp()
+    {
+        glfwPostEmptyEvent();
+    }
+
     ImVec2 _GetWindowContentScale(HelloImGui::BackendApi::WindowPointer window)
     {
         float x_scale, y_scale;
@@ -230,6 +235,45 @@ namespace HelloImGui { namespace BackendApi
 #endif
     }
 
+    float GlfwWindowHelper::GetMonitorDpiScaleFactor(int monitorIdx)
+    {
+#ifdef __APPLE__
+        (void)monitorIdx;
+        return 1.f;
+#else
+        int nbMonitors;
+        GLFWmonitor** monitors = glfwGetMonitors(&nbMonitors);
+        if (monitors == nullptr || monitorIdx < 0 || monitorIdx >= nbMonitors)
+            return 0.f;
+        float x_scale, y_scale;
+        glfwGetMonitorContentScale(monitors[monitorIdx], &x_scale, &y_scale);
+        return x_scale;
+#endif
+    }
+
+    float GlfwWindowHelper::GetWindowMonitorRefreshRate(WindowPointer window)
+    {
+        // Full screen windows have a monitor, otherwise search for the monitor which contains the window center
+        GLFWmonitor* monitor = glfwGetWindowMonitor((GLFWwindow *) window);
+        if (monitor == nullptr)
+        {
+            auto windowCenter = GetWindowBounds(window).Center();
+            int nbMonitors;
+            GLFWmonitor** monitors = glfwGetMonitors(&nbMonitors);
+            for (int i = 0; i < nbMonitors && monitor == nullptr; ++i)
+            {
+                int x, y, w, h;
+                glfwGetMonitorWorkarea(monitors[i], &x, &y, &w, &h);
+                if (ScreenBounds{{x, y}, {w, h}}.Contains(windowCenter))
+                    monitor = monitors[i];
+            }
+            if (monitor == nullptr)
+                monitor = glfwGetPrimaryMonitor();
+        }
+        const GLFWvidmode* videoMode = (monitor != nullptr) ? glfwGetVideoMode(monitor) : nullptr;
+        return (videoMode != nullptr) ? (float)videoMode->refreshRate : 0.f;
+    }
+
     void GlfwWindowHelper::HideWindow(WindowPointer window)
     {
         glfwHideWindow((GLFWwindow *) window);
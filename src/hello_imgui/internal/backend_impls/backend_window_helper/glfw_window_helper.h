@@ -30,8 +30,11 @@ namespace HelloImGui { namespace BackendApi
         void SetWindowBounds(WindowPointer window, ScreenBounds windowBounds) override;
 
         void WaitForEventTimeout(double timeout_seconds) override;
+        void WakeUp() override;
 
         float GetWindowSizeDpiScaleFactor(WindowPointer window) override;
+        float GetMonitorDpiScaleFactor(int monitorIdx) override;
+        float GetWindowMonitorRefreshRate(WindowPointer window) override;
 
         void HideWindow(WindowPointer window) override;
         void ShowWindow(WindowPointer window) override;
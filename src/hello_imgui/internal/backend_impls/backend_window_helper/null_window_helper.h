@@ -41,6 +41,7 @@ namespace HelloImGui { namespace BackendApi
         }
 
         float GetWindowSizeDpiScaleFactor(WindowPointer window) override { return NullConfig::GetWindowSizeDpiScaleFactor(); }
+        float GetMonitorDpiScaleFactor(int monitorIdx) override { return NullConfig::GetWindowSizeDpiScaleFactor(); }
 
         void HideWindow(WindowPointer window) override {}
         void ShowWindow(WindowPointer window) override {}
@@ -227,6 +227,18 @@ namespace HelloImGui { namespace BackendApi
         SDL_WaitEventTimeout(NULL, timeout_ms);
     }
 
+    void SdlWindowHelper::WakeUp()
+    {
+        // An event type reserved for HelloImGui (ignored by the ImGui SDL backend)
+        static Uint32 wakeUpEventType = SDL_RegisterEvents(1);
+        if (wakeUpEventType == (Uint32)-1)
+            return;
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = wakeUpEventType;
+        SDL_PushEvent(&event);
+    }
+
     float SdlWindowHelper::GetWindowSizeDpiScaleFactor(WindowPointer window)
     {
         #if TARGET_OS_MAC // is true for any software platform that's derived from macOS, which includes iOS, watchOS, and tvOS
@@ -257,6 +269,23 @@ namespace HelloImGui { namespace BackendApi
 
     }
 
+    float SdlWindowHelper::GetMonitorDpiScaleFactor(int monitorIdx)
+    {
+        // GetWindowSizeDpiScaleFactor does not depend on the window
+        // (under windows & android, it uses the DPI of the first display)
+        (void)monitorIdx;
+        return GetWindowSizeDpiScaleFactor(nullptr);
+    }
+
+    float SdlWindowHelper::GetWindowMonitorRefreshRate(WindowPointer window)
+    {
+        SDL_DisplayMode displayMode;
+        int displayIndex = SDL_GetWindowDisplayIndex((SDL_Window *) window);
+        if (displayIndex < 0 || SDL_GetCurrentDisplayMode(displayIndex, &displayMode) != 0)
+            return 0.f;
+        return (float)displayMode.refresh_rate;  // 0 if unspecified
+    }
+
     void SdlWindowHelper::HideWindow(WindowPointer window)
     {
         SDL_HideWindow((SDL_Window *) window);
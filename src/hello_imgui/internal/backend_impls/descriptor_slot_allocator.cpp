@@ -0,0 +1,49 @@
+#include "hello_imgui/internal/backend_impls/descriptor_slot_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace HelloImGui
+{
+    DescriptorSlotAllocator::DescriptorSlotAllocator(int firstPoolCapacity, int maxPoolCapacity)
+        : mFirstPoolCapacity(firstPoolCapacity), mMaxPoolCapacity(std::max(firstPoolCapacity, maxPoolCapacity))
+    {
+        assert(firstPoolCapacity > 0);
+    }
+
+    DescriptorSlotAllocator::Slot DescriptorSlotAllocator::Allocate()
+    {
+        ++mNbUsedSlots;
+        if (!mFreeSlots.empty())
+        {
+            Slot slot = mFreeSlots.back();
+            mFreeSlots.pop_back();
+            slot.Recycled = true;
+            return slot;
+        }
+
+        bool isLastPoolFull = mPoolCapacities.empty() || mNbSlotsHandedOutInLastPool == mPoolCapacities.back();
+        if (isLastPoolFull)
+        {
+            int capacity = mPoolCapacities.empty()
+                ? mFirstPoolCapacity : std::min(mPoolCapacities.back() * 2, mMaxPoolCapacity);
+            mPoolCapacities.push_back(capacity);
+            mNbSlotsHandedOutInLastPool = 0;
+        }
+
+        Slot slot;
+        slot.PoolIndex = NbPools() - 1;
+        slot.IndexInPool = mNbSlotsHandedOutInLastPool++;
+        slot.Recycled = false;
+        return slot;
+    }
+
+    void DescriptorSlotAllocator::Free(const Slot& slot)
+    {
+        assert(slot.PoolIndex >= 0 && slot.PoolIndex < NbPools());
+        assert(mNbUsedSlots > 0);
+        --mNbUsedSlots;
+        mFreeSlots.push_back(slot);
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <vector>
+
+namespace HelloImGui
+{
+    // DescriptorSlotAllocator hands out slots from a growing list of pools, and recycles the freed slots
+    // (independent of the graphics API: the pools and the descriptor sets are created by the caller,
+    // e.g. in vulkan_textures.cpp).
+    //
+    // Each new pool is twice as large as the previous one (up to maxPoolCapacity), so that the number of pools
+    // stays small, and no pool is ever full of holes: the freed slots are reused first.
+    class DescriptorSlotAllocator
+    {
+    public:
+        struct Slot
+        {
+            int PoolIndex = -1;
+            int IndexInPool = -1;
+            // If true, the slot was used before, and its descriptor set already exists (it only needs to be updated)
+            bool Recycled = false;
+        };
+
+        DescriptorSlotAllocator(int firstPoolCapacity, int maxPoolCapacity);
+
+        // May add a pool: the caller shall then create the pool number NbPools() - 1, of capacity PoolCapacity()
+        Slot Allocate();
+        void Free(const Slot& slot);
+
+        int NbPools() const { return (int)mPoolCapacities.size(); }
+        int PoolCapacity(int poolIndex) const { return mPoolCapacities[poolIndex]; }
+        int NbUsedSlots() const { return mNbUsedSlots; }
+        int NbRecyclableSlots() const { return (int)mFreeSlots.size(); }
+
+    private:
+        int mFirstPoolCapacity, mMaxPoolCapacity;
+        std::vector<int> mPoolCapacities;
+        int mNbSlotsHandedOutInLastPool = 0;
+        int mNbUsedSlots = 0;
+        std::vector<Slot> mFreeSlots;
+    };
+}
@@ -0,0 +1,116 @@
+#include "hello_imgui/internal/backend_impls/draw_data_delta.h"
+
+#include <cstring>
+
+namespace HelloImGui
+{
+    uint64_t HashBytes64(const void* data, std::size_t size, uint64_t seed)
+    {
+        // Processes 8 bytes at a time, with a multiply / xor-shift mix (inspired by wyhash / splitmix64)
+        const uint64_t k = 0x9E3779B97F4A7C15ull;
+        uint64_t h = seed ^ (size * k);
+        const auto* p = static_cast<const unsigned char*>(data);
+        auto mix = [k](uint64_t v) {
+            v ^= v >> 31;
+            v *= k;
+            v ^= v >> 29;
+            return v;
+        };
+        while (size >= 8)
+        {
+            uint64_t v;
+            memcpy(&v, p, 8);
+            h = (h ^ mix(v)) * k;
+            p += 8;
+            size -= 8;
+        }
+        if (size > 0)
+        {
+            uint64_t v = 0;
+            memcpy(&v, p, size);
+            h = (h ^ mix(v)) * k;
+        }
+        return mix(h);
+    }
+
+    DrawDataDelta::DrawListSignature DrawDataDelta::ComputeSignature(const ImDrawList* drawList)
+    {
+        DrawListSignature r;
+        r.vtxCount = drawList->VtxBuffer.Size;
+        r.idxCount = drawList->IdxBuffer.Size;
+        r.cmdCount = drawList->CmdBuffer.Size;
+        r.vtxHash = HashBytes64(drawList->VtxBuffer.Data, (size_t)drawList->VtxBuffer.size_in_bytes());
+        r.idxHash = HashBytes64(drawList->IdxBuffer.Data, (size_t)drawList->IdxBuffer.size_in_bytes());
+
+        // ImDrawCmd may contain padding bytes: hash its fields one by one
+        uint64_t h = 0;
+        for (const ImDrawCmd& cmd : drawList->CmdBuffer)
+        {
+            h = HashBytes64(&cmd.ClipRect, sizeof(cmd.ClipRect), h);
+            h = HashBytes64(&cmd.TextureId, sizeof(cmd.TextureId), h);
+            h = HashBytes64(&cmd.VtxOffset, sizeof(cmd.VtxOffset), h);
+            h = HashBytes64(&cmd.IdxOffset, sizeof(cmd.IdxOffset), h);
+            h = HashBytes64(&cmd.ElemCount, sizeof(cmd.ElemCount), h);
+            h = HashBytes64(&cmd.UserCallback, sizeof(cmd.UserCallback), h);
+        }
+        r.cmdHash = h;
+        return r;
+    }
+
+    DrawDataDelta::FrameDelta DrawDataDelta::Compare(const ImDrawData* drawData)
+    {
+        FrameDelta r;
+        mCurrent.drawLists.clear();
+        if (drawData == nullptr)
+            return r;
+
+        mCurrent.displayPos = drawData->DisplayPos;
+        mCurrent.displaySize = drawData->DisplaySize;
+        mCurrent.framebufferScale = drawData->FramebufferScale;
+
+        bool sameGeometry = mHasSentFrame
+            && mCurrent.displayPos.x == mSent.displayPos.x && mCurrent.displayPos.y == mSent.displayPos.y
+            && mCurrent.displaySize.x == mSent.displaySize.x && mCurrent.displaySize.y == mSent.displaySize.y
+            && mCurrent.framebufferScale.x == mSent.framebufferScale.x && mCurrent.framebufferScale.y == mSent.framebufferScale.y
+            && drawData->CmdListsCount == (int)mSent.drawLists.size();
+
+        r.nbDrawLists = drawData->CmdListsCount;
+        for (int i = 0; i < drawData->CmdListsCount; ++i)
+        {
+            const ImDrawList* drawList = drawData->CmdLists[i];
+            mCurrent.drawLists.push_back(ComputeSignature(drawList));
+
+            std::size_t listBytes = (std::size_t)drawList->VtxBuffer.size_in_bytes()
+                                  + (std::size_t)drawList->IdxBuffer.size_in_bytes()
+                                  + (std::size_t)drawList->CmdBuffer.size_in_bytes();
+            r.totalBytes += listBytes;
+
+            bool isListChanged = !sameGeometry || !(mCurrent.drawLists.back() == mSent.drawLists[(size_t)i]);
+            if (isListChanged)
+            {
+                ++r.nbChangedDrawLists;
+                r.changedBytes += listBytes;
+            }
+        }
+        r.isIdentical = sameGeometry && (r.nbChangedDrawLists == 0);
+
+        ++mStats.nbFrames;
+        mStats.totalBytes += r.totalBytes;
+        mStats.changedBytes += r.changedBytes;
+        if (r.isIdentical)
+            ++mStats.nbIdenticalFrames;
+        return r;
+    }
+
+    void DrawDataDelta::MarkSent()
+    {
+        std::swap(mSent, mCurrent);
+        mHasSentFrame = true;
+    }
+
+    void DrawDataDelta::Invalidate()
+    {
+        mHasSentFrame = false;
+        mSent.drawLists.clear();
+    }
+}
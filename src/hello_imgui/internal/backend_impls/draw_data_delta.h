@@ -0,0 +1,71 @@
+#pragma once
+#include "imgui.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace HelloImGui
+{
+    // DrawDataDelta compares each ImDrawList of a frame (vertex, index and command buffers)
+    // against the last frame that was handed to a remote transport, using content hashes.
+    // It enables the remote display to skip identical frames, and to measure how much of a frame changed.
+    class DrawDataDelta
+    {
+    public:
+        struct FrameDelta
+        {
+            bool isIdentical = false;       // true if no draw list changed since the last sent frame
+            int nbDrawLists = 0;
+            int nbChangedDrawLists = 0;
+            std::size_t totalBytes = 0;     // Size of all draw lists buffers
+            std::size_t changedBytes = 0;   // Size of the buffers of the changed draw lists
+        };
+
+        struct Stats
+        {
+            std::size_t nbFrames = 0;
+            std::size_t nbIdenticalFrames = 0;
+            std::size_t totalBytes = 0;
+            std::size_t changedBytes = 0;
+        };
+
+        // Computes the delta between drawData and the last sent frame.
+        // Call MarkSent() if the frame was actually sent.
+        FrameDelta Compare(const ImDrawData* drawData);
+
+        // Stores the signatures computed by the last call to Compare() as the reference frame
+        void MarkSent();
+
+        // Forces the next frame to be considered as changed (e.g. after a reconnection or a fonts reload)
+        void Invalidate();
+
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        struct DrawListSignature
+        {
+            uint64_t vtxHash = 0, idxHash = 0, cmdHash = 0;
+            int vtxCount = 0, idxCount = 0, cmdCount = 0;
+            bool operator==(const DrawListSignature& o) const
+            {
+                return vtxHash == o.vtxHash && idxHash == o.idxHash && cmdHash == o.cmdHash
+                    && vtxCount == o.vtxCount && idxCount == o.idxCount && cmdCount == o.cmdCount;
+            }
+        };
+        struct FrameSignature
+        {
+            ImVec2 displayPos, displaySize, framebufferScale;
+            std::vector<DrawListSignature> drawLists;
+        };
+
+        static DrawListSignature ComputeSignature(const ImDrawList* drawList);
+
+        FrameSignature mCurrent, mSent;
+        bool mHasSentFrame = false;
+        Stats mStats;
+    };
+
+    // A fast, non cryptographic 64 bits hash (used to detect changes in draw buffers)
+    uint64_t HashBytes64(const void* data, std::size_t size, uint64_t seed = 0);
+}
@@ -0,0 +1,136 @@
+#include "hello_imgui/internal/backend_impls/frame_pacer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+
+namespace HelloImGui
+{
+    static constexpr size_t kMaxLatencySamples = 120;
+
+    void FramePacer::SetOptions(const FramePacingOptions& options, double monitorRefreshRate, bool presentWaitsForVblank)
+    {
+        mOptions = options;
+        mMonitorRefreshRate = monitorRefreshRate;
+        mPresentWaitsForVblank = presentWaitsForVblank;
+    }
+
+    bool FramePacer::IsActive() const
+    {
+        return mOptions.targetFps > 0.f || mOptions.justInTime;
+    }
+
+    double FramePacer::RefreshPeriod() const
+    {
+        // If the refresh rate is unknown, assume 60Hz
+        return (mMonitorRefreshRate > 0.) ? 1. / mMonitorRefreshRate : 1. / 60.;
+    }
+
+    double FramePacer::SecondsToSleepBeforePoll(double now) const
+    {
+        if (!IsActive() || mLastPollTime < 0. || mLastPresentTime < 0.)
+            return 0.;
+
+        double framePeriod = (mOptions.targetFps > 0.f) ? 1. / (double)mOptions.targetFps : 0.;
+
+        if (!mOptions.justInTime)
+        {
+            // Frame rate limiter: the frames start every framePeriod
+            double wakeTime = mLastPollTime + framePeriod;
+            return std::max(0., wakeTime - now);
+        }
+
+        // justInTime: poll the events so that the frame is ready shortly before it is presented
+        double margin = (double)mOptions.justInTimeMarginMs / 1000.;
+        double earliestPresent = now + mFrameDurationEstimate + margin;
+        if (framePeriod > 0.)
+            earliestPresent = std::max(earliestPresent, mLastPresentTime + framePeriod);
+
+        double wakeTime;
+        if (mPresentWaitsForVblank)
+        {
+            // The first vblank after earliestPresent (the vblanks occur every refreshPeriod after the last presentation)
+            double refreshPeriod = RefreshPeriod();
+            double nbPeriods = std::ceil((earliestPresent - mLastPresentTime) / refreshPeriod - 1e-3);
+            double targetPresent = mLastPresentTime + std::max(1., nbPeriods) * refreshPeriod;
+            wakeTime = targetPresent - mFrameDurationEstimate - margin;
+        }
+        else
+        {
+            // No vblank to wait for: the frame is presented as soon as it is rendered (the margin is useless)
+            if (framePeriod <= 0.)
+                return 0.;
+            wakeTime = mLastPresentTime + framePeriod - mFrameDurationEstimate;
+        }
+        return std::max(0., wakeTime - now);
+    }
+
+    void FramePacer::OnEventsPolled(double now, bool receivedInputEvents)
+    {
+        mLastPollTime = now;
+        mPolledSinceLastPresent = true;
+        mReceivedInputEvents = receivedInputEvents;
+    }
+
+    void FramePacer::OnBeforeSwap(double now)
+    {
+        if (!mPolledSinceLastPresent)
+            return;
+        // The estimate follows the increases immediately, and the decreases slowly
+        // (a frame which takes longer than expected misses the vblank)
+        double frameDuration = now - mLastPollTime;
+        if (frameDuration > mFrameDurationEstimate)
+            mFrameDurationEstimate = frameDuration;
+        else
+            mFrameDurationEstimate = mFrameDurationEstimate * 0.95 + frameDuration * 0.05;
+    }
+
+    void FramePacer::OnPresented(double now)
+    {
+        // Presentations which were not preceded by an event polling (e.g. redraws during a resize) are ignored
+        if (!mPolledSinceLastPresent)
+            return;
+        mPolledSinceLastPresent = false;
+        mLastPresentTime = now;
+
+        if (mReceivedInputEvents)
+        {
+            mInputLatencies.push_back(now - mLastPollTime);
+            while (mInputLatencies.size() > kMaxLatencySamples)
+                mInputLatencies.pop_front();
+        }
+    }
+
+    FramePacingStats FramePacer::GetStats() const
+    {
+        FramePacingStats r;
+        if (!mInputLatencies.empty())
+        {
+            double sum = 0., maxLatency = 0.;
+            for (double latency: mInputLatencies)
+            {
+                sum += latency;
+                maxLatency = std::max(maxLatency, latency);
+            }
+            r.inputLatencyMs_Last = (float)(mInputLatencies.back() * 1000.);
+            r.inputLatencyMs_Mean = (float)(sum / (double)mInputLatencies.size() * 1000.);
+            r.inputLatencyMs_Max = (float)(maxLatency * 1000.);
+        }
+        r.frameDurationMs_Estimated = (float)(mFrameDurationEstimate * 1000.);
+        r.pacingSleepMs_Last = (float)(mLastSleepSeconds * 1000.);
+        return r;
+    }
+
+    void FramePacer::SleepPrecise(double seconds)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        auto busyWaitDuration = std::chrono::milliseconds(1);
+        if (seconds > 0.002)
+            std::this_thread::sleep_until(deadline - busyWaitDuration);
+        while (Clock::now() < deadline)
+            std::this_thread::yield();
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "hello_imgui/renderer_backend_options.h"
+
+#include <deque>
+
+namespace HelloImGui
+{
+    // FramePacer decides how long the main loop shall sleep before polling the input events
+    // (see RendererBackendOptions.framePacing), and measures the input latency.
+    //
+    // - With targetFps, the frames are started at most every 1/targetFps seconds.
+    // - With justInTime, the events are polled as late as possible: shortly before the next vblank,
+    //   minus the estimated duration of a frame (from the event polling to the swap), minus a margin.
+    //   The vblanks are estimated from the time of the previous presentation (when the swap returned,
+    //   which is a vblank if the presentation waits for it), and from the monitor refresh rate.
+    //
+    // The clock is provided by the caller (in seconds), so that the pacer can be tested with a simulated clock.
+    class FramePacer
+    {
+    public:
+        // presentWaitsForVblank: true if the swap is synchronized with the vblank
+        // (i.e. vsync, and Fifo present mode with Vulkan)
+        void SetOptions(const FramePacingOptions& options, double monitorRefreshRate, bool presentWaitsForVblank);
+
+        // True if the pacer may sleep (targetFps or justInTime)
+        bool IsActive() const;
+
+        // Duration to sleep before polling the events (0 if the events shall be polled now)
+        double SecondsToSleepBeforePoll(double now) const;
+
+        // Called after the sleep (for the stats)
+        void OnPacingSleep(double seconds) { mLastSleepSeconds = seconds; }
+        // Called after the events were polled
+        void OnEventsPolled(double now, bool receivedInputEvents);
+        // Called before and after the swap
+        void OnBeforeSwap(double now);
+        void OnPresented(double now);
+
+        FramePacingStats GetStats() const;
+
+        // Sleeps during the given duration, with a better precision than std::this_thread::sleep_for
+        // (which may oversleep by more than 1ms on some platforms): the last millisecond is a busy wait.
+        static void SleepPrecise(double seconds);
+
+    private:
+        double RefreshPeriod() const;
+
+        FramePacingOptions mOptions;
+        double mMonitorRefreshRate = 0.;
+        bool mPresentWaitsForVblank = true;
+
+        double mLastPollTime = -1.;
+        double mLastPresentTime = -1.;
+        bool mPolledSinceLastPresent = false;
+        bool mReceivedInputEvents = false;
+
+        double mFrameDurationEstimate = 0.;  // from the event polling to the swap
+        double mLastSleepSeconds = 0.;
+        std::deque<double> mInputLatencies;
+    };
+}
@@ -0,0 +1,273 @@
+#include "hello_imgui/internal/backend_impls/frame_recorder.h"
+#include "hello_imgui/hello_imgui_logger.h"
+
+#include "stb_image_write.h"
+
+#include <algorithm>
+#include <filesystem>
+
+
+namespace HelloImGui
+{
+    FrameRecorder::~FrameRecorder()
+    {
+        Stop();
+    }
+
+    bool FrameRecorder::Start(const std::string& path, const RecordingOptions& options)
+    {
+#if defined(__EMSCRIPTEN__) && !defined(HELLOIMGUI_EMSCRIPTEN_PTHREAD)
+        (void)path; (void)options;
+        Log(LogLevel::Error, "StartRecording: not available under emscripten without pthread support");
+        return false;
+#else
+        Stop();
+
+        if (options.captureEveryNFrames < 1 || options.bufferPoolSize < 1)
+        {
+            Log(LogLevel::Error, "StartRecording: captureEveryNFrames and bufferPoolSize must be >= 1");
+            return false;
+        }
+
+        bool isImageSequence = (options.format != RecordingFormat::Y4mStream);
+        std::error_code ec;
+        if (isImageSequence)
+            std::filesystem::create_directories(path, ec);
+        else
+        {
+            auto parentPath = std::filesystem::path(path).parent_path();
+            if (!parentPath.empty())
+                std::filesystem::create_directories(parentPath, ec);
+        }
+        if (ec)
+        {
+            Log(LogLevel::Error, "StartRecording: cannot create folder for %s (%s)", path.c_str(), ec.message().c_str());
+            return false;
+        }
+
+        mPath = path;
+        mOptions = options;
+        mIdxRenderedFrame = 0;
+        mY4mWidth = mY4mHeight = 0;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBufferPool.clear();
+            mBufferPool.resize((size_t)options.bufferPoolSize);
+            mFreeSlots.clear();
+            for (int i = options.bufferPoolSize - 1; i >= 0; --i)
+                mFreeSlots.push_back(i);
+            mPendingFrames.clear();
+            mStats = RecordingStats();
+            mStats.isRecording = true;
+            mIsDroppingFrames = false;
+            mStopRequested = false;
+            mIsRecording = true;
+        }
+        mWorker = std::thread([this]() { WorkerLoop(); });
+        return true;
+#endif
+    }
+
+    void FrameRecorder::Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mIsRecording)
+                return;
+            mStopRequested = true;
+        }
+        mCondition.notify_all();
+        if (mWorker.joinable())
+            mWorker.join();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsRecording = false;
+        mStats.isRecording = false;
+        // Release the capture buffers
+        mBufferPool.clear();
+        mFreeSlots.clear();
+        if (mStats.droppedFrames > 0)
+            Log(LogLevel::Warning, "Recording %s: %zu frames dropped (written: %zu)",
+                mPath.c_str(), mStats.droppedFrames, mStats.writtenFrames);
+    }
+
+    bool FrameRecorder::IsRecording()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mIsRecording && !mStopRequested;
+    }
+
+    RecordingStats FrameRecorder::Stats()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mStats;
+    }
+
+    void FrameRecorder::Heartbeat_PostRender(const FnCaptureInto& fnCaptureInto)
+    {
+        int slot;
+        std::size_t frameIndex;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mIsRecording || mStopRequested)
+                return;
+
+            bool shallCapture = (mIdxRenderedFrame % (size_t)mOptions.captureEveryNFrames) == 0;
+            ++mIdxRenderedFrame;
+            if (!shallCapture)
+                return;
+
+            // Backpressure: the writer is late, drop this frame instead of waiting for it
+            if (mFreeSlots.empty())
+            {
+                ++mStats.droppedFrames;
+                if (!mIsDroppingFrames)
+                    Log(LogLevel::Warning, "Recording %s: writer is too slow, dropping frames", mPath.c_str());
+                mIsDroppingFrames = true;
+                return;
+            }
+            mIsDroppingFrames = false;
+            slot = mFreeSlots.back();
+            mFreeSlots.pop_back();
+            frameIndex = mStats.capturedFrames;
+        }
+
+        // The slot is now exclusively owned by the render thread: capture without holding the lock
+        bool captured = fnCaptureInto(mBufferPool[(size_t)slot], mCaptureScratch);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!captured)
+            {
+                mFreeSlots.push_back(slot);
+                mStats.lastError = "screenshot is not available with this rendering backend";
+                return;
+            }
+            ++mStats.capturedFrames;
+            mPendingFrames.push_back({slot, frameIndex});
+        }
+        mCondition.notify_one();
+    }
+
+    void FrameRecorder::WorkerLoop()
+    {
+        while (true)
+        {
+            PendingFrame pendingFrame;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this] { return mStopRequested || !mPendingFrames.empty(); });
+                if (mPendingFrames.empty()) // i.e. mStopRequested, and all frames were written
+                    break;
+                pendingFrame = mPendingFrames.front();
+                mPendingFrames.pop_front();
+            }
+
+            bool written = WriteFrame(mBufferPool[(size_t)pendingFrame.slot], pendingFrame.frameIndex);
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            mFreeSlots.push_back(pendingFrame.slot);
+            if (written)
+                ++mStats.writtenFrames;
+        }
+
+        if (mY4mFile != nullptr)
+        {
+            fclose(mY4mFile);
+            mY4mFile = nullptr;
+        }
+    }
+
+    bool FrameRecorder::WriteFrame(const ImageBuffer& frame, std::size_t frameIndex)
+    {
+        if (mOptions.format == RecordingFormat::Y4mStream)
+            return WriteY4mFrame(frame);
+
+        const char* extension = (mOptions.format == RecordingFormat::PngSequence) ? "png" : "ppm";
+        char filename[32];
+        snprintf(filename, sizeof(filename), "frame_%06zu.%s", frameIndex, extension);
+        std::string filePath = (std::filesystem::path(mPath) / filename).string();
+
+        if (mOptions.format == RecordingFormat::PngSequence)
+        {
+            int stride = (int)frame.width * 3;
+            int ok = stbi_write_png(filePath.c_str(), (int)frame.width, (int)frame.height, 3, frame.bufferRgb.data(), stride);
+            if (!ok)
+            {
+                SetError("cannot write " + filePath);
+                return false;
+            }
+            return true;
+        }
+
+        // Binary PPM (P6): a tiny header followed by the raw RGB pixels
+        FILE* f = fopen(filePath.c_str(), "wb");
+        if (f == nullptr)
+        {
+            SetError("cannot write " + filePath);
+            return false;
+        }
+        fprintf(f, "P6\n%zu %zu\n255\n", frame.width, frame.height);
+        size_t nbBytes = frame.width * frame.height * 3;
+        bool ok = fwrite(frame.bufferRgb.data(), 1, nbBytes, f) == nbBytes;
+        fclose(f);
+        if (!ok)
+            SetError("cannot write " + filePath);
+        return ok;
+    }
+
+    bool FrameRecorder::WriteY4mFrame(const ImageBuffer& frame)
+    {
+        if (mY4mFile == nullptr)
+        {
+            mY4mFile = fopen(mPath.c_str(), "wb");
+            if (mY4mFile == nullptr)
+            {
+                SetError("cannot write " + mPath);
+                return false;
+            }
+            mY4mWidth = frame.width;
+            mY4mHeight = frame.height;
+            fprintf(mY4mFile, "YUV4MPEG2 W%zu H%zu F%d:1 Ip A1:1 C444 XCOLORRANGE=FULL\n",
+                    mY4mWidth, mY4mHeight, mOptions.y4mFrameRate);
+        }
+
+        // A Y4M stream cannot change its size: frames captured after a window resize are skipped
+        if (frame.width != mY4mWidth || frame.height != mY4mHeight)
+        {
+            SetError("window size changed during a Y4M recording, frame skipped");
+            return false;
+        }
+
+        // RGB -> full range YCbCr 4:4:4 (BT.601 / JFIF coefficients, in 8 bits fixed point)
+        size_t nbPixels = frame.width * frame.height;
+        mY4mPlanes.resize(nbPixels * 3);
+        uint8_t* planeY = mY4mPlanes.data();
+        uint8_t* planeCb = planeY + nbPixels;
+        uint8_t* planeCr = planeCb + nbPixels;
+        const uint8_t* rgb = frame.bufferRgb.data();
+        for (size_t i = 0; i < nbPixels; ++i, rgb += 3)
+        {
+            int r = rgb[0], g = rgb[1], b = rgb[2];
+            int y  = (  77 * r + 150 * g +  29 * b + 128) >> 8;
+            int cb = ( -43 * r -  85 * g + 128 * b + 32896) >> 8;
+            int cr = ( 128 * r - 107 * g -  21 * b + 32896) >> 8;
+            planeY[i] = (uint8_t)std::min(y, 255);
+            planeCb[i] = (uint8_t)std::min(cb, 255);
+            planeCr[i] = (uint8_t)std::min(cr, 255);
+        }
+
+        fputs("FRAME\n", mY4mFile);
+        bool ok = fwrite(mY4mPlanes.data(), 1, mY4mPlanes.size(), mY4mFile) == mY4mPlanes.size();
+        if (!ok)
+            SetError("cannot write " + mPath);
+        return ok;
+    }
+
+    void FrameRecorder::SetError(const std::string& error)
+    {
+        // Called from the worker thread
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStats.lastError = error;
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "hello_imgui/hello_imgui_screenshot.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace HelloImGui
+{
+    // FrameRecorder captures frames on the render thread into a pool of reused buffers,
+    // and writes them on a worker thread (see StartRecording() in hello_imgui_screenshot.h)
+    class FrameRecorder
+    {
+    public:
+        // Fills the given buffer with a screenshot of the current frame (reusing its capacity).
+        // `scratch` is a work buffer owned by the recorder, reused across frames.
+        // Returns false if the screenshot is not available.
+        using FnCaptureInto = std::function<bool(ImageBuffer& buffer, std::vector<uint8_t>& scratch)>;
+
+        ~FrameRecorder();
+
+        bool Start(const std::string& path, const RecordingOptions& options);
+
+        // Will wait until all pending frames are written
+        void Stop();
+
+        bool IsRecording();
+        RecordingStats Stats();
+
+        // Called by the runner after the draw data was rendered, and before the buffers are swapped
+        // (does nothing if not recording)
+        void Heartbeat_PostRender(const FnCaptureInto& fnCaptureInto);
+
+    private:
+        void WorkerLoop();
+        bool WriteFrame(const ImageBuffer& frame, std::size_t frameIndex);
+        bool WriteY4mFrame(const ImageBuffer& frame);
+        void SetError(const std::string& error);
+
+        struct PendingFrame
+        {
+            int slot;
+            std::size_t frameIndex;
+        };
+
+        std::string mPath;
+        RecordingOptions mOptions;
+
+        // Guards all the members below
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        bool mIsRecording = false;
+        bool mStopRequested = false;
+        std::vector<ImageBuffer> mBufferPool;
+        std::vector<int> mFreeSlots;
+        std::deque<PendingFrame> mPendingFrames;
+        RecordingStats mStats;
+        bool mIsDroppingFrames = false;
+
+        // Only accessed from the render thread
+        std::size_t mIdxRenderedFrame = 0;
+        std::vector<uint8_t> mCaptureScratch;
+
+        // Only accessed from the worker thread
+        FILE* mY4mFile = nullptr;
+        std::size_t mY4mWidth = 0, mY4mHeight = 0;
+        std::vector<uint8_t> mY4mPlanes;
+
+        std::thread mWorker;
+    };
+}
@@ -3,6 +3,10 @@
 #include "imgui.h"
 #include "hello_imgui/hello_imgui_include_opengl.h"
 #include "hello_imgui/internal/pnm.h"
+#include "hello_imgui/pixel_conversion.h"
+
+#include <algorithm>
+#include <vector>
 
 #ifdef __linux__
 #include <unistd.h>
@@ -11,36 +15,50 @@
 
 namespace HelloImGui
 {
-    ImageBuffer OpenglScreenshotRgb()
+    bool OpenglScreenshotRgbInto(ImageBuffer& r, std::vector<uint8_t>& bufferRgba)
     {
         auto draw_data = ImGui::GetDrawData();
+        if (draw_data == nullptr)
+            return false;
         int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
         int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
 
         int depth = 3;
 
-        auto r = ImageBuffer();
         r.width = fb_width;
         r.height = fb_height;
 
+        // resize() keeps the capacity: buffers reused across frames (see FrameRecorder) are not reallocated
         size_t bufferSize= r.width * r.height * depth;
         r.bufferRgb.resize(bufferSize);
+
+        // Read as RGBA (the format which the drivers read fastest, and the only one guaranteed by OpenGL ES)
+        bufferRgba.resize(r.width * r.height * 4);
         glPixelStorei(GL_PACK_ALIGNMENT, 1);
         glReadPixels(
             0, 0,
             fb_width, fb_height,
-            GL_RGB, GL_UNSIGNED_BYTE,
-            r.bufferRgb.data());
+            GL_RGBA, GL_UNSIGNED_BYTE,
+            bufferRgba.data());
 
-        // Invert rows, since OpenGL (0,0) is at the bottomLeft
-        for(std::size_t y = 0; y <= r.height / 2; ++y)
+        // Convert to RGB, and invert rows, since OpenGL (0,0) is at the bottomLeft
+        for(std::size_t y = 0; y < r.height; ++y)
         {
-            int yd = (int)r.height - 1 - (int)y;
-            for(std::size_t x = 0; x < r.width * depth; ++x)
-            {
-                std::swap(r.bufferRgb[y * r.width * depth + x], r.bufferRgb[yd * r.width * depth + x]);
-            }
+            std::size_t ySrc = r.height - 1 - y;
+            PixelConversion::RgbaToRgb(
+                bufferRgba.data() + ySrc * r.width * 4,
+                r.bufferRgb.data() + y * r.width * depth,
+                r.width);
         }
+        return true;
+    }
+
+    ImageBuffer OpenglScreenshotRgb()
+    {
+        auto r = ImageBuffer();
+        std::vector<uint8_t> bufferRgba;
+        OpenglScreenshotRgbInto(r, bufferRgba);
+        int depth = 3;
 
         if (false)
         {
@@ -81,21 +99,7 @@ namespace HelloImGui
         glPixelStorei(GL_PACK_ALIGNMENT, 1);
         glReadPixels(x, y2, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
-        // Flip vertically
-        size_t comp = 4;
-        size_t stride = (size_t)w * comp;
-        auto* line_tmp = new unsigned char[stride];
-        auto* line_a = (unsigned char*)pixels;
-        unsigned char* line_b = (unsigned char*)pixels + (stride * ((size_t)h - 1));
-        while (line_a < line_b)
-        {
-            memcpy(line_tmp, line_a, stride);
-            memcpy(line_a, line_b, stride);
-            memcpy(line_b, line_tmp, stride);
-            line_a += stride;
-            line_b -= stride;
-        }
-        delete[] line_tmp;
+        PixelConversion::FlipVertically((uint8_t*)pixels, (size_t)w, (size_t)h, 4);
     }
 
     bool ImGuiApp_ImplGL_CaptureFramebuffer(ImGuiID viewport_id, int x, int y, int w, int h, unsigned int* pixels, void* user_data)
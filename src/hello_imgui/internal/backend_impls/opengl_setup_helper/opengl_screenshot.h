@@ -7,6 +7,9 @@
 namespace HelloImGui
 {
     ImageBuffer OpenglScreenshotRgb();
+    // Same as OpenglScreenshotRgb(), but reuses the given buffer.
+    // bufferRgba is a work buffer owned by the caller (the pixels are read as RGBA, then converted)
+    bool OpenglScreenshotRgbInto(ImageBuffer& buffer, std::vector<uint8_t>& bufferRgba);
 
     bool ImGuiApp_ImplGL_CaptureFramebuffer(ImGuiID viewport_id, int x, int y, int w, int h, unsigned int* pixels, void* user_data);
 }
@@ -0,0 +1,108 @@
+#include "hello_imgui/internal/backend_impls/pipeline_cache_file.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+
+namespace HelloImGui
+{
+    namespace PipelineCacheFile
+    {
+        static const char kMagic[8] = { 'H', 'I', 'P', 'C', 'A', 'C', 'H', '1' };
+
+        // magic, vendorId, deviceId, driverVersion, pipelineCacheUuid, dataSize, checksum
+        static constexpr size_t kHeaderSize = 8 + 4 + 4 + 4 + 16 + 8 + 8;
+
+        static uint64_t _Fnv1a(const uint8_t* data, size_t size)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= data[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // The values are stored in little endian
+        static void _WriteUint(std::vector<uint8_t>* out, uint64_t value, int nbBytes)
+        {
+            for (int i = 0; i < nbBytes; ++i)
+                out->push_back((uint8_t)(value >> (8 * i)));
+        }
+
+        static uint64_t _ReadUint(const uint8_t* in, int nbBytes)
+        {
+            uint64_t r = 0;
+            for (int i = 0; i < nbBytes; ++i)
+                r |= (uint64_t)in[i] << (8 * i);
+            return r;
+        }
+
+        std::vector<uint8_t> Serialize(const DeviceKey& key, const std::vector<uint8_t>& cacheData)
+        {
+            std::vector<uint8_t> r;
+            r.reserve(kHeaderSize + cacheData.size());
+            r.insert(r.end(), kMagic, kMagic + sizeof(kMagic));
+            _WriteUint(&r, key.vendorId, 4);
+            _WriteUint(&r, key.deviceId, 4);
+            _WriteUint(&r, key.driverVersion, 4);
+            r.insert(r.end(), key.pipelineCacheUuid, key.pipelineCacheUuid + sizeof(key.pipelineCacheUuid));
+            _WriteUint(&r, cacheData.size(), 8);
+            _WriteUint(&r, _Fnv1a(cacheData.data(), cacheData.size()), 8);
+            r.insert(r.end(), cacheData.begin(), cacheData.end());
+            return r;
+        }
+
+        bool Deserialize(const std::vector<uint8_t>& fileContent, const DeviceKey& key, std::vector<uint8_t>* outCacheData)
+        {
+            outCacheData->clear();
+            if (fileContent.size() < kHeaderSize)
+                return false;
+            const uint8_t* p = fileContent.data();
+            if (memcmp(p, kMagic, sizeof(kMagic)) != 0)
+                return false;
+            p += sizeof(kMagic);
+
+            bool sameDevice =
+                   _ReadUint(p, 4) == key.vendorId
+                && _ReadUint(p + 4, 4) == key.deviceId
+                && _ReadUint(p + 8, 4) == key.driverVersion
+                && memcmp(p + 12, key.pipelineCacheUuid, sizeof(key.pipelineCacheUuid)) == 0;
+            if (!sameDevice)
+                return false;
+            p += 12 + sizeof(key.pipelineCacheUuid);
+
+            uint64_t dataSize = _ReadUint(p, 8);
+            uint64_t checksum = _ReadUint(p + 8, 8);
+            if (dataSize != fileContent.size() - kHeaderSize)
+                return false;
+            const uint8_t* data = fileContent.data() + kHeaderSize;
+            if (_Fnv1a(data, (size_t)dataSize) != checksum)
+                return false;
+
+            outCacheData->assign(data, data + dataSize);
+            return true;
+        }
+
+        std::vector<uint8_t> Load(const std::string& filename, const DeviceKey& key)
+        {
+            std::vector<uint8_t> r;
+            std::ifstream is(filename, std::ios::binary);
+            if (!is.good())
+                return r;
+            std::vector<uint8_t> fileContent((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+            Deserialize(fileContent, key, &r);
+            return r;
+        }
+
+        bool Save(const std::string& filename, const DeviceKey& key, const std::vector<uint8_t>& cacheData)
+        {
+            std::vector<uint8_t> fileContent = Serialize(key, cacheData);
+            std::ofstream os(filename, std::ios::binary);
+            os.write((const char*)fileContent.data(), (std::streamsize)fileContent.size());
+            return os.good();
+        }
+    }
+}
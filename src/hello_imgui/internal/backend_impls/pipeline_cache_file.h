@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace HelloImGui
+{
+    // PipelineCacheFile: the file format of the persistent pipeline cache (see RendererBackendOptions.vulkanPersistentPipelineCache)
+    //
+    // The cache data (returned by vkGetPipelineCacheData) is prefixed with a header which identifies the device
+    // and the driver: a cache is only reused on the same device with the same driver version, since the drivers
+    // may crash (or silently recompile everything) with an incompatible cache. A checksum detects truncated files.
+    namespace PipelineCacheFile
+    {
+        struct DeviceKey
+        {
+            uint32_t vendorId = 0;
+            uint32_t deviceId = 0;
+            uint32_t driverVersion = 0;
+            uint8_t  pipelineCacheUuid[16] = {};
+        };
+
+        std::vector<uint8_t> Serialize(const DeviceKey& key, const std::vector<uint8_t>& cacheData);
+
+        // Returns false if the file content is invalid, or was saved for another device / driver
+        bool Deserialize(const std::vector<uint8_t>& fileContent, const DeviceKey& key, std::vector<uint8_t>* outCacheData);
+
+        // Load returns an empty vector if the file does not exist or is invalid
+        std::vector<uint8_t> Load(const std::string& filename, const DeviceKey& key);
+        bool Save(const std::string& filename, const DeviceKey& key, const std::vector<uint8_t>& cacheData);
+    }
+}
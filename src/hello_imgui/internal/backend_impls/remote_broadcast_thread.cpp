@@ -0,0 +1,106 @@
+#include "hello_imgui/internal/backend_impls/remote_broadcast_thread.h"
+#include "hello_imgui/internal/clock_seconds.h"
+
+namespace HelloImGui
+{
+    DrawDataSnapshot::DrawDataSnapshot(const ImDrawData* drawData, uint64_t frameId)
+        : mFrameId(frameId)
+    {
+        mDrawData.Valid = drawData->Valid;
+        mDrawData.DisplayPos = drawData->DisplayPos;
+        mDrawData.DisplaySize = drawData->DisplaySize;
+        mDrawData.FramebufferScale = drawData->FramebufferScale;
+        for (int i = 0; i < drawData->CmdListsCount; ++i)
+        {
+            ImDrawList* clone = drawData->CmdLists[i]->CloneOutput();
+            mDrawData.CmdLists.push_back(clone);
+            mDrawData.TotalVtxCount += clone->VtxBuffer.Size;
+            mDrawData.TotalIdxCount += clone->IdxBuffer.Size;
+        }
+        mDrawData.CmdListsCount = mDrawData.CmdLists.Size;
+    }
+
+    DrawDataSnapshot::~DrawDataSnapshot()
+    {
+        for (ImDrawList* drawList : mDrawData.CmdLists)
+            IM_DELETE(drawList);
+    }
+
+
+    RemoteBroadcastThread::~RemoteBroadcastThread()
+    {
+        Stop();
+    }
+
+    void RemoteBroadcastThread::Start(FnPublish fnPublish)
+    {
+        IM_ASSERT(!IsRunning() && "RemoteBroadcastThread::Start: already running");
+        mFnPublish = fnPublish;
+        mShallStop = false;
+        mThread = std::thread([this]() { ThreadLoop(); });
+    }
+
+    void RemoteBroadcastThread::Stop()
+    {
+        if (!IsRunning())
+            return;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mShallStop = true;
+        }
+        mCondition.notify_one();
+        mThread.join();
+        mPending.reset();
+        mPublished.clear();
+    }
+
+    void RemoteBroadcastThread::Submit(DrawDataSnapshotPtr frame)
+    {
+        DrawDataSnapshotPtr skipped;
+        std::vector<DrawDataSnapshotPtr> toRelease;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ++mStats.submittedFrames;
+            if (mPending)
+            {
+                ++mStats.skippedFrames;
+                skipped = std::move(mPending);
+            }
+            mPending = std::move(frame);
+            toRelease.swap(mPublished);
+        }
+        mCondition.notify_one();
+        // toRelease and skipped are destroyed here, on the main thread, outside the lock
+    }
+
+    RemoteBroadcastThread::Stats RemoteBroadcastThread::GetStats()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mStats;
+    }
+
+    void RemoteBroadcastThread::ThreadLoop()
+    {
+        while (true)
+        {
+            DrawDataSnapshotPtr frame;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this]() { return mShallStop || mPending != nullptr; });
+                if (mShallStop)
+                    return;
+                frame = std::move(mPending);
+            }
+
+            double startTime = Internal::ClockSeconds();
+            mFnPublish(*frame);
+            double duration = Internal::ClockSeconds() - startTime;
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            ++mStats.publishedFrames;
+            mStats.lastPublishDuration = duration;
+            // The frame will be destroyed on the main thread
+            mPublished.push_back(std::move(frame));
+        }
+    }
+}
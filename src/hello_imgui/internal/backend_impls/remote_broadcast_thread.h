@@ -0,0 +1,81 @@
+#pragma once
+#include "imgui.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace HelloImGui
+{
+    // DrawDataSnapshot is a deep copy of an ImDrawData (its draw lists are cloned),
+    // which stays valid after ImGui started the next frame.
+    // Since it uses ImGui allocations, it shall be created and destroyed on the main thread.
+    class DrawDataSnapshot
+    {
+    public:
+        DrawDataSnapshot(const ImDrawData* drawData, uint64_t frameId);
+        ~DrawDataSnapshot();
+        DrawDataSnapshot(const DrawDataSnapshot&) = delete;
+        DrawDataSnapshot& operator=(const DrawDataSnapshot&) = delete;
+
+        const ImDrawData* DrawData() const { return &mDrawData; }
+        uint64_t FrameId() const { return mFrameId; }
+
+    private:
+        ImDrawData mDrawData;
+        uint64_t mFrameId;
+    };
+
+    using DrawDataSnapshotPtr = std::shared_ptr<const DrawDataSnapshot>;
+
+
+    // RemoteBroadcastThread publishes the frames of the remote display on a dedicated thread:
+    // the main thread only copies the draw data, and the transport serializes and compresses each frame once,
+    // for all clients, outside of the main thread.
+    //
+    // Only the latest submitted frame is kept: if the transport is slower than the application,
+    // intermediate frames are skipped, and the main thread never waits for the transport.
+    // Published snapshots are handed back to the main thread, which destroys them on its next Submit() or Stop().
+    class RemoteBroadcastThread
+    {
+    public:
+        using FnPublish = std::function<void(const DrawDataSnapshot&)>;
+
+        struct Stats
+        {
+            std::size_t submittedFrames = 0;
+            std::size_t publishedFrames = 0;
+            std::size_t skippedFrames = 0;       // Replaced by a newer frame before being published
+            double lastPublishDuration = 0.;     // in seconds
+        };
+
+        ~RemoteBroadcastThread();
+
+        // fnPublish is called on the broadcast thread
+        void Start(FnPublish fnPublish);
+        void Stop();
+        bool IsRunning() const { return mThread.joinable(); }
+
+        // Main thread: hands over a new frame
+        void Submit(DrawDataSnapshotPtr frame);
+
+        Stats GetStats();
+
+    private:
+        void ThreadLoop();
+
+        FnPublish mFnPublish;
+        std::thread mThread;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        bool mShallStop = false;
+        DrawDataSnapshotPtr mPending;    // The next frame to publish
+        std::vector<DrawDataSnapshotPtr> mPublished;  // The published frames, released on the main thread
+        Stats mStats;
+    };
+}
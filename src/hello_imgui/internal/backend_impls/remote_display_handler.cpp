@@ -6,12 +6,20 @@
 #endif
 
 #include "hello_imgui/internal/backend_impls/remote_display_handler.h"
+#include "hello_imgui/internal/backend_impls/draw_data_delta.h"
+#include "hello_imgui/internal/backend_impls/remote_pacing_controller.h"
+#include "hello_imgui/internal/backend_impls/remote_texture_registry.h"
+#include "hello_imgui/internal/backend_impls/remote_broadcast_thread.h"
 #include "hello_imgui/hello_imgui.h"
 #include "hello_imgui/internal/poor_man_log.h"
 #include "hello_imgui/internal/clock_seconds.h"
 #include "imgui_internal.h"
 
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
 
 #define ENABLE_NETIMGUI_LOG  // Enable or disable logging for NetImgui remoting
@@ -24,6 +32,16 @@
 
 namespace HelloImGui
 {
+#if defined(HELLOIMGUI_WITH_NETIMGUI) || defined(HELLOIMGUI_WITH_IMGUIWS)
+    // The textures transmitted to the remote display (fonts and user textures)
+    RemoteTextureRegistry gRemoteTextureRegistry;
+
+    static uint64_t TextureKey(ImTextureID textureId)
+    {
+        return (uint64_t)(uintptr_t)textureId;
+    }
+#endif
+
 #ifdef HELLOIMGUI_WITH_NETIMGUI
     namespace NetimguiUtils
     {
@@ -121,6 +139,17 @@ namespace HelloImGui
                 _sendFonts_Impl();
             }
 
+            // User textures are sent after the frame, within a byte budget
+            void sendUserTextures()
+            {
+                if (!NetImgui::IsConnected() || !gRemoteTextureRegistry.HasPendingUserTextures())
+                    return;
+                std::size_t budget = (std::size_t)remoteParams().userTexturesBytesPerFrame;
+                for (const auto* texture : gRemoteTextureRegistry.TakeUserTextures(budget))
+                    _sendTexture((ImTextureID)(uintptr_t)texture->key, texture->pixels.data(),
+                                 texture->width, texture->height, texture->format);
+            }
+
             bool isConnected()
             {
                 return NetImgui::IsConnected();
@@ -134,8 +163,12 @@ namespace HelloImGui
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
                 mNetImguiRaii = std::make_unique<NetImGuiRaii>();
                 NetImgui::ConnectToApp(clientName().c_str(), remoteParams().serverHost.c_str(), remoteParams().serverPort);
+                NetImgui::SetCompressionMode(remoteParams().compressDrawData ?
+                    NetImgui::eCompressionMode::kForceEnable : NetImgui::eCompressionMode::kUseServerSetting);
                 std::this_thread::sleep_for(std::chrono::milliseconds(100));
                 ++ mNbConnectionsTentatives;
+                // A new connection: the server has none of our textures
+                gRemoteTextureRegistry.Invalidate();
                 _sendFonts_Impl();
             }
 
@@ -154,20 +187,31 @@ namespace HelloImGui
             void _sendFonts_Impl()
             {
                 const ImFontAtlas* pFonts = ImGui::GetIO().Fonts;
-                if( pFonts->TexPixelsAlpha8) // && (pFonts->TexPixelsAlpha8 != client.mpFontTextureData || client.mFontTextureID != pFonts->TexID ))
+                if( pFonts->TexPixelsAlpha8)
                 {
                     uint8_t* pPixelData(nullptr); int width(0), height(0);
                     ImGui::GetIO().Fonts->GetTexDataAsAlpha8(&pPixelData, &width, &height);
-                    NetImgui::SendDataTexture(pFonts->TexID, pPixelData, static_cast<uint16_t>(width), static_cast<uint16_t>(height), NetImgui::eTexFormat::kTexFmtA8);
+                    _sendTexture(pFonts->TexID, pPixelData, width, height, RemoteTextureRegistry::PixelFormat::Alpha8);
                 }
-                if( pFonts->TexPixelsRGBA32) // && (pFonts->TexPixelsAlpha8 != client.mpFontTextureData || client.mFontTextureID != pFonts->TexID ))
+                if( pFonts->TexPixelsRGBA32)
                 {
                     uint8_t* pPixelData(nullptr); int width(0), height(0);
                     ImGui::GetIO().Fonts->GetTexDataAsRGBA32(&pPixelData, &width, &height);
-                    NetImgui::SendDataTexture(pFonts->TexID, pPixelData, static_cast<uint16_t>(width), static_cast<uint16_t>(height), NetImgui::eTexFormat::kTexFmtRGBA8);
+                    _sendTexture(pFonts->TexID, pPixelData, width, height, RemoteTextureRegistry::PixelFormat::Rgba32);
                 }
             }
 
+            // Sends a texture, unless the server already has the same content.
+            // netImgui only supports whole texture updates: a dirty rect is sent as a full texture.
+            void _sendTexture(ImTextureID texId, const uint8_t* pPixelData, int width, int height, RemoteTextureRegistry::PixelFormat format)
+            {
+                auto update = gRemoteTextureRegistry.Submit(TextureKey(texId), format, width, height, pPixelData);
+                if (update.kind == RemoteTextureRegistry::UpdateKind::None)
+                    return;
+                auto netImguiFormat = (format == RemoteTextureRegistry::PixelFormat::Alpha8) ? NetImgui::eTexFormat::kTexFmtA8 : NetImgui::eTexFormat::kTexFmtRGBA8;
+                NetImgui::SendDataTexture(texId, const_cast<uint8_t*>(pPixelData), static_cast<uint16_t>(width), static_cast<uint16_t>(height), netImguiFormat);
+            }
+
             void LogStatus(const std::string& msg)
             {
                 NetimguiLog("NetImGuiWrapper: %s\n", msg.c_str());
@@ -264,6 +308,9 @@ namespace HelloImGui
                     imgui_ws.incppect_draw_lists(this);
                     imgui_ws.render();
 
+                    // Acknowledges the frames received so far (used by the server for frame pacing)
+                    this.get_int32('hello_imgui.frame_ack[%d]', -1);
+
                     var my_id = this.get_int32('my_id[%d]', -1) || 0;
                     if (my_id != gLastShownId) {
                         console.log('imgui_ws: my_id = ' + my_id);
@@ -613,6 +660,67 @@ namespace HelloImGui
 
         ImGuiWS gImguiWS;
         ImguiWsInputs gImguiWsInputs;
+        DrawDataDelta gDrawDataDelta;
+
+        // Frame pacing
+        // ------------
+        // imgui-ws clients pull the draw data: each client polls the server (incppect requests),
+        // and receives the last draw data that was set. A poll from a client acknowledges the frame
+        // that was current at its previous poll (it was received, since the client polls again).
+        // Polls are handled on the imgui-ws network thread.
+        RemotePacingController gPacingController;
+        std::atomic<uint64_t> gLastProducedFrameId{0};
+        std::mutex gFrameIdAtPreviousPollMutex;
+        std::map<int, uint64_t> gFrameIdAtPreviousPoll;
+
+        std::string_view OnClientPoll_AcknowledgeFrames(int clientId)
+        {
+            double now = HelloImGui::Internal::ClockSeconds();
+            uint64_t currentFrameId = gLastProducedFrameId.load();
+            {
+                std::lock_guard<std::mutex> lock(gFrameIdAtPreviousPollMutex);
+                auto it = gFrameIdAtPreviousPoll.find(clientId);
+                if (it != gFrameIdAtPreviousPoll.end())
+                    gPacingController.OnFrameAcknowledged(clientId, it->second, now);
+                gFrameIdAtPreviousPoll[clientId] = currentFrameId;
+            }
+            // The returned view shall stay valid until the network thread copies it
+            thread_local int32_t frameId32;
+            frameId32 = (int32_t)currentFrameId;
+            return std::string_view((const char*)&frameId32, sizeof(frameId32));
+        }
+
+        // Broadcast
+        // ---------
+        // Each frame is serialized and compressed once by imgui-ws (setDrawData), and shared by all clients.
+        // With RemoteParams::wsBroadcastThread, this is done on a dedicated thread, from a copy of the draw data.
+        // Each client then pulls the latest frame at its own pace (see frame pacing above):
+        // slow clients skip frames without holding back the fast ones.
+        RemoteBroadcastThread gBroadcastThread;
+        std::mutex gImguiWsPublishMutex;  // gImguiWS is modified by the main thread (textures) and by gBroadcastThread (frames)
+
+        void PublishDrawData(const ImDrawData* drawData, uint64_t frameId)
+        {
+            {
+                std::lock_guard<std::mutex> lock(gImguiWsPublishMutex);
+                gImguiWS.setDrawData(drawData);
+            }
+            gLastProducedFrameId = frameId;
+        }
+
+        // Returns the clients to which the next frame should be sent
+        // (empty if all clients are still busy, or not due for a new frame).
+        // Since imgui-ws shares one draw data between all clients, the frame is published as soon as one
+        // client is ready: the pacing follows the aggregate of the clients.
+        std::vector<int> ClientsReadyForNewFrame()
+        {
+            std::vector<int> r;
+            double now = HelloImGui::Internal::ClockSeconds();
+            for (int clientId : gPacingController.ClientIds())
+                if (gPacingController.ShallSendToClient(clientId, now))
+                    r.push_back(clientId);
+            return r;
+        }
 
         void Create()
         {
@@ -627,40 +735,75 @@ namespace HelloImGui
                 indexHtml = ReplaceInString(indexHtml, "_WS_CANVAS_HEIGHT_", std::to_string(HelloImGui::GetRunnerParams()->appWindowParams.windowGeometry.size[1]));
                 gImguiWS.addResource("/index.html", indexHtml);
             }
+
+            RemotePacingController::Params pacingParams;
+            pacingParams.minFps = (double)remoteParams.pacingMinFps;
+            pacingParams.maxFps = (double)remoteParams.pacingMaxFps;
+            pacingParams.maxFramesInFlight = remoteParams.pacingMaxFramesInFlight;
+            gPacingController.SetParams(pacingParams);
+            gImguiWS.addVar("hello_imgui.frame_ack[%d]", [](const auto& idxs) {
+                int clientId = idxs.empty() ? -1 : idxs[0];
+                return OnClientPoll_AcknowledgeFrames(clientId);
+            });
+
+            if (remoteParams.wsBroadcastThread)
+                gBroadcastThread.Start([](const DrawDataSnapshot& frame) {
+                    PublishDrawData(frame.DrawData(), frame.FrameId());
+                });
         }
 
-        static uint32_t ToUint32(void * ptr)
+        void Shutdown()
         {
-            return (uint32_t) (uintptr_t) ptr;
+            gBroadcastThread.Stop();
         }
-        static uint32_t ToUint32(unsigned int x)
+
+        // Sets a texture on the server (which serves it to the clients), unless it has the same content.
+        // imgui-ws only supports whole texture updates: a dirty rect is sent as a full texture.
+        void SetTexture(uint64_t textureKey, RemoteTextureRegistry::PixelFormat format, int width, int height, const unsigned char* pixels)
         {
-            return (uint32_t) x;
+            auto update = gRemoteTextureRegistry.Submit(textureKey, format, width, height, pixels);
+            if (update.kind == RemoteTextureRegistry::UpdateKind::None)
+                return;
+            auto wsFormat = (format == RemoteTextureRegistry::PixelFormat::Alpha8) ? ImGuiWS::Texture::Type::Alpha8 : ImGuiWS::Texture::Type::RGBA32;
+            std::lock_guard<std::mutex> lock(gImguiWsPublishMutex);
+            gImguiWS.setTexture((uint32_t)textureKey, wsFormat, width, height, (const char *) pixels);
         }
 
         void SendFonts()
         {
             unsigned char * pixels;
             int width, height;
+            uint64_t fontTextureKey = TextureKey(ImGui::GetIO().Fonts->TexID);
+            // The texture IDs may have changed: the next frame shall be transmitted
+            gDrawDataDelta.Invalidate();
+
             // Try with Alpha8
             ImGui::GetIO().Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
             if (pixels != nullptr)
             {
-                auto texID = ToUint32(ImGui::GetIO().Fonts->TexID);
-                gImguiWS.setTexture(texID, ImGuiWS::Texture::Type::Alpha8, width, height, (const char *) pixels);
+                SetTexture(fontTextureKey, RemoteTextureRegistry::PixelFormat::Alpha8, width, height, pixels);
                 return;
             }
             // Try with RGBA32
             ImGui::GetIO().Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
             if (pixels != nullptr)
             {
-                auto texID = ToUint32(ImGui::GetIO().Fonts->TexID);
-                gImguiWS.setTexture(texID, ImGuiWS::Texture::Type::RGBA32, width, height, (const char *) pixels);
+                SetTexture(fontTextureKey, RemoteTextureRegistry::PixelFormat::Rgba32, width, height, pixels);
                 return;
             }
             fprintf(stderr, "SendFonts: Could not get font texture data\n");
         }
 
+        // User textures are set after the draw data, within a byte budget
+        void SendUserTextures()
+        {
+            if (!gRemoteTextureRegistry.HasPendingUserTextures())
+                return;
+            std::size_t budget = (std::size_t)HelloImGui::GetRunnerParams()->remoteParams.userTexturesBytesPerFrame;
+            for (const auto* texture : gRemoteTextureRegistry.TakeUserTextures(budget))
+                SetTexture(texture->key, texture->format, texture->width, texture->height, texture->pixels.data());
+        }
+
         void HeartBeat_PreImGuiNewFrame()
         {
             ScreenSize appSize = HelloImGui::GetRunnerParams()->appWindowParams.windowGeometry.size;
@@ -671,6 +814,17 @@ namespace HelloImGui
             // websocket event handling
             auto events = gImguiWS.takeEvents();
             for (auto & event : events) {
+                if (event.type == ImGuiWS::Event::Connected)
+                {
+                    gDrawDataDelta.Invalidate();
+                    gPacingController.OnClientConnected(event.clientId, HelloImGui::Internal::ClockSeconds());
+                }
+                if (event.type == ImGuiWS::Event::Disconnected)
+                {
+                    gPacingController.OnClientDisconnected(event.clientId);
+                    std::lock_guard<std::mutex> lock(gFrameIdAtPreviousPollMutex);
+                    gFrameIdAtPreviousPoll.erase(event.clientId);
+                }
                 gImguiWsInputs.handle(std::move(event));
             }
             gImguiWsInputs.update();
@@ -678,8 +832,50 @@ namespace HelloImGui
 
         void Heartbeat_PostImGuiRender()
         {
+            const auto& remoteParams = HelloImGui::GetRunnerParams()->remoteParams;
+            ImDrawData* drawData = ImGui::GetDrawData();
+
+            // All clients share the same draw data: a new frame is produced if at least one client is ready for it.
+            // A client that is not ready will get the latest frame at its next poll:
+            // stale frames are replaced, never queued.
+            std::vector<int> readyClients;
+            if (remoteParams.adaptiveFramePacing)
+            {
+                readyClients = ClientsReadyForNewFrame();
+                if (readyClients.empty())
+                    return;
+            }
+
+            if (remoteParams.skipIdenticalFrames)
+            {
+                // imgui-ws keeps serving the last draw data to its clients:
+                // there is no need to serialize an identical frame again
+                auto delta = gDrawDataDelta.Compare(drawData);
+                if (delta.isIdentical)
+                    return;
+                gDrawDataDelta.MarkSent();
+            }
+
+            uint64_t frameId = gPacingController.OnFrameProduced();
+            double now = HelloImGui::Internal::ClockSeconds();
+            for (int clientId : readyClients)
+                gPacingController.OnFrameSentToClient(clientId, frameId, now);
+
             // store ImDrawData for asynchronous dispatching to WS clients
-            gImguiWS.setDrawData(ImGui::GetDrawData());
+            if (gBroadcastThread.IsRunning())
+                gBroadcastThread.Submit(std::make_shared<DrawDataSnapshot>(drawData, frameId));
+            else
+                PublishDrawData(drawData, frameId);
+
+            SendUserTextures();
+        }
+
+        float RecommendedFps()
+        {
+            const auto& remoteParams = HelloImGui::GetRunnerParams()->remoteParams;
+            if (!remoteParams.adaptiveFramePacing)
+                return remoteParams.fpsWithoutPacing;
+            return (float)gPacingController.ProduceFps();
         }
 
 
@@ -740,6 +936,10 @@ void RemoteDisplayHandler::Create()
 
 void RemoteDisplayHandler::Shutdown()
 {
+    #ifdef HELLOIMGUI_WITH_IMGUIWS
+    if (ShouldRemoteDisplay())
+        ImguiWsUtils::Shutdown();
+    #endif
     if (!IsConnectedToRemoteDisplay())
         return;
     #ifdef HELLOIMGUI_WITH_NETIMGUI
@@ -752,7 +952,8 @@ void RemoteDisplayHandler::Heartbeat_PreImGuiNewFrame()
     if (!ShouldRemoteDisplay())
         return;
     #ifdef HELLOIMGUI_WITH_NETIMGUI
-    NetimguiUtils::gNetImGuiWrapper->HeartBeat_PreImGuiNewFrame();
+    if (NetimguiUtils::gNetImGuiWrapper)
+        NetimguiUtils::gNetImGuiWrapper->HeartBeat_PreImGuiNewFrame();
     #endif
     #ifdef HELLOIMGUI_WITH_IMGUIWS
     ImguiWsUtils::HeartBeat_PreImGuiNewFrame();
@@ -763,6 +964,10 @@ void RemoteDisplayHandler::Heartbeat_PostImGuiRender()
 {
     if (!ShouldRemoteDisplay())
         return;
+    #ifdef HELLOIMGUI_WITH_NETIMGUI
+    if (NetimguiUtils::gNetImGuiWrapper)
+        NetimguiUtils::gNetImGuiWrapper->sendUserTextures();
+    #endif
     #ifdef HELLOIMGUI_WITH_IMGUIWS
     ImguiWsUtils::Heartbeat_PostImGuiRender();
     #endif
@@ -793,7 +998,9 @@ void RemoteDisplayHandler::SendFonts()
     if (ShouldRemoteDisplay())
     {
         #ifdef HELLOIMGUI_WITH_NETIMGUI
-        NetimguiUtils::gNetImGuiWrapper = std::make_unique<NetimguiUtils::NetImGuiWrapper>();
+        // The connection is kept: only the textures whose content changed are sent again
+        if (NetimguiUtils::gNetImGuiWrapper == nullptr)
+            NetimguiUtils::gNetImGuiWrapper = std::make_unique<NetimguiUtils::NetImGuiWrapper>();
         NetimguiUtils::gNetImGuiWrapper->sendFonts();
         #endif
         #ifdef HELLOIMGUI_WITH_IMGUIWS
@@ -802,6 +1009,49 @@ void RemoteDisplayHandler::SendFonts()
     }
 }
 
+void RemoteDisplayHandler::SetUserTexture(ImTextureID textureId, int width, int height, const unsigned char* image_data_rgba)
+{
+    if (!ShouldRemoteDisplay())
+        return;
+    #if defined(HELLOIMGUI_WITH_NETIMGUI) || defined(HELLOIMGUI_WITH_IMGUIWS)
+    gRemoteTextureRegistry.SetUserTexture(TextureKey(textureId), RemoteTextureRegistry::PixelFormat::Rgba32, width, height, image_data_rgba);
+    #else
+    (void)textureId; (void)width; (void)height; (void)image_data_rgba;
+    #endif
+}
+
+void RemoteDisplayHandler::RemoveUserTexture(ImTextureID textureId)
+{
+    if (!ShouldRemoteDisplay())
+        return;
+    #if defined(HELLOIMGUI_WITH_NETIMGUI) || defined(HELLOIMGUI_WITH_IMGUIWS)
+    gRemoteTextureRegistry.RemoveUserTexture(TextureKey(textureId));
+    #else
+    (void)textureId;
+    #endif
+}
+
+float RemoteDisplayHandler::RecommendedFps()
+{
+    #ifdef HELLOIMGUI_WITH_IMGUIWS
+    if (ShouldRemoteDisplay())
+        return ImguiWsUtils::RecommendedFps();
+    #endif
+    // netImgui: the server requests the frames at its own rate, and does not report acknowledgements
+    return HelloImGui::GetRunnerParams()->remoteParams.fpsWithoutPacing;
+}
+
+bool RemoteDisplayHandler::IsFramePacingActive()
+{
+    if (!ShouldRemoteDisplay())
+        return false;
+    #ifdef HELLOIMGUI_WITH_IMGUIWS
+    return HelloImGui::GetRunnerParams()->remoteParams.adaptiveFramePacing;
+    #else
+    return false;
+    #endif
+}
+
 bool RemoteDisplayHandler::CanQuitApp()
 {
     if (!ShouldRemoteDisplay())
@@ -1,5 +1,6 @@
 #pragma once
 #include "hello_imgui/screen_bounds.h"
+#include "imgui.h"
 
 namespace HelloImGui
 {
@@ -27,6 +28,12 @@ namespace HelloImGui
         // (do nothing if no remote display is configured/compiled)
         void SendFonts();
 
+        // Mirrors a user texture (ImageFromAsset, ImageFromMemory) on the remote display:
+        // it is streamed lazily, after the draw data, within RemoteParams::userTexturesBytesPerFrame
+        // (do nothing if no remote display is configured/compiled)
+        void SetUserTexture(ImTextureID textureId, int width, int height, const unsigned char* image_data_rgba);
+        void RemoveUserTexture(ImTextureID textureId);
+
         // Returns true if the application should display on a remote server
         // (return false if no remote display is configured/compiled)
         bool ShouldRemoteDisplay();
@@ -38,6 +45,14 @@ namespace HelloImGui
         // Can the user quit the application?
         bool CanQuitApp();
 
+        // The frame rate at which the application should render when displaying remotely
+        // (adapted to the clients acknowledgements if RemoteParams::adaptiveFramePacing is active)
+        float RecommendedFps();
+
+        // Returns true if the remote display paces the frames
+        // (in which case the application may idle between frames, at RecommendedFps())
+        bool IsFramePacingActive();
+
     private:
         // Returns true if the application is connected to a remote server
         // (return false if no remote display is configured/compiled)
@@ -0,0 +1,167 @@
+#include "hello_imgui/internal/backend_impls/remote_pacing_controller.h"
+
+#include <algorithm>
+
+namespace HelloImGui
+{
+    void RemotePacingController::SetParams(const Params& params)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mParams = params;
+    }
+
+    RemotePacingController::Params RemotePacingController::GetParams()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mParams;
+    }
+
+    void RemotePacingController::OnClientConnected(int clientId, double now)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ClientState client;
+        client.stats.clientId = clientId;
+        // Start at the max rate, the acknowledgements will slow us down if needed
+        client.stats.targetFps = mParams.maxFps;
+        client.connectionTime = now;
+        client.lastAckTime = now;
+        mClients[clientId] = client;
+    }
+
+    void RemotePacingController::OnClientDisconnected(int clientId)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mClients.erase(clientId);
+    }
+
+    std::vector<int> RemotePacingController::ClientIds()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::vector<int> r;
+        for (const auto& kv: mClients)
+            r.push_back(kv.first);
+        return r;
+    }
+
+    bool RemotePacingController::HasClients()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return !mClients.empty();
+    }
+
+    bool RemotePacingController::ShallSendToClient(int clientId, double now)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mClients.find(clientId);
+        if (it == mClients.end())
+            return false;
+        ClientState& client = it->second;
+
+        bool isDue = (client.lastSentTime < 0.) || (now - client.lastSentTime >= 1. / client.stats.targetFps);
+
+        bool doesNotAcknowledge = (client.stats.ackedFrames == 0) && (now - client.connectionTime > mParams.ackTimeoutSeconds);
+        if (doesNotAcknowledge)
+        {
+            client.inFlight.clear();
+            client.stats.framesInFlight = 0;
+            return isDue;
+        }
+
+        if ((int)client.inFlight.size() >= mParams.maxFramesInFlight)
+        {
+            ++client.stats.droppedFrames;
+            return false;
+        }
+        return isDue;
+    }
+
+    uint64_t RemotePacingController::OnFrameProduced()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return ++mLastFrameId;
+    }
+
+    void RemotePacingController::OnFrameSentToClient(int clientId, uint64_t frameId, double now)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mClients.find(clientId);
+        if (it == mClients.end())
+            return;
+        ClientState& client = it->second;
+        client.inFlight.push_back({frameId, now});
+        client.lastSentTime = now;
+        ++client.stats.sentFrames;
+        client.stats.framesInFlight = (int)client.inFlight.size();
+    }
+
+    void RemotePacingController::OnFrameAcknowledged(int clientId, uint64_t frameId, double now)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mClients.find(clientId);
+        if (it == mClients.end())
+            return;
+        ClientState& client = it->second;
+        if (frameId <= client.lastAckedFrameId)
+            return;
+        client.lastAckedFrameId = frameId;
+
+        int nbAcked = 0;
+        double newestSentTime = -1.;
+        while (!client.inFlight.empty() && client.inFlight.front().frameId <= frameId)
+        {
+            newestSentTime = client.inFlight.front().sentTime;
+            client.inFlight.pop_front();
+            ++nbAcked;
+        }
+        client.stats.framesInFlight = (int)client.inFlight.size();
+        if (nbAcked == 0)
+            return;
+
+        bool isFirstSample = (client.stats.ackedFrames == 0);
+        client.stats.ackedFrames += (std::size_t)nbAcked;
+
+        double roundTrip = now - newestSentTime;
+        client.stats.roundTripSeconds = Smooth(client.stats.roundTripSeconds, roundTrip, mParams.smoothing, isFirstSample);
+
+        double ackInterval = now - client.lastAckTime;
+        client.lastAckTime = now;
+        if (ackInterval > 0.)
+        {
+            double ackFps = (double)nbAcked / ackInterval;
+            client.stats.ackFps = Smooth(client.stats.ackFps, ackFps, mParams.smoothing, isFirstSample);
+            client.stats.targetFps = ClampFps(client.stats.ackFps * mParams.probeFactor);
+        }
+    }
+
+    double RemotePacingController::ProduceFps()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mClients.empty())
+            return mParams.maxFps;
+        double r = 0.;
+        for (const auto& kv: mClients)
+            r = std::max(r, kv.second.stats.targetFps);
+        return ClampFps(r);
+    }
+
+    std::vector<RemotePacingController::ClientStats> RemotePacingController::Stats()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::vector<ClientStats> r;
+        for (const auto& kv: mClients)
+            r.push_back(kv.second.stats);
+        return r;
+    }
+
+    double RemotePacingController::Smooth(double previous, double sample, double smoothing, bool isFirstSample)
+    {
+        if (isFirstSample)
+            return sample;
+        return previous + smoothing * (sample - previous);
+    }
+
+    double RemotePacingController::ClampFps(double fps) const
+    {
+        return std::clamp(fps, mParams.minFps, mParams.maxFps);
+    }
+}
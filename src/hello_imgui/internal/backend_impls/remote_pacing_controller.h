@@ -0,0 +1,100 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace HelloImGui
+{
+    // RemotePacingController adapts the rate at which frames are produced for remote display clients.
+    //
+    // The transport reports, for each client, the frames it sent and the frames the client acknowledged.
+    // From those, the controller estimates each client round-trip latency and acknowledgement rate,
+    // derives a target frame rate per client, and refuses to send a new frame to a client that
+    // already has too many frames in flight: stale frames are dropped instead of being queued.
+    //
+    // The clock is provided by the caller (in seconds), so that the controller can be tested with a simulated clock.
+    // All methods are thread safe (acknowledgements may come from the network thread of the transport).
+    class RemotePacingController
+    {
+    public:
+        struct Params
+        {
+            double minFps = 5.;
+            double maxFps = 60.;
+            // A client with this many frames not yet acknowledged will not receive a new frame
+            int maxFramesInFlight = 2;
+            // The target fps of a client is its measured acknowledgement rate multiplied by this factor
+            // (> 1, so that the rate can increase again when the link gets faster)
+            double probeFactor = 1.5;
+            // Smoothing factor of the exponential moving averages (0: no update, 1: no smoothing)
+            double smoothing = 0.2;
+            // A client that did not acknowledge any frame during this delay after its connection
+            // is considered as not supporting acknowledgements: it is then only paced at maxFps
+            double ackTimeoutSeconds = 2.;
+        };
+
+        struct ClientStats
+        {
+            int clientId = -1;
+            double roundTripSeconds = 0.;  // Smoothed delay between sending a frame and its acknowledgement
+            double ackFps = 0.;            // Smoothed rate of acknowledged frames
+            double targetFps = 0.;
+            int framesInFlight = 0;
+            std::size_t sentFrames = 0;
+            std::size_t ackedFrames = 0;
+            std::size_t droppedFrames = 0;  // Frames not sent because the client had too many frames in flight
+        };
+
+        void SetParams(const Params& params);
+        Params GetParams();
+
+        void OnClientConnected(int clientId, double now);
+        void OnClientDisconnected(int clientId);
+        std::vector<int> ClientIds();
+        bool HasClients();
+
+        // Returns true if the client is ready to receive a new frame:
+        //  - false if it has too many frames in flight (the frame is then counted as dropped for this client)
+        //  - false if it received a frame too recently for its target fps
+        bool ShallSendToClient(int clientId, double now);
+
+        // Returns a new frame id
+        uint64_t OnFrameProduced();
+        void OnFrameSentToClient(int clientId, uint64_t frameId, double now);
+        // Acknowledges all frames up to frameId (included)
+        void OnFrameAcknowledged(int clientId, uint64_t frameId, double now);
+
+        // The rate at which the application should produce frames:
+        // the fastest client target fps (or maxFps if there are no clients)
+        double ProduceFps();
+
+        std::vector<ClientStats> Stats();
+
+    private:
+        struct SentFrame
+        {
+            uint64_t frameId;
+            double sentTime;
+        };
+        struct ClientState
+        {
+            ClientStats stats;
+            std::deque<SentFrame> inFlight;
+            uint64_t lastAckedFrameId = 0;
+            double connectionTime = 0.;
+            double lastAckTime = -1.;
+            double lastSentTime = -1.;
+        };
+
+        static double Smooth(double previous, double sample, double smoothing, bool isFirstSample);
+        double ClampFps(double fps) const;
+
+        std::mutex mMutex;
+        Params mParams;
+        std::map<int, ClientState> mClients;
+        uint64_t mLastFrameId = 0;
+    };
+}
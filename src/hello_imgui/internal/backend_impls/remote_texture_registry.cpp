@@ -0,0 +1,155 @@
+#include "hello_imgui/internal/backend_impls/remote_texture_registry.h"
+#include "hello_imgui/internal/backend_impls/draw_data_delta.h"
+
+#include <algorithm>
+
+namespace HelloImGui
+{
+    RemoteTextureRegistry::TextureSignature RemoteTextureRegistry::ComputeSignature(
+        PixelFormat format, int width, int height, const unsigned char* pixels)
+    {
+        TextureSignature r;
+        r.format = format;
+        r.width = width;
+        r.height = height;
+
+        int nbTilesX = (width + TileSize - 1) / TileSize;
+        int nbTilesY = (height + TileSize - 1) / TileSize;
+        r.tileHashes.resize((std::size_t)nbTilesX * (std::size_t)nbTilesY);
+
+        std::size_t bpp = (std::size_t)BytesPerPixel(format);
+        std::size_t stride = (std::size_t)width * bpp;
+        for (int tileY = 0; tileY < nbTilesY; ++tileY)
+        {
+            int yEnd = std::min(height, (tileY + 1) * TileSize);
+            for (int tileX = 0; tileX < nbTilesX; ++tileX)
+            {
+                int x0 = tileX * TileSize;
+                int x1 = std::min(width, x0 + TileSize);
+                std::size_t rowBytes = (std::size_t)(x1 - x0) * bpp;
+                uint64_t h = 0;
+                for (int y = tileY * TileSize; y < yEnd; ++y)
+                    h = HashBytes64(pixels + (std::size_t)y * stride + (std::size_t)x0 * bpp, rowBytes, h);
+                r.tileHashes[(std::size_t)tileY * (std::size_t)nbTilesX + (std::size_t)tileX] = h;
+            }
+        }
+        return r;
+    }
+
+    RemoteTextureRegistry::TextureUpdate RemoteTextureRegistry::Submit(
+        uint64_t key, PixelFormat format, int width, int height, const unsigned char* pixels)
+    {
+        TextureUpdate r;
+        if (pixels == nullptr || width <= 0 || height <= 0)
+            return r;
+
+        ++mStats.nbSubmitted;
+        std::size_t bpp = (std::size_t)BytesPerPixel(format);
+        std::size_t textureBytes = (std::size_t)width * (std::size_t)height * bpp;
+        TextureSignature signature = ComputeSignature(format, width, height, pixels);
+
+        auto it = mSent.find(key);
+        bool isComparable = (it != mSent.end())
+            && (it->second.format == format) && (it->second.width == width) && (it->second.height == height);
+        if (!isComparable)
+        {
+            r.kind = UpdateKind::Full;
+            r.dirtyRect = {0, 0, width, height};
+            r.bytes = textureBytes;
+            ++mStats.nbFullUpdates;
+        }
+        else
+        {
+            int nbTilesX = (width + TileSize - 1) / TileSize;
+            int minTileX = nbTilesX, minTileY = -1, maxTileX = -1, maxTileY = -1;
+            const auto& sentHashes = it->second.tileHashes;
+            for (std::size_t i = 0; i < signature.tileHashes.size(); ++i)
+            {
+                if (signature.tileHashes[i] == sentHashes[i])
+                    continue;
+                int tileX = (int)(i % (std::size_t)nbTilesX), tileY = (int)(i / (std::size_t)nbTilesX);
+                if (minTileY < 0)
+                    minTileY = tileY;
+                maxTileY = tileY;
+                minTileX = std::min(minTileX, tileX);
+                maxTileX = std::max(maxTileX, tileX);
+            }
+
+            if (minTileY < 0)
+            {
+                ++mStats.nbUnchanged;
+                mStats.bytesSaved += textureBytes;
+                return r;
+            }
+
+            r.kind = UpdateKind::DirtyRect;
+            r.dirtyRect.x = minTileX * TileSize;
+            r.dirtyRect.y = minTileY * TileSize;
+            r.dirtyRect.w = std::min(width, (maxTileX + 1) * TileSize) - r.dirtyRect.x;
+            r.dirtyRect.h = std::min(height, (maxTileY + 1) * TileSize) - r.dirtyRect.y;
+            r.bytes = (std::size_t)r.dirtyRect.w * (std::size_t)r.dirtyRect.h * bpp;
+            ++mStats.nbDirtyRectUpdates;
+            mStats.bytesSaved += textureBytes - r.bytes;
+        }
+
+        mStats.bytesToSend += r.bytes;
+        mSent[key] = std::move(signature);
+        return r;
+    }
+
+    void RemoteTextureRegistry::Invalidate()
+    {
+        mSent.clear();
+        mUserTexturesQueue.clear();
+        for (const auto& kv: mUserTextures)
+            mUserTexturesQueue.push_back(kv.first);
+    }
+
+    void RemoteTextureRegistry::SetUserTexture(
+        uint64_t key, PixelFormat format, int width, int height, const unsigned char* pixels)
+    {
+        if (pixels == nullptr || width <= 0 || height <= 0)
+            return;
+        std::size_t nbBytes = (std::size_t)width * (std::size_t)height * (std::size_t)BytesPerPixel(format);
+
+        UserTexture& texture = mUserTextures[key];
+        texture.key = key;
+        texture.format = format;
+        texture.width = width;
+        texture.height = height;
+        texture.pixels.assign(pixels, pixels + nbBytes);
+
+        if (std::find(mUserTexturesQueue.begin(), mUserTexturesQueue.end(), key) == mUserTexturesQueue.end())
+            mUserTexturesQueue.push_back(key);
+    }
+
+    void RemoteTextureRegistry::RemoveUserTexture(uint64_t key)
+    {
+        mUserTextures.erase(key);
+        mUserTexturesQueue.erase(std::remove(mUserTexturesQueue.begin(), mUserTexturesQueue.end(), key), mUserTexturesQueue.end());
+        mSent.erase(key);
+    }
+
+    std::vector<const RemoteTextureRegistry::UserTexture*> RemoteTextureRegistry::TakeUserTextures(std::size_t maxBytes)
+    {
+        std::vector<const UserTexture*> r;
+        std::size_t nbBytes = 0;
+        while (!mUserTexturesQueue.empty())
+        {
+            const UserTexture& texture = mUserTextures.at(mUserTexturesQueue.front());
+            if (!r.empty() && nbBytes + texture.pixels.size() > maxBytes)
+                break;
+            nbBytes += texture.pixels.size();
+            r.push_back(&texture);
+            mUserTexturesQueue.pop_front();
+        }
+        return r;
+    }
+
+    RemoteTextureRegistry::Stats RemoteTextureRegistry::GetStats() const
+    {
+        Stats r = mStats;
+        r.nbPendingUserTextures = mUserTexturesQueue.size();
+        return r;
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace HelloImGui
+{
+    // RemoteTextureRegistry remembers the content of the textures that were transmitted to a remote display,
+    // as content hashes computed on a grid of tiles.
+    //
+    // - A texture whose content did not change is never transmitted again (e.g. the font atlas after a DPI change
+    //   that did not modify it).
+    // - When a texture changed, the registry reports the bounding rectangle of the changed tiles,
+    //   so that a transport that supports partial updates may transmit only this rectangle.
+    // - User textures (ImageFromAsset, ImageFromMemory) are kept in a CPU copy, and streamed lazily by the transport,
+    //   within a byte budget, after the draw data was transmitted. They are streamed again after Invalidate().
+    //
+    // Textures are identified by a key (the texture id as seen by the remote display).
+    // This class is not thread safe: use it from the main thread.
+    class RemoteTextureRegistry
+    {
+    public:
+        enum class PixelFormat { Alpha8, Rgba32 };
+
+        enum class UpdateKind
+        {
+            None,       // The content is identical to what was transmitted: nothing to send
+            Full,       // New texture, or size/format change: the whole texture shall be sent
+            DirtyRect   // Same size and format: only dirtyRect changed
+        };
+
+        struct Rect { int x = 0, y = 0, w = 0, h = 0; };
+
+        struct TextureUpdate
+        {
+            UpdateKind kind = UpdateKind::None;
+            Rect dirtyRect;          // The whole texture if kind == Full
+            std::size_t bytes = 0;   // Size of the pixels inside dirtyRect
+        };
+
+        struct UserTexture
+        {
+            uint64_t key = 0;
+            PixelFormat format = PixelFormat::Rgba32;
+            int width = 0, height = 0;
+            std::vector<unsigned char> pixels;
+        };
+
+        struct Stats
+        {
+            std::size_t nbSubmitted = 0;
+            std::size_t nbUnchanged = 0;
+            std::size_t nbFullUpdates = 0;
+            std::size_t nbDirtyRectUpdates = 0;
+            std::size_t bytesToSend = 0;   // Bytes inside the reported updates
+            std::size_t bytesSaved = 0;    // Bytes of the submitted textures that did not need to be sent
+            std::size_t nbPendingUserTextures = 0;
+        };
+
+        // Compares the texture with the version transmitted under the same key, and records it as transmitted:
+        // the caller shall send the texture (or its dirty rect) if the returned kind is not None.
+        TextureUpdate Submit(uint64_t key, PixelFormat format, int width, int height, const unsigned char* pixels);
+
+        // Forgets everything that was transmitted (e.g. after a reconnection, the remote display has no texture):
+        // all user textures are queued again
+        void Invalidate();
+
+        // Stores a user texture (the pixels are copied), and queues it for lazy streaming.
+        // A texture stored under the same key is replaced.
+        void SetUserTexture(uint64_t key, PixelFormat format, int width, int height, const unsigned char* pixels);
+        void RemoveUserTexture(uint64_t key);
+
+        // Takes the queued user textures, in order, until maxBytes is reached (at least one texture is returned
+        // if the queue is not empty, so that a texture bigger than the budget is still sent).
+        // The returned pointers are valid until the next call to SetUserTexture or RemoveUserTexture.
+        std::vector<const UserTexture*> TakeUserTextures(std::size_t maxBytes);
+
+        bool HasPendingUserTextures() const { return !mUserTexturesQueue.empty(); }
+
+        Stats GetStats() const;
+
+        // Tile size used for the content hashes (in pixels)
+        static constexpr int TileSize = 32;
+
+    private:
+        struct TextureSignature
+        {
+            PixelFormat format = PixelFormat::Rgba32;
+            int width = 0, height = 0;
+            std::vector<uint64_t> tileHashes;  // row major, ceil(width / TileSize) * ceil(height / TileSize)
+        };
+
+        static TextureSignature ComputeSignature(PixelFormat format, int width, int height, const unsigned char* pixels);
+        static int BytesPerPixel(PixelFormat format) { return format == PixelFormat::Alpha8 ? 1 : 4; }
+
+        std::unordered_map<uint64_t, TextureSignature> mSent;
+        std::unordered_map<uint64_t, UserTexture> mUserTextures;
+        std::deque<uint64_t> mUserTexturesQueue;
+        Stats mStats;
+    };
+}
@@ -98,6 +98,8 @@ namespace HelloImGui
         VoidFunction                  Impl_Shutdown_3D          = [] { HIMG_ERROR("Empty function"); };
         std::function<ImageBuffer()>  Impl_ScreenshotRgb_3D     = [] { return ImageBuffer{}; };
         std::function<ScreenSize()>   Impl_GetFrameBufferSize;   //= [] { return ScreenSize{0, 0}; };
+        // Optional: same as Impl_ScreenshotRgb_3D, but reuses the given buffer and work buffer (used by FrameRecorder)
+        std::function<bool(ImageBuffer&, std::vector<uint8_t>&)> Impl_ScreenshotRgbInto_3D;
 
         // Callbacks for font texture creation/destruction during runtime (unsupported by DirectX11&12)
         VoidFunction                  Impl_DestroyFontTexture  = [] { HIMG_ERROR("Empty function"); };
@@ -96,7 +96,8 @@ namespace HelloImGui
         }
 
         auto& gDx11Globals = GetDx11Globals();
-        gDx11Globals.pSwapChain->Present(1, 0); // Present with vsync
+        UINT syncInterval = HelloImGui::GetRunnerParams()->rendererBackendOptions.framePacing.vsync ? 1 : 0;
+        gDx11Globals.pSwapChain->Present(syncInterval, 0); // Present with or without vsync
     }
 
     RenderingCallbacksPtr PrepareBackendCallbacksCommonDx11()
@@ -249,8 +249,8 @@ namespace HelloImGui
     {
         auto & gDxGlobals = GetDx12Globals();
 
-        gDxGlobals.pSwapChain->Present(1, 0); // Present with vsync
-        //g_pSwapChain->Present(0, 0); // Present without vsync
+        UINT syncInterval = HelloImGui::GetRunnerParams()->rendererBackendOptions.framePacing.vsync ? 1 : 0;
+        gDxGlobals.pSwapChain->Present(syncInterval, 0); // Present with or without vsync
 
         UINT64 fenceValue = gDxGlobals.fenceLastSignaledValue + 1;
         gDxGlobals.pd3dCommandQueue->Signal(gDxGlobals.fence, fenceValue);
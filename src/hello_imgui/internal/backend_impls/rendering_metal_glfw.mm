@@ -53,6 +53,8 @@ namespace HelloImGui
             else
                 gMetalGlobals.caMetalLayer.pixelFormat = MTLPixelFormatBGRA8Unorm;
 
+            gMetalGlobals.caMetalLayer.displaySyncEnabled = rendererBackendOptions.framePacing.vsync ? YES : NO;
+
             nswin.contentView.layer = gMetalGlobals.caMetalLayer;
             nswin.contentView.wantsLayer = YES;
 
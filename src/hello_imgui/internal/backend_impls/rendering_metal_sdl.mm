@@ -31,7 +31,10 @@ namespace HelloImGui
         {
             gSdlMetalGlobals.sdlWindow = sdlWindow;
             gMetalGlobals.mtlDevice = MTLCreateSystemDefaultDevice();
-            gSdlMetalGlobals.sdlRenderer = SDL_CreateRenderer(sdlWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+            Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+            if (rendererBackendOptions.framePacing.vsync)
+                rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+            gSdlMetalGlobals.sdlRenderer = SDL_CreateRenderer(sdlWindow, -1, rendererFlags);
             if (gSdlMetalGlobals.sdlRenderer == nullptr)
             {
                 bool Error_SdlCreateRenderer_For_Metal = false;
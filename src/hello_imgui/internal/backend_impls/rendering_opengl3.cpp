@@ -22,6 +22,7 @@ namespace HelloImGui
         callbacks->Impl_ScreenshotRgb_3D = []() {
             return OpenglScreenshotRgb();
         };
+        callbacks->Impl_ScreenshotRgbInto_3D = OpenglScreenshotRgbInto;
 
         callbacks->Impl_Frame_3D_ClearColor = [](ImVec4 clear_color) {
             auto& io = ImGui::GetIO();
@@ -1,5 +1,6 @@
 #ifdef HELLOIMGUI_HAS_VULKAN
 #include "rendering_vulkan.h"
+#include "vulkan_textures.h"
 #include "hello_imgui/hello_imgui.h"
 
 
@@ -48,6 +49,8 @@ namespace HelloImGui
                                                            gVkGlobals.MinImageCount);
                     gVkGlobals.ImGuiMainWindowData.FrameIndex = 0;
                     gVkGlobals.SwapChainRebuild = false;
+                    // The frames were recreated, after waiting for the device
+                    VulkanTextures::OnDeviceIdle();
                 }
             }
 
@@ -86,6 +89,8 @@ namespace HelloImGui
             wd->ClearValue.color.float32[3] = clear_color.w;
             if (!main_is_minimized)
                 HelloImGui::VulkanSetup::FrameRender(wd, main_draw_data);
+            else
+                VulkanTextures::OnMinimizedFrame(); // No frame fence will complete the textures releases
         };
 
 
@@ -94,6 +99,7 @@ namespace HelloImGui
             auto & gVkGlobals = HelloImGui::GetVulkanGlobals();
             VkResult err = vkDeviceWaitIdle(gVkGlobals.Device);
             HelloImGui::VulkanSetup::check_vk_result(err);
+            VulkanTextures::Shutdown();
             ImGui_ImplVulkan_Shutdown();
             HelloImGui::VulkanSetup::CleanupVulkanWindow();
             HelloImGui::VulkanSetup::CleanupVulkan();
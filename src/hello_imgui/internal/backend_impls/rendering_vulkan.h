@@ -48,7 +48,8 @@ namespace HelloImGui
         bool                     SwapChainRebuild = false;
 
         // The maximum number of image sampler descriptor and descriptor set is set at startup
-        // Yoy may need to increase these values if you use a lot of images in your application.
+        // Yoy may need to increase these values if you use a lot of images in your application
+        // (or set RendererBackendOptions.vulkanGrowableDescriptorPools).
         uint32_t                 PoolCreateInfo_PoolSizes = 100;
         uint32_t                 PoolCreateInfo_MaxSets = 100;
     };
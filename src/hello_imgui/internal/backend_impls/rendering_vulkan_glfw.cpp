@@ -12,6 +12,7 @@
 
 #include "hello_imgui/hello_imgui_logger.h"
 #include "hello_imgui/hello_imgui.h"
+#include "hello_imgui/internal/startup_tracer.h"
 
 #if IMGUI_VERSION_NUM  >= 19030
 // The API changed with this commit
@@ -73,6 +74,9 @@ namespace HelloImGui
             init_info.Allocator = gVkGlobals.Allocator;
             init_info.CheckVkResultFn = HelloImGui::VulkanSetup::check_vk_result;
 
+            // ImGui_ImplVulkan_Init creates the pipelines, which is faster when the pipeline cache was loaded
+            // (see RendererBackendOptions.vulkanPersistentPipelineCache)
+            StartupTracer::ScopedEvent traceEvent("ImGui_ImplVulkan_Init (pipelines)");
 #ifdef IMGUI_VULKAN_RENDER_PASS_IN_STRUCTURE
             init_info.RenderPass = wd->RenderPass;
             ImGui_ImplVulkan_Init(&init_info);
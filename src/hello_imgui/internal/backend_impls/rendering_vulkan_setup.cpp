@@ -1,5 +1,6 @@
 #ifdef HELLOIMGUI_HAS_VULKAN
 #include "rendering_vulkan.h"
+#include "vulkan_textures.h"
 
 #include "imgui_impl_vulkan.h"
 
@@ -11,7 +12,13 @@
 
 #include <vulkan/vulkan.h>
 
+#include "hello_imgui/hello_imgui.h"
 #include "hello_imgui/hello_imgui_logger.h"
+#include "hello_imgui/internal/backend_impls/pipeline_cache_file.h"
+#include "hello_imgui/internal/startup_tracer.h"
+
+#include <cstring>
+#include <vector>
 
 
 #ifdef _DEBUG
@@ -78,6 +85,85 @@ VkPhysicalDevice SetupVulkan_SelectPhysicalDevice()
     return VK_NULL_HANDLE;
 }
 
+// Persistent pipeline cache (see RendererBackendOptions.vulkanPersistentPipelineCache)
+static PipelineCacheFile::DeviceKey gPipelineCacheDeviceKey;
+static std::vector<uint8_t> gPipelineCacheLoadedData;
+
+static std::string PipelineCacheFilename()
+{
+    std::string iniLocation = IniSettingsLocation(*HelloImGui::GetRunnerParams());
+    if (iniLocation.size() > 4 && iniLocation.substr(iniLocation.size() - 4) == ".ini")
+        iniLocation = iniLocation.substr(0, iniLocation.size() - 4);
+    return iniLocation + "_vulkan_pipeline_cache.bin";
+}
+
+static void SetupVulkan_PipelineCache()
+{
+    auto& gVkGlobals = HelloImGui::GetVulkanGlobals();
+    StartupTracer::ScopedEvent traceEvent("Vulkan: load pipeline cache");
+
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(gVkGlobals.PhysicalDevice, &deviceProperties);
+    gPipelineCacheDeviceKey.vendorId = deviceProperties.vendorID;
+    gPipelineCacheDeviceKey.deviceId = deviceProperties.deviceID;
+    gPipelineCacheDeviceKey.driverVersion = deviceProperties.driverVersion;
+    memcpy(gPipelineCacheDeviceKey.pipelineCacheUuid, deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+
+    gPipelineCacheLoadedData.clear();
+    if (HelloImGui::GetRunnerParams()->rendererBackendOptions.vulkanPersistentPipelineCache)
+    {
+        gPipelineCacheLoadedData = PipelineCacheFile::Load(PipelineCacheFilename(), gPipelineCacheDeviceKey);
+        StartupTracer::AddInstantEvent(
+            gPipelineCacheLoadedData.empty() ? "Vulkan pipeline cache: miss" : "Vulkan pipeline cache: hit");
+    }
+
+    VkPipelineCacheCreateInfo cache_info = {};
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.initialDataSize = gPipelineCacheLoadedData.size();
+    cache_info.pInitialData = gPipelineCacheLoadedData.empty() ? nullptr : gPipelineCacheLoadedData.data();
+    VkResult err = vkCreatePipelineCache(gVkGlobals.Device, &cache_info, gVkGlobals.Allocator, &gVkGlobals.PipelineCache);
+    if (err != VK_SUCCESS && cache_info.initialDataSize > 0)
+    {
+        // The driver may still reject the data: start with an empty cache
+        cache_info.initialDataSize = 0;
+        cache_info.pInitialData = nullptr;
+        gPipelineCacheLoadedData.clear();
+        err = vkCreatePipelineCache(gVkGlobals.Device, &cache_info, gVkGlobals.Allocator, &gVkGlobals.PipelineCache);
+    }
+    check_vk_result(err);
+}
+
+static void CleanupVulkan_PipelineCache()
+{
+    auto& gVkGlobals = HelloImGui::GetVulkanGlobals();
+    if (gVkGlobals.PipelineCache == VK_NULL_HANDLE)
+        return;
+
+    if (HelloImGui::GetRunnerParams()->rendererBackendOptions.vulkanPersistentPipelineCache)
+    {
+        size_t dataSize = 0;
+        std::vector<uint8_t> data;
+        if (vkGetPipelineCacheData(gVkGlobals.Device, gVkGlobals.PipelineCache, &dataSize, nullptr) == VK_SUCCESS)
+        {
+            data.resize(dataSize);
+            if (vkGetPipelineCacheData(gVkGlobals.Device, gVkGlobals.PipelineCache, &dataSize, data.data()) != VK_SUCCESS)
+                data.clear();
+            data.resize(dataSize);
+        }
+        // Only rewrite the file when the driver added pipelines
+        if (!data.empty() && data != gPipelineCacheLoadedData)
+        {
+            std::string filename = PipelineCacheFilename();
+            if (!PipelineCacheFile::Save(filename, gPipelineCacheDeviceKey, data))
+                fprintf(stderr, "HelloImGui: could not save the Vulkan pipeline cache to %s\n", filename.c_str());
+        }
+    }
+
+    vkDestroyPipelineCache(gVkGlobals.Device, gVkGlobals.PipelineCache, gVkGlobals.Allocator);
+    gVkGlobals.PipelineCache = VK_NULL_HANDLE;
+    gPipelineCacheLoadedData.clear();
+}
+
 void SetupVulkan(ImVector<const char*> instance_extensions)
 {
     auto& gVkGlobals = HelloImGui::GetVulkanGlobals();
@@ -188,6 +274,8 @@ void SetupVulkan(ImVector<const char*> instance_extensions)
         vkGetDeviceQueue(gVkGlobals.Device, gVkGlobals.QueueFamily, 0, &gVkGlobals.Queue);
     }
 
+    SetupVulkan_PipelineCache();
+
     // Create Descriptor Pool
     // The example only requires a single combined image sampler descriptor for the font image and only uses one descriptor set (for that)
     // If you wish to load e.g. additional textures you may need to alter pools sizes.
@@ -229,14 +317,24 @@ void SetupVulkanWindow(ImGui_ImplVulkanH_Window* wd, VkSurfaceKHR surface, int w
     const VkColorSpaceKHR requestSurfaceColorSpace = VK_COLORSPACE_SRGB_NONLINEAR_KHR;
     wd->SurfaceFormat = ImGui_ImplVulkanH_SelectSurfaceFormat(gVkGlobals.PhysicalDevice, wd->Surface, requestSurfaceImageFormat, (size_t)IM_ARRAYSIZE(requestSurfaceImageFormat), requestSurfaceColorSpace);
 
-    // Select Present Mode
+    // Select Present Mode (see RendererBackendOptions.framePacing)
+    // (ImGui_ImplVulkanH_SelectPresentMode returns the first available mode, and falls back to FIFO, which is always available)
 #ifdef IMGUI_UNLIMITED_FRAME_RATE
-    VkPresentModeKHR present_modes[] = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_FIFO_KHR };
+    std::vector<VkPresentModeKHR> present_modes = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_FIFO_KHR };
 #else
-    VkPresentModeKHR present_modes[] = { VK_PRESENT_MODE_FIFO_KHR };
+    std::vector<VkPresentModeKHR> present_modes;
+    const auto& framePacing = HelloImGui::GetRunnerParams()->rendererBackendOptions.framePacing;
+    if (framePacing.vulkanPresentMode == VulkanPresentMode::Mailbox)
+        present_modes = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_FIFO_KHR };
+    else if (framePacing.vulkanPresentMode == VulkanPresentMode::Immediate || !framePacing.vsync)
+        present_modes = { VK_PRESENT_MODE_IMMEDIATE_KHR, VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_FIFO_KHR };
+    else
+        present_modes = { VK_PRESENT_MODE_FIFO_KHR };
 #endif
-    wd->PresentMode = ImGui_ImplVulkanH_SelectPresentMode(gVkGlobals.PhysicalDevice, wd->Surface, &present_modes[0], IM_ARRAYSIZE(present_modes));
-    //printf("[vulkan] Selected PresentMode = %d\n", wd->PresentMode);
+    wd->PresentMode = ImGui_ImplVulkanH_SelectPresentMode(gVkGlobals.PhysicalDevice, wd->Surface, present_modes.data(), (int)present_modes.size());
+    if (wd->PresentMode != present_modes[0])
+        HelloImGui::Log(HelloImGui::LogLevel::Info, "Vulkan: the requested present mode (%d) is not available, using %d",
+                        (int)present_modes[0], (int)wd->PresentMode);
 
     // Create SwapChain, RenderPass, Framebuffer, etc.
     IM_ASSERT(gVkGlobals.MinImageCount >= 2);
@@ -252,6 +350,7 @@ void CleanupVulkan()
     auto& gVkGlobals = HelloImGui::GetVulkanGlobals();
 
     vkDestroyDescriptorPool(gVkGlobals.Device, gVkGlobals.DescriptorPool, gVkGlobals.Allocator);
+    CleanupVulkan_PipelineCache();
 
 #ifdef IMGUI_VULKAN_DEBUG_REPORT
     // Remove the debug report callback
@@ -295,6 +394,9 @@ void FrameRender(ImGui_ImplVulkanH_Window* wd, ImDrawData* draw_data)
 
         err = vkResetFences(gVkGlobals.Device, 1, &fd->Fence);
         check_vk_result(err);
+
+        // The previous submission of this frame is completed: the released textures can be destroyed
+        VulkanTextures::OnFrameFenceWaited(wd->FrameIndex);
     }
     {
         err = vkResetCommandPool(gVkGlobals.Device, fd->CommandPool, 0);
@@ -305,6 +407,7 @@ void FrameRender(ImGui_ImplVulkanH_Window* wd, ImDrawData* draw_data)
         err = vkBeginCommandBuffer(fd->CommandBuffer, &info);
         check_vk_result(err);
     }
+
     {
         VkRenderPassBeginInfo info = {};
         info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -336,6 +439,7 @@ void FrameRender(ImGui_ImplVulkanH_Window* wd, ImDrawData* draw_data)
 
         err = vkEndCommandBuffer(fd->CommandBuffer);
         check_vk_result(err);
+        VulkanTextures::OnFrameSubmit(wd->FrameIndex);
         err = vkQueueSubmit(gVkGlobals.Queue, 1, &info, fd->Fence);
         check_vk_result(err);
     }
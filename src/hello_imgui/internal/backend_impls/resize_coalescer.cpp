@@ -0,0 +1,42 @@
+#include "hello_imgui/internal/backend_impls/resize_coalescer.h"
+
+#include <algorithm>
+
+
+namespace HelloImGui
+{
+    void ResizeCoalescer::OnResizeEvent(double now)
+    {
+        mLastResizeEventTime = now;
+        mPendingRedraw = true;
+        ++mStats.nbResizeEvents;
+    }
+
+    bool ResizeCoalescer::IsResizing(double now) const
+    {
+        return mLastResizeEventTime >= 0. && (now - mLastResizeEventTime) < mParams.stableDelaySeconds;
+    }
+
+    bool ResizeCoalescer::ShallRedrawPreviousFrame(double now)
+    {
+        if (!mPendingRedraw)
+            return false;
+        double minInterval = (mParams.maxRedrawFps > 0.) ? 1. / mParams.maxRedrawFps : 0.;
+        if (mLastRedrawTime >= 0. && (now - mLastRedrawTime) < minInterval)
+            return false;
+        mPendingRedraw = false;
+        mLastRedrawTime = now;
+        ++mStats.nbRedraws;
+        return true;
+    }
+
+    double ResizeCoalescer::SecondsUntilNextEvent(double now) const
+    {
+        double r = mLastResizeEventTime + mParams.stableDelaySeconds - now;
+        if (mPendingRedraw && mLastRedrawTime >= 0. && mParams.maxRedrawFps > 0.)
+            r = std::min(r, mLastRedrawTime + 1. / mParams.maxRedrawFps - now);
+        else if (mPendingRedraw)
+            r = 0.;
+        return std::max(r, 0.);
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+
+namespace HelloImGui
+{
+    // ResizeCoalescer decides what to do with the resize events of the application window
+    // (see AppWindowParams.resizeCoalescing).
+    //
+    // The resize events are not handled when they arrive: they are only queued (coalesced into one pending redraw).
+    // While the user drags the window border, the previous frame is presented again (stretched to the new size),
+    // at most at maxRedrawFps. The full frame (i.e. the relayout of the GUI) is done once the size was stable
+    // during stableDelaySeconds.
+    //
+    // The clock is provided by the caller (in seconds), so that the coalescer can be tested with a simulated clock.
+    class ResizeCoalescer
+    {
+    public:
+        struct Params
+        {
+            double maxRedrawFps = 60.;
+            double stableDelaySeconds = 0.1;
+        };
+
+        struct Stats
+        {
+            std::size_t nbResizeEvents = 0;
+            std::size_t nbRedraws = 0;        // Presentations of the previous frame during resizes
+        };
+
+        void SetParams(const Params& params) { mParams = params; }
+        const Params& GetParams() const { return mParams; }
+
+        // Called from the platform backend resize callback
+        void OnResizeEvent(double now);
+
+        // True while the window is being resized: the full frames shall be postponed
+        bool IsResizing(double now) const;
+
+        // True if the previous frame shall be presented again now (there is a pending resize,
+        // and the last redraw is old enough). The redraw is then considered as done.
+        bool ShallRedrawPreviousFrame(double now);
+
+        // Delay until the next redraw is allowed, or until the size is considered stable
+        // (the main loop may wait for events during this delay)
+        double SecondsUntilNextEvent(double now) const;
+
+        const Stats& GetStats() const { return mStats; }
+
+    private:
+        Params mParams;
+        Stats mStats;
+        double mLastResizeEventTime = -1.;
+        double mLastRedrawTime = -1.;
+        bool mPendingRedraw = false;
+    };
+}
@@ -51,10 +51,23 @@ void ChooseNullBackendsIfUsingRemote(RunnerParams* runnerParams)
 }
 
 
+void ChooseNullBackendsIfHeadlessTests(RunnerParams* runnerParams)
+{
+    #ifdef HELLOIMGUI_WITH_TEST_ENGINE
+    if (runnerParams->useImGuiTestEngine && runnerParams->testEngineParams.headless)
+    {
+        runnerParams->platformBackendType = PlatformBackendType::Null;
+        runnerParams->rendererBackendType = RendererBackendType::Null;
+    }
+    #endif
+}
+
+
 std::unique_ptr<AbstractRunner> FactorRunner(RunnerParams& params)
 {
     ChooseBackendTypesIfSelectedAsFirstAvailable(&params);
     ChooseNullBackendsIfUsingRemote(&params);
+    ChooseNullBackendsIfHeadlessTests(&params);
     if (params.platformBackendType == PlatformBackendType::Glfw)
     {
         #ifdef HELLOIMGUI_USE_GLFW3
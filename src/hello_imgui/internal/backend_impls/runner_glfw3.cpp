@@ -93,7 +93,7 @@ namespace HelloImGui
             GLFWwindow* backup_current_context = glfwGetCurrentContext();
         #endif
         ImGui::UpdatePlatformWindows();
-        ImGui::RenderPlatformWindowsDefault();
+        RenderAdditionalPlatformWindows();
         #ifdef HELLOIMGUI_HAS_OPENGL
             glfwMakeContextCurrent(backup_current_context);
         #endif
@@ -176,9 +176,11 @@ namespace HelloImGui
     void RunnerGlfw3::Impl_CreateGlContext()
     {
         glfwMakeContextCurrent((GLFWwindow *) mWindow); // OpenGl!
-        glfwSwapInterval(1);  // Enable vsync (openGL only, not vulkan)
+        glfwSwapInterval(params.rendererBackendOptions.framePacing.vsync ? 1 : 0);  // vsync (openGL only, not vulkan)
     }
 
+    void RunnerGlfw3::Impl_SetSwapInterval_CurrentGlContext(int interval) { glfwSwapInterval(interval); }
+
     void RunnerGlfw3::Impl_Select_Gl_Version()
     {
         auto openGlOptions = gOpenGlSetupGlfw.OpenGlOptionsWithUserSettings();
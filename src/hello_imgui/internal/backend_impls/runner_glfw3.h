@@ -37,6 +37,7 @@ class RunnerGlfw3 : public AbstractRunner
             std::string Impl_GlslVersion() const override;
             void Impl_CreateGlContext() override;
             void Impl_InitGlLoader() override;
+            void Impl_SetSwapInterval_CurrentGlContext(int interval) override;
         #endif
 };
 
@@ -162,7 +162,7 @@ namespace HelloImGui
             SDL_GLContext backup_current_context = SDL_GL_GetCurrentContext();
         #endif
         ImGui::UpdatePlatformWindows();
-        ImGui::RenderPlatformWindowsDefault();
+        RenderAdditionalPlatformWindows();
         #ifdef HELLOIMGUI_HAS_OPENGL
             SDL_GL_MakeCurrent(backup_current_window, backup_current_context);
         #endif
@@ -326,10 +326,11 @@ namespace HelloImGui
         IM_ASSERT(mGlContext != nullptr);
 
         SDL_GL_MakeCurrent((SDL_Window *)mWindow, mGlContext); // KK No
-        SDL_GL_SetSwapInterval(1);  // Enable vsync
+        SDL_GL_SetSwapInterval(params.rendererBackendOptions.framePacing.vsync ? 1 : 0);  // vsync
         params.backendPointers.sdlGlContext = mGlContext;
     }
     void RunnerSdl2::Impl_InitGlLoader() { gOpenGlSetupSdl.InitGlLoader(); }
+    void RunnerSdl2::Impl_SetSwapInterval_CurrentGlContext(int interval) { SDL_GL_SetSwapInterval(interval); }
     void RunnerSdl2::Impl_Select_Gl_Version()
     {
         auto openGlOptions = gOpenGlSetupSdl.OpenGlOptionsWithUserSettings();
@@ -0,0 +1,121 @@
+#include "hello_imgui/internal/backend_impls/viewports_renderer.h"
+#include "hello_imgui/internal/clock_seconds.h"
+
+#include <algorithm>
+
+namespace HelloImGui
+{
+    ViewportsRenderer::ViewportState& ViewportsRenderer::StateFor(ImGuiViewport* viewport)
+    {
+        for (auto& state: mViewports)
+        {
+            if (state.viewportId != viewport->ID)
+                continue;
+            if (state.platformHandle != viewport->PlatformHandle)
+            {
+                // The viewport was given a new platform window: start again
+                state = ViewportState();
+                state.viewportId = viewport->ID;
+                state.platformHandle = viewport->PlatformHandle;
+                state.stats.viewportId = viewport->ID;
+            }
+            state.isAlive = true;
+            return state;
+        }
+        ViewportState state;
+        state.viewportId = viewport->ID;
+        state.platformHandle = viewport->PlatformHandle;
+        state.stats.viewportId = viewport->ID;
+        state.isAlive = true;
+        mViewports.push_back(std::move(state));
+        return mViewports.back();
+    }
+
+    void ViewportsRenderer::RenderPlatformWindows(
+        bool skipUnchangedFrames, const std::function<void(ImGuiViewport*)>& fnOnFirstRender)
+    {
+        ImGuiPlatformIO& platformIo = ImGui::GetPlatformIO();
+        for (auto& state: mViewports)
+            state.isAlive = false;
+
+        // Same as ImGui::RenderPlatformWindowsDefault(): first render all viewports, then present them
+        // (the main viewport, at index 0, is handled by the runner)
+        for (int i = 1; i < platformIo.Viewports.Size; ++i)
+        {
+            ImGuiViewport* viewport = platformIo.Viewports[i];
+            ViewportState& state = StateFor(viewport);
+            state.shallRender = false;
+            if (viewport->Flags & ImGuiViewportFlags_IsMinimized)
+                continue;
+
+            if (skipUnchangedFrames)
+            {
+                if (state.drawDataDelta.Compare(viewport->DrawData).isIdentical)
+                {
+                    state.stats.nbSkippedPresents += 1;
+                    continue;
+                }
+            }
+            else
+            {
+                // The draw data is not hashed; the reference frame is forgotten,
+                // since the viewport will be presented with other content
+                state.drawDataDelta.Invalidate();
+            }
+
+            state.shallRender = true;
+            double startTime = Internal::ClockSeconds();
+            if (platformIo.Platform_RenderWindow)
+                platformIo.Platform_RenderWindow(viewport, nullptr);
+            if (state.stats.nbRenderedFrames == 0 && fnOnFirstRender)
+                fnOnFirstRender(viewport);
+            if (platformIo.Renderer_RenderWindow)
+                platformIo.Renderer_RenderWindow(viewport, nullptr);
+            state.renderSeconds = Internal::ClockSeconds() - startTime;
+            if (skipUnchangedFrames)
+                state.drawDataDelta.MarkSent();
+        }
+
+        for (int i = 1; i < platformIo.Viewports.Size; ++i)
+        {
+            ImGuiViewport* viewport = platformIo.Viewports[i];
+            ViewportState& state = StateFor(viewport);
+            if (!state.shallRender)
+                continue;
+
+            double startTime = Internal::ClockSeconds();
+            if (platformIo.Platform_SwapBuffers)
+                platformIo.Platform_SwapBuffers(viewport, nullptr);
+            if (platformIo.Renderer_SwapBuffers)
+                platformIo.Renderer_SwapBuffers(viewport, nullptr);
+            state.renderSeconds += Internal::ClockSeconds() - startTime;
+
+            auto& stats = state.stats;
+            stats.nbRenderedFrames += 1;
+            stats.renderMs_Last = (float)(state.renderSeconds * 1000.);
+            if (stats.nbRenderedFrames == 1)
+                stats.renderMs_Mean = stats.renderMs_Last;
+            else
+                stats.renderMs_Mean = 0.9f * stats.renderMs_Mean + 0.1f * stats.renderMs_Last;
+        }
+
+        // Forget the destroyed viewports
+        mViewports.erase(
+            std::remove_if(mViewports.begin(), mViewports.end(), [](const ViewportState& s) { return !s.isAlive; }),
+            mViewports.end());
+    }
+
+    void ViewportsRenderer::Invalidate()
+    {
+        for (auto& state: mViewports)
+            state.drawDataDelta.Invalidate();
+    }
+
+    std::vector<ViewportRenderStats> ViewportsRenderer::GetStats() const
+    {
+        std::vector<ViewportRenderStats> r;
+        for (const auto& state: mViewports)
+            r.push_back(state.stats);
+        return r;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "hello_imgui/internal/backend_impls/draw_data_delta.h"
+#include "hello_imgui/renderer_backend_options.h"
+#include "imgui.h"
+
+#include <functional>
+#include <vector>
+
+namespace HelloImGui
+{
+    // ViewportsRenderer renders and presents the secondary viewports (i.e. the additional native windows),
+    // in place of ImGui::RenderPlatformWindowsDefault():
+    // - when skipUnchangedFrames is true, a viewport whose draw data did not change since it was last presented
+    //   is neither rendered nor presented (its previous image stays on screen)
+    // - the duration of the render + present, and the number of skipped presents are measured per viewport
+    class ViewportsRenderer
+    {
+    public:
+        // fnOnFirstRender is called the first time a platform window is rendered, after Platform_RenderWindow
+        // (i.e. when its rendering context is current, with OpenGL). It may be empty.
+        void RenderPlatformWindows(bool skipUnchangedFrames, const std::function<void(ImGuiViewport*)>& fnOnFirstRender);
+
+        // Forces all viewports to be rendered at the next frame
+        void Invalidate();
+
+        std::vector<ViewportRenderStats> GetStats() const;
+
+    private:
+        struct ViewportState
+        {
+            ImGuiID viewportId = 0;
+            void* platformHandle = nullptr;  // a viewport may be given a new platform window
+            DrawDataDelta drawDataDelta;
+            ViewportRenderStats stats;
+            bool isAlive = false;            // false if the viewport was destroyed
+            bool shallRender = false;        // during the current frame
+            double renderSeconds = 0.;       // during the current frame
+        };
+
+        ViewportState& StateFor(ImGuiViewport* viewport);
+
+        std::vector<ViewportState> mViewports;
+    };
+}
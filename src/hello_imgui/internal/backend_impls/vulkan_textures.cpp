@@ -0,0 +1,258 @@
+#ifdef HELLOIMGUI_HAS_VULKAN
+#include "hello_imgui/internal/backend_impls/vulkan_textures.h"
+#include "hello_imgui/internal/backend_impls/descriptor_slot_allocator.h"
+#include "hello_imgui/internal/backend_impls/rendering_vulkan.h"
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    namespace VulkanTextures
+    {
+        // The descriptor pools of the textures hold 64 sets, then 128, 256, ... up to 4096
+        constexpr int kFirstDescriptorPoolCapacity = 64;
+        constexpr int kMaxDescriptorPoolCapacity = 4096;
+
+        struct DeferredDestruction
+        {
+            uint64_t Serial;
+            std::function<void()> DestroyFn;
+        };
+
+        struct State
+        {
+            std::deque<DeferredDestruction> DeferredDestructions;
+
+            uint64_t SubmittedSerial = 0;
+            uint64_t CompletedSerial = 0;
+            std::vector<uint64_t> FrameSerials;  // Serial of the last submission of each frame (by frame index)
+
+            // Descriptor sets of the textures
+            VkDescriptorSetLayout DescriptorSetLayout = VK_NULL_HANDLE;
+            VkSampler SharedSampler = VK_NULL_HANDLE;
+            DescriptorSlotAllocator DescriptorSlots { kFirstDescriptorPoolCapacity, kMaxDescriptorPoolCapacity };
+            std::vector<VkDescriptorPool> DescriptorPools;
+            std::vector<std::vector<VkDescriptorSet>> DescriptorSets;  // By pool, then by index in pool
+            std::unordered_map<VkDescriptorSet, DescriptorSlotAllocator::Slot> DescriptorSetSlots;
+        };
+
+        State& GetState()
+        {
+            static State state;
+            return state;
+        }
+
+
+        // ---------------------------- Deferred destructions ----------------------------
+
+        void _CollectCompleted()
+        {
+            auto& state = GetState();
+            std::deque<DeferredDestruction> stillInUse;
+            for (auto& destruction: state.DeferredDestructions)
+            {
+                if (destruction.Serial <= state.CompletedSerial)
+                    destruction.DestroyFn();
+                else
+                    stillInUse.push_back(std::move(destruction));
+            }
+            state.DeferredDestructions.swap(stillInUse);
+        }
+
+        void DestroyImageDeferred(VkImage image, VkDeviceMemory memory, std::function<void()> destroyFn)
+        {
+            auto& state = GetState();
+            // The image may be used by the draw commands of the frame in progress, i.e. by the next submission
+            // of the main window, and by the additional platform windows (multi-viewports) which are submitted after it.
+            // It can be destroyed once the following submission of the main window is completed.
+            uint64_t serial = state.SubmittedSerial + 2;
+            state.DeferredDestructions.push_back({serial, [image, memory, destroyFn]() {
+                VulkanGlobals& vkGlobals = GetVulkanGlobals();
+                if (destroyFn)
+                    destroyFn();
+                vkDestroyImage(vkGlobals.Device, image, vkGlobals.Allocator);
+                vkFreeMemory(vkGlobals.Device, memory, vkGlobals.Allocator);
+            }});
+        }
+
+
+        // ---------------------------- Descriptor sets ----------------------------
+
+        void _CreateDescriptorSetLayoutAndSampler()
+        {
+            VulkanGlobals& vkGlobals = GetVulkanGlobals();
+            auto& state = GetState();
+            VkResult err;
+
+            // Same layout as ImGui_ImplVulkan_CreateDescriptorSetLayout() (in imgui_impl_vulkan.cpp):
+            // identically defined layouts are compatible, so that imgui's pipeline layout can bind our sets
+            {
+                VkDescriptorSetLayoutBinding binding[1] = {};
+                binding[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+                binding[0].descriptorCount = 1;
+                binding[0].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+                VkDescriptorSetLayoutCreateInfo info = {};
+                info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+                info.bindingCount = 1;
+                info.pBindings = binding;
+                err = vkCreateDescriptorSetLayout(vkGlobals.Device, &info, vkGlobals.Allocator, &state.DescriptorSetLayout);
+                VulkanSetup::check_vk_result(err);
+            }
+
+            // All the textures use the same sampler (the number of samplers is limited, e.g. 4000 on some drivers)
+            {
+                VkSamplerCreateInfo sampler_info{};
+                sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+                sampler_info.magFilter = VK_FILTER_LINEAR;
+                sampler_info.minFilter = VK_FILTER_LINEAR;
+                sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+                sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+                sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+                sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+                sampler_info.minLod = -1000;
+                sampler_info.maxLod = 1000;
+                sampler_info.maxAnisotropy = 1.0f;
+                err = vkCreateSampler(vkGlobals.Device, &sampler_info, vkGlobals.Allocator, &state.SharedSampler);
+                VulkanSetup::check_vk_result(err);
+            }
+        }
+
+        void _CreateDescriptorPool(int capacity)
+        {
+            VulkanGlobals& vkGlobals = GetVulkanGlobals();
+            auto& state = GetState();
+
+            // No VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT: the sets are recycled, never freed one by one
+            VkDescriptorPoolSize pool_size = { VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, (uint32_t)capacity };
+            VkDescriptorPoolCreateInfo pool_info = {};
+            pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+            pool_info.maxSets = (uint32_t)capacity;
+            pool_info.poolSizeCount = 1;
+            pool_info.pPoolSizes = &pool_size;
+            VkDescriptorPool pool;
+            VkResult err = vkCreateDescriptorPool(vkGlobals.Device, &pool_info, vkGlobals.Allocator, &pool);
+            VulkanSetup::check_vk_result(err);
+            state.DescriptorPools.push_back(pool);
+            state.DescriptorSets.emplace_back((size_t)capacity, VK_NULL_HANDLE);
+        }
+
+        VkDescriptorSet AllocateTextureDescriptorSet(VkImageView imageView)
+        {
+            VulkanGlobals& vkGlobals = GetVulkanGlobals();
+            auto& state = GetState();
+            VkResult err;
+
+            if (state.DescriptorSetLayout == VK_NULL_HANDLE)
+                _CreateDescriptorSetLayoutAndSampler();
+
+            DescriptorSlotAllocator::Slot slot = state.DescriptorSlots.Allocate();
+            while ((int)state.DescriptorPools.size() < state.DescriptorSlots.NbPools())
+                _CreateDescriptorPool(state.DescriptorSlots.PoolCapacity((int)state.DescriptorPools.size()));
+
+            VkDescriptorSet& descriptorSet = state.DescriptorSets[slot.PoolIndex][slot.IndexInPool];
+            if (!slot.Recycled)
+            {
+                VkDescriptorSetAllocateInfo alloc_info = {};
+                alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+                alloc_info.descriptorPool = state.DescriptorPools[slot.PoolIndex];
+                alloc_info.descriptorSetCount = 1;
+                alloc_info.pSetLayouts = &state.DescriptorSetLayout;
+                err = vkAllocateDescriptorSets(vkGlobals.Device, &alloc_info, &descriptorSet);
+                VulkanSetup::check_vk_result(err);
+            }
+            state.DescriptorSetSlots[descriptorSet] = slot;
+
+            VkDescriptorImageInfo desc_image[1] = {};
+            desc_image[0].sampler = state.SharedSampler;
+            desc_image[0].imageView = imageView;
+            desc_image[0].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            VkWriteDescriptorSet write_desc[1] = {};
+            write_desc[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write_desc[0].dstSet = descriptorSet;
+            write_desc[0].descriptorCount = 1;
+            write_desc[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            write_desc[0].pImageInfo = desc_image;
+            vkUpdateDescriptorSets(vkGlobals.Device, 1, write_desc, 0, nullptr);
+
+            return descriptorSet;
+        }
+
+        void FreeTextureDescriptorSet(VkDescriptorSet descriptorSet)
+        {
+            auto& state = GetState();
+            auto it = state.DescriptorSetSlots.find(descriptorSet);
+            IM_ASSERT(it != state.DescriptorSetSlots.end());
+            state.DescriptorSlots.Free(it->second);
+            state.DescriptorSetSlots.erase(it);
+        }
+
+
+        // ---------------------------- GPU progress ----------------------------
+
+        void OnFrameFenceWaited(uint32_t frameIndex)
+        {
+            auto& state = GetState();
+            if (frameIndex < state.FrameSerials.size())
+                state.CompletedSerial = std::max(state.CompletedSerial, state.FrameSerials[frameIndex]);
+            _CollectCompleted();
+        }
+
+        void OnFrameSubmit(uint32_t frameIndex)
+        {
+            auto& state = GetState();
+            uint64_t serial = ++state.SubmittedSerial;
+            if (frameIndex >= state.FrameSerials.size())
+                state.FrameSerials.resize(frameIndex + 1, 0);
+            state.FrameSerials[frameIndex] = serial;
+        }
+
+        void OnMinimizedFrame()
+        {
+            VulkanGlobals& vkGlobals = GetVulkanGlobals();
+            auto& state = GetState();
+            // The minimized frame counts as a submission (with no work for the GPU),
+            // so that the releases of this frame wait for the next one
+            uint64_t serial = ++state.SubmittedSerial;
+            if (state.DeferredDestructions.empty() || state.DeferredDestructions.front().Serial > serial)
+                return;
+            // All the work submitted before this frame (e.g. by the platform windows) will be completed
+            VkResult err = vkDeviceWaitIdle(vkGlobals.Device);
+            VulkanSetup::check_vk_result(err);
+            state.CompletedSerial = serial;
+            _CollectCompleted();
+        }
+
+        void OnDeviceIdle()
+        {
+            auto& state = GetState();
+            state.CompletedSerial = state.SubmittedSerial;
+            state.FrameSerials.clear();
+            _CollectCompleted();
+        }
+
+        void Shutdown()
+        {
+            VulkanGlobals& vkGlobals = GetVulkanGlobals();
+            auto& state = GetState();
+
+            state.CompletedSerial = UINT64_MAX;
+            _CollectCompleted();
+
+            // (destroying the pools frees their descriptor sets)
+            for (VkDescriptorPool pool: state.DescriptorPools)
+                vkDestroyDescriptorPool(vkGlobals.Device, pool, vkGlobals.Allocator);
+            if (state.DescriptorSetLayout != VK_NULL_HANDLE)
+                vkDestroyDescriptorSetLayout(vkGlobals.Device, state.DescriptorSetLayout, vkGlobals.Allocator);
+            if (state.SharedSampler != VK_NULL_HANDLE)
+                vkDestroySampler(vkGlobals.Device, state.SharedSampler, vkGlobals.Allocator);
+
+            state = State();
+        }
+    }
+}
+
+#endif // HELLOIMGUI_HAS_VULKAN
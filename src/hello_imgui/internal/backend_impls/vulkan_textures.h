@@ -0,0 +1,49 @@
+#pragma once
+#ifdef HELLOIMGUI_HAS_VULKAN
+
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+#include <functional>
+
+
+namespace HelloImGui
+{
+    // VulkanTextures: descriptor sets and deferred destruction of the user textures (see ImageVulkan)
+    //
+    // The GPU progress is tracked with serials: each frame submission gets a serial,
+    // which is completed when the fence of the frame was waited for.
+    namespace VulkanTextures
+    {
+        // Returns a descriptor set for the image view (with the sampler shared by all the textures),
+        // compatible with the pipeline of imgui_impl_vulkan (i.e. usable as an ImTextureID).
+        // The descriptor sets are allocated from a growing list of descriptor pools, and recycled when freed:
+        // the number of textures is not limited by the size of VulkanGlobals.DescriptorPool.
+        // (only used with RendererBackendOptions.vulkanGrowableDescriptorPools)
+        VkDescriptorSet AllocateTextureDescriptorSet(VkImageView imageView);
+        // Call this once the GPU does not use the descriptor set anymore (e.g. inside the destroyFn of DestroyImageDeferred)
+        void FreeTextureDescriptorSet(VkDescriptorSet descriptorSet);
+
+        // Destroys the image and its memory, once the GPU does not use them anymore
+        // (destroyFn destroys the other resources of the image: view, descriptor set)
+        void DestroyImageDeferred(VkImage image, VkDeviceMemory memory, std::function<void()> destroyFn);
+
+        // Called by VulkanSetup::FrameRender:
+        //   - after waiting for the fence of the frame
+        void OnFrameFenceWaited(uint32_t frameIndex);
+        //   - just before the submission of the frame
+        void OnFrameSubmit(uint32_t frameIndex);
+
+        // Called instead of FrameRender when the main window is minimized: no frame fence will be waited for,
+        // so that the pending destructions wait for the device instead (nothing is rendered in the main window)
+        void OnMinimizedFrame();
+
+        // Called when the device is idle (e.g. after vkDeviceWaitIdle, or when the swapchain is recreated)
+        void OnDeviceIdle();
+
+        // Releases everything (the device must be idle)
+        void Shutdown();
+    }
+}
+
+#endif // HELLOIMGUI_HAS_VULKAN
@@ -0,0 +1,177 @@
+#include "hello_imgui/internal/compressed_texture.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+
+
+namespace HelloImGui
+{
+    bool IsCompressedTextureFilename(const std::string& filename)
+    {
+        auto fnEndsWith = [&filename](const std::string& suffix) {
+            if (filename.size() < suffix.size())
+                return false;
+            std::string end = filename.substr(filename.size() - suffix.size());
+            std::transform(end.begin(), end.end(), end.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+            return end == suffix;
+        };
+        return fnEndsWith(".ktx2") || fnEndsWith(".dds");
+    }
+
+    size_t CompressedLevelDataSize(CompressedTextureFormat format, int width, int height)
+    {
+        bool isBc1 = (format == CompressedTextureFormat::BC1 || format == CompressedTextureFormat::BC1_RGBA);
+        size_t blockSize = (isBc1 || format == CompressedTextureFormat::ETC2_RGB8) ? 8 : 16;
+        size_t nbBlocksX = (size_t)(width + 3) / 4, nbBlocksY = (size_t)(height + 3) / 4;
+        return nbBlocksX * nbBlocksY * blockSize;
+    }
+
+    static uint32_t _ReadU32(const unsigned char* p) { uint32_t v; memcpy(&v, p, 4); return v; }  // little endian files
+    static uint64_t _ReadU64(const unsigned char* p) { uint64_t v; memcpy(&v, p, 8); return v; }
+
+    static bool _Fail(std::string* outError, const std::string& message)
+    {
+        if (outError)
+            *outError = message;
+        return false;
+    }
+
+
+    // ---------------------------- KTX2 ----------------------------
+
+    static const unsigned char kKtx2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+    static bool _Ktx2FormatFromVkFormat(uint32_t vkFormat, CompressedTextureFormat* out)
+    {
+        switch (vkFormat)
+        {
+            case 131: case 132: *out = CompressedTextureFormat::BC1; return true;                      // VK_FORMAT_BC1_RGB_UNORM/SRGB_BLOCK
+            case 133: case 134: *out = CompressedTextureFormat::BC1_RGBA; return true;                 // VK_FORMAT_BC1_RGBA_UNORM/SRGB_BLOCK
+            case 137: case 138: *out = CompressedTextureFormat::BC3; return true;                      // VK_FORMAT_BC3_UNORM/SRGB_BLOCK
+            case 145: case 146: *out = CompressedTextureFormat::BC7; return true;                      // VK_FORMAT_BC7_UNORM/SRGB_BLOCK
+            case 147: case 148: *out = CompressedTextureFormat::ETC2_RGB8; return true;                // VK_FORMAT_ETC2_R8G8B8_UNORM/SRGB_BLOCK
+            case 151: case 152: *out = CompressedTextureFormat::ETC2_RGBA8; return true;               // VK_FORMAT_ETC2_R8G8B8A8_UNORM/SRGB_BLOCK
+            case 157: case 158: *out = CompressedTextureFormat::ASTC_4x4; return true;                 // VK_FORMAT_ASTC_4x4_UNORM/SRGB_BLOCK
+            default: return false;
+        }
+    }
+
+    static bool _ParseKtx2(const unsigned char* data, size_t size, CompressedTexture* out, std::string* outError)
+    {
+        const size_t kHeaderSize = 80;
+        if (size < kHeaderSize)
+            return _Fail(outError, "KTX2: truncated header");
+        uint32_t vkFormat = _ReadU32(data + 12);
+        uint32_t width = _ReadU32(data + 20), height = _ReadU32(data + 24), depth = _ReadU32(data + 28);
+        uint32_t layerCount = _ReadU32(data + 32), faceCount = _ReadU32(data + 36), levelCount = _ReadU32(data + 40);
+        uint32_t supercompressionScheme = _ReadU32(data + 44);
+
+        if (!_Ktx2FormatFromVkFormat(vkFormat, &out->Format))
+            return _Fail(outError, "KTX2: unsupported vkFormat " + std::to_string(vkFormat));
+        if (supercompressionScheme != 0)
+            return _Fail(outError, "KTX2: supercompressed files (Basis Universal, zstd) are not supported");
+        if (depth > 1 || layerCount > 1 || faceCount != 1 || width == 0 || height == 0)
+            return _Fail(outError, "KTX2: only 2D textures are supported");
+
+        levelCount = std::max(levelCount, 1u);  // 0 means "generate the mipmaps"
+        if (size < kHeaderSize + (size_t)levelCount * 24)
+            return _Fail(outError, "KTX2: truncated level index");
+        out->Levels.clear();
+        for (uint32_t i = 0; i < levelCount; ++i)
+        {
+            const unsigned char* levelIndex = data + kHeaderSize + i * 24;
+            uint64_t byteOffset = _ReadU64(levelIndex), byteLength = _ReadU64(levelIndex + 8);
+            CompressedTexture::Level level;
+            level.Width = (int)std::max(width >> i, 1u);
+            level.Height = (int)std::max(height >> i, 1u);
+            level.DataSize = CompressedLevelDataSize(out->Format, level.Width, level.Height);
+            if (byteLength < level.DataSize || byteOffset > size || byteLength > size - byteOffset)
+                return _Fail(outError, "KTX2: truncated level " + std::to_string(i));
+            level.Data = data + byteOffset;
+            out->Levels.push_back(level);
+        }
+        return true;
+    }
+
+
+    // ---------------------------- DDS ----------------------------
+
+    static bool _DdsFormatFromDxgiFormat(uint32_t dxgiFormat, CompressedTextureFormat* out)
+    {
+        switch (dxgiFormat)
+        {
+            case 71: case 72: *out = CompressedTextureFormat::BC1; return true;  // DXGI_FORMAT_BC1_UNORM(_SRGB)
+            case 77: case 78: *out = CompressedTextureFormat::BC3; return true;  // DXGI_FORMAT_BC3_UNORM(_SRGB)
+            case 98: case 99: *out = CompressedTextureFormat::BC7; return true;  // DXGI_FORMAT_BC7_UNORM(_SRGB)
+            default: return false;
+        }
+    }
+
+    static bool _ParseDds(const unsigned char* data, size_t size, CompressedTexture* out, std::string* outError)
+    {
+        // "DDS " + DDS_HEADER (124 bytes) [+ DDS_HEADER_DXT10 (20 bytes)]
+        const size_t kHeaderSize = 4 + 124;
+        if (size < kHeaderSize || _ReadU32(data + 4) != 124)
+            return _Fail(outError, "DDS: invalid header");
+        uint32_t height = _ReadU32(data + 12), width = _ReadU32(data + 16);
+        uint32_t mipMapCount = std::max(_ReadU32(data + 28), 1u);
+        uint32_t pixelFormatFlags = _ReadU32(data + 80);
+        const unsigned char* fourCC = data + 84;
+        const uint32_t DDPF_FOURCC = 0x4;
+
+        size_t dataOffset = kHeaderSize;
+        if (!(pixelFormatFlags & DDPF_FOURCC))
+            return _Fail(outError, "DDS: uncompressed files are not supported");
+        if (memcmp(fourCC, "DXT1", 4) == 0)
+            out->Format = CompressedTextureFormat::BC1;
+        else if (memcmp(fourCC, "DXT5", 4) == 0)
+            out->Format = CompressedTextureFormat::BC3;
+        else if (memcmp(fourCC, "DX10", 4) == 0)
+        {
+            if (size < kHeaderSize + 20)
+                return _Fail(outError, "DDS: truncated DX10 header");
+            uint32_t dxgiFormat = _ReadU32(data + kHeaderSize);
+            uint32_t resourceDimension = _ReadU32(data + kHeaderSize + 4), arraySize = _ReadU32(data + kHeaderSize + 12);
+            if (!_DdsFormatFromDxgiFormat(dxgiFormat, &out->Format))
+                return _Fail(outError, "DDS: unsupported DXGI format " + std::to_string(dxgiFormat));
+            const uint32_t D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3;
+            if (resourceDimension != D3D10_RESOURCE_DIMENSION_TEXTURE2D || arraySize > 1)
+                return _Fail(outError, "DDS: only 2D textures are supported");
+            dataOffset += 20;
+        }
+        else
+            return _Fail(outError, "DDS: unsupported FourCC " + std::string((const char*)fourCC, 4));
+        if (width == 0 || height == 0)
+            return _Fail(outError, "DDS: empty image");
+
+        // The levels follow each other
+        out->Levels.clear();
+        size_t offset = dataOffset;
+        for (uint32_t i = 0; i < mipMapCount; ++i)
+        {
+            CompressedTexture::Level level;
+            level.Width = (int)std::max(width >> i, 1u);
+            level.Height = (int)std::max(height >> i, 1u);
+            level.DataSize = CompressedLevelDataSize(out->Format, level.Width, level.Height);
+            if (offset + level.DataSize > size)
+                return _Fail(outError, "DDS: truncated level " + std::to_string(i));
+            level.Data = data + offset;
+            offset += level.DataSize;
+            out->Levels.push_back(level);
+        }
+        return true;
+    }
+
+
+    bool ParseCompressedTexture(const void* fileData, size_t fileSize, CompressedTexture* out, std::string* outError)
+    {
+        const unsigned char* data = (const unsigned char*)fileData;
+        if (fileSize >= sizeof(kKtx2Identifier) && memcmp(data, kKtx2Identifier, sizeof(kKtx2Identifier)) == 0)
+            return _ParseKtx2(data, fileSize, out, outError);
+        if (fileSize >= 4 && memcmp(data, "DDS ", 4) == 0)
+            return _ParseDds(data, fileSize, out, outError);
+        return _Fail(outError, "not a KTX2 or DDS file");
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace HelloImGui
+{
+    // Pre-compressed textures (GPU block formats), loaded from KTX2 or DDS files.
+    // They use 4 to 8 times less memory than RGBA8, and may include their mipmaps.
+    // (the pixels are not decoded: they are handed as is to the rendering backend, see ImageAbstract)
+    enum class CompressedTextureFormat
+    {
+        BC1,        // a.k.a. DXT1 (desktop)
+        BC1_RGBA,   // BC1 with 1-bit alpha (desktop)
+        BC3,        // a.k.a. DXT5 (desktop)
+        BC7,        // desktop
+        ETC2_RGB8,  // OpenGL ES 3 / mobile
+        ETC2_RGBA8, // OpenGL ES 3 / mobile
+        ASTC_4x4,   // mobile
+    };
+
+    struct CompressedTexture
+    {
+        struct Level
+        {
+            int Width = 0, Height = 0;
+            const unsigned char* Data = nullptr;  // Points inside the file data
+            size_t DataSize = 0;
+        };
+
+        CompressedTextureFormat Format = CompressedTextureFormat::BC1;
+        std::vector<Level> Levels;  // Levels[0] is the full resolution image
+
+        int Width() const { return Levels.empty() ? 0 : Levels[0].Width; }
+        int Height() const { return Levels.empty() ? 0 : Levels[0].Height; }
+    };
+
+    // True if the file extension is .ktx2 or .dds
+    bool IsCompressedTextureFilename(const std::string& filename);
+
+    // Parses a KTX2 or DDS file (2D textures only, without supercompression).
+    // Returns false if the file is invalid, or if its format is not supported (see *outError)
+    bool ParseCompressedTexture(const void* fileData, size_t fileSize, CompressedTexture* out, std::string* outError);
+
+    // Size in bytes of a level (all the supported formats use blocks of 4x4 pixels)
+    size_t CompressedLevelDataSize(CompressedTextureFormat format, int width, int height);
+}
@@ -5,9 +5,14 @@
 #include "hello_imgui/hello_imgui_theme.h"
 #include "hello_imgui/hello_imgui.h"
 #include "hello_imgui/internal/functional_utils.h"
+#include "hello_imgui/internal/clock_seconds.h"
 #include "imgui_internal.h"
 #include "nlohmann/json.hpp"
+#include <algorithm>
+#include <cmath>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <cassert>
 #include <optional>
@@ -20,7 +25,7 @@ bool ShouldRemoteDisplay();
 
 namespace SplitIdsHelper
 {
-    std::map<DockSpaceName, ImGuiID> gImGuiSplitIDs;
+    std::unordered_map<DockSpaceName, ImGuiID> gImGuiSplitIDs;
 
     bool ContainsSplit(const DockSpaceName& dockSpaceName)
     {
@@ -29,8 +34,9 @@ namespace SplitIdsHelper
 
     ImGuiID GetSplitId(const DockSpaceName& dockSpaceName)
     {
-        IM_ASSERT(ContainsSplit(dockSpaceName) && "GetSplitId: dockSpaceName not found in gImGuiSplitIDs");
-        return gImGuiSplitIDs.at(dockSpaceName);
+        auto it = gImGuiSplitIDs.find(dockSpaceName);
+        IM_ASSERT(it != gImGuiSplitIDs.end() && "GetSplitId: dockSpaceName not found in gImGuiSplitIDs");
+        return it->second;
     }
 
     void SetSplitId(const DockSpaceName& dockSpaceName, ImGuiID imguiId)
@@ -40,9 +46,9 @@ namespace SplitIdsHelper
 
     std::string SaveSplitIds()
     {
-        // Serialize gImGuiSplitIDs using json
+        // Serialize gImGuiSplitIDs using json (sorted, so that the saved settings are stable)
         nlohmann::json j;
-        j["gImGuiSplitIDs"] = gImGuiSplitIDs;
+        j["gImGuiSplitIDs"] = std::map<DockSpaceName, ImGuiID>(gImGuiSplitIDs.begin(), gImGuiSplitIDs.end());
         return j.dump();
     }
 
@@ -52,7 +58,8 @@ namespace SplitIdsHelper
         try
         {
             nlohmann::json j = nlohmann::json::parse(jsonStr);
-            gImGuiSplitIDs = j.at("gImGuiSplitIDs").get<std::map<DockSpaceName, ImGuiID>>();
+            auto splitIds = j.at("gImGuiSplitIDs").get<std::map<DockSpaceName, ImGuiID>>();
+            gImGuiSplitIDs = std::unordered_map<DockSpaceName, ImGuiID>(splitIds.begin(), splitIds.end());
         }
         catch (const nlohmann::json::parse_error& e)
         {
@@ -74,6 +81,448 @@ namespace SplitIdsHelper
 }
 
 
+// Visibility-aware scheduling of the dockable windows GuiFunction, and cost accounting
+// (see DockableWindow.skipGuiWhenOccluded, DockableWindow.refreshRate and DockableWindow.guiTimeBudgetMs)
+namespace DockableWindowScheduling
+{
+    // A window is considered over budget after this many consecutive calls above its budget
+    constexpr int kNbCallsOverBudgetBeforeAction = 30;
+    // Max number of frames between two refreshes of a window that exceeds its budget
+    constexpr int kMaxBudgetSkipFactor = 8;
+
+    // A draw command of a window content, with its own vertices (replayed between two refreshes)
+    struct CachedDrawCmd
+    {
+        ImVec4 clipRect;
+        ImTextureID textureId;
+        std::vector<ImDrawVert> vertices;
+        std::vector<ImDrawIdx> indices;    // relative to vertices
+    };
+
+    struct WindowState
+    {
+        DockableWindowStats stats;
+
+        std::vector<CachedDrawCmd> cachedCmds;
+        bool hasCache = false;
+        ImVec2 cachePos, cacheSize, cacheScroll;
+        ImVec2 cacheCursorMaxPos, cacheIdealMaxPos;  // relative to cachePos
+        double lastRefreshTime = -1.;
+        int nbFramesSinceRefresh = 0;
+
+        int nbConsecutiveCallsOverBudget = 0;
+
+        int lastSeenFrame = 0;  // Frame count of the last access
+    };
+
+    // States of the dockable windows, by label.
+    // The states of the windows which were not seen during kNbFramesBeforeEviction frames
+    // (removed from dockableWindows, or renamed) are evicted by PruneWindowStates()
+    std::unordered_map<std::string, WindowState> gWindowStates;
+    constexpr int kNbFramesBeforeEviction = 600;
+    // Cost of the menus, status bar and toolbars callbacks
+    std::map<std::string, WindowState> gSectionStates;
+    DockableWindowVisibility gCurrentVisibility = DockableWindowVisibility::Visible;
+
+    WindowState& GetWindowState(const std::string& label)
+    {
+        WindowState& r = gWindowStates[label];
+        r.stats.label = label;
+        r.lastSeenFrame = ImGui::GetFrameCount();
+        return r;
+    }
+
+    // Called once per frame: the map is scanned every kNbFramesBeforeEviction frames
+    void PruneWindowStates()
+    {
+        int frameCount = ImGui::GetFrameCount();
+        if (frameCount % kNbFramesBeforeEviction != 0)
+            return;
+        for (auto it = gWindowStates.begin(); it != gWindowStates.end(); )
+        {
+            if (frameCount - it->second.lastSeenFrame > kNbFramesBeforeEviction)
+                it = gWindowStates.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    bool IsOffScreen(ImGuiWindow* window)
+    {
+        ImGuiViewport* viewport = window->Viewport;
+        if (viewport == nullptr)
+            return false;
+        ImRect viewportRect(viewport->Pos, viewport->Pos + viewport->Size);
+        return !viewportRect.Overlaps(window->Rect());
+    }
+
+    // Returns true if a window displayed in front of this window fully covers it.
+    // Windows that are not yet submitted during this frame are tested with their position at the previous frame.
+    bool IsOccluded(ImGuiWindow* window)
+    {
+        ImGuiContext& g = *GImGui;
+        ImGuiWindow* displayRoot = window->RootWindowDockTree;
+        int displayIndex = ImGui::FindWindowDisplayIndex(displayRoot);
+        if (displayIndex < 0)
+            return false;
+        ImRect rect = window->Rect();
+        ImGuiWindowFlags transientFlags = ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Tooltip | ImGuiWindowFlags_Popup | ImGuiWindowFlags_NoBackground;
+        for (int i = displayIndex + 1; i < g.Windows.Size; ++i)
+        {
+            ImGuiWindow* other = g.Windows[i];
+            if (other->RootWindowDockTree == displayRoot || other->Viewport != window->Viewport)
+                continue;
+            if (!(other->Active || other->WasActive) || other->Hidden || other->Collapsed)
+                continue;
+            if (other->Flags & transientFlags)
+                continue;
+            if (other->Rect().Contains(rect))
+                return true;
+        }
+        return false;
+    }
+
+    // Visibility of a window after ImGui::Begin
+    DockableWindowVisibility ComputeVisibility(ImGuiWindow* window, bool beginResult)
+    {
+        if (!beginResult)
+        {
+            bool isInactiveTab = window->DockIsActive && !window->DockTabIsVisible && !window->Collapsed;
+            return isInactiveTab ? DockableWindowVisibility::InactiveTab : DockableWindowVisibility::Collapsed;
+        }
+        if (IsOffScreen(window))
+            return DockableWindowVisibility::OffScreen;
+        if (IsOccluded(window))
+            return DockableWindowVisibility::Occluded;
+        return DockableWindowVisibility::Visible;
+    }
+
+    // A window the user interacts with is refreshed at each frame
+    bool IsInteractedWith(ImGuiWindow* window)
+    {
+        ImGuiContext& g = *GImGui;
+        if (g.OpenPopupStack.Size > 0 || g.DragDropActive)
+            return true;
+        auto isInWindow = [window](ImGuiWindow* w) { return w != nullptr && w->RootWindow == window->RootWindow; };
+        return isInWindow(g.HoveredWindow) || isInWindow(g.NavWindow) || isInWindow(g.ActiveIdWindow);
+    }
+
+    int ImGuiAllocationsCount()
+    {
+    #ifndef IMGUI_DISABLE_DEBUG_TOOLS
+        return GImGui->DebugAllocInfo.TotalAllocCount;
+    #else
+        return 0;
+    #endif
+    }
+
+    // Vertices of a window and of its child windows
+    int CountVertices(ImGuiWindow* window)
+    {
+        int r = window->DrawList->VtxBuffer.Size;
+        for (ImGuiWindow* child: window->DC.ChildWindows)
+            r += CountVertices(child);
+        return r;
+    }
+
+    bool IsMeasuringGuiCost()
+    {
+        return HelloImGui::GetRunnerParams()->imGuiWindowParams.measureGuiCost;
+    }
+
+    // Calls fn, and accumulates its cost into stats.
+    // If window is not null, the vertices added to it (and to its child windows) during the call are counted.
+    void CallAndMeasure(const VoidFunction& fn, DockableWindowStats& stats, ImGuiWindow* window)
+    {
+        int nbVerticesBefore = (window != nullptr) ? window->DrawList->VtxBuffer.Size : 0;
+        int nbAllocationsBefore = ImGuiAllocationsCount();
+        double startTime = Internal::ClockSeconds();
+
+        fn();
+
+        double duration = Internal::ClockSeconds() - startTime;
+        stats.nbAllocationsLast = ImGuiAllocationsCount() - nbAllocationsBefore;
+        stats.nbVerticesLast = (window != nullptr) ? CountVertices(window) - nbVerticesBefore : 0;
+        stats.guiTimeAverage = (stats.nbGuiCalls == 0) ? duration : stats.guiTimeAverage + 0.1 * (duration - stats.guiTimeAverage);
+        stats.guiTimeLast = duration;
+        stats.guiTimeTotal += duration;
+        ++stats.nbGuiCalls;
+    }
+
+    // Soft time budget: a window is over budget after kNbCallsOverBudgetBeforeAction consecutive calls above it,
+    // and stays so until its average cost per call is within the budget
+    void UpdateBudget(const DockableWindow& dockableWindow, WindowState& state)
+    {
+        auto& stats = state.stats;
+        stats.guiTimeBudgetMs = dockableWindow.guiTimeBudgetMs;
+        if (dockableWindow.guiTimeBudgetMs <= 0.f)
+        {
+            stats.isOverBudget = false;
+            return;
+        }
+        double budget = (double)dockableWindow.guiTimeBudgetMs / 1000.;
+        if (stats.guiTimeLast > budget)
+        {
+            ++state.nbConsecutiveCallsOverBudget;
+            ++stats.nbCallsOverBudget;
+        }
+        else
+            state.nbConsecutiveCallsOverBudget = 0;
+
+        if (!stats.isOverBudget && state.nbConsecutiveCallsOverBudget >= kNbCallsOverBudgetBeforeAction)
+        {
+            stats.isOverBudget = true;
+            HelloImGui::Log(LogLevel::Warning, "Dockable window \"%s\" exceeds its time budget (%.2f ms > %.2f ms)",
+                            dockableWindow.label.c_str(), stats.guiTimeAverage * 1000., (double)dockableWindow.guiTimeBudgetMs);
+        }
+        else if (stats.isOverBudget && stats.guiTimeAverage <= budget)
+        {
+            stats.isOverBudget = false;
+            HelloImGui::Log(LogLevel::Info, "Dockable window \"%s\" is back within its time budget", dockableWindow.label.c_str());
+        }
+    }
+
+    // A window that exceeds its budget (with guiTimeBudgetAction=SkipFrames) is refreshed once every N frames
+    int BudgetSkipFactor(const DockableWindow& dockableWindow, const WindowState& state)
+    {
+        bool isDegraded = state.stats.isOverBudget && (dockableWindow.guiTimeBudgetAction == DockableWindowBudgetAction::SkipFrames);
+        if (!isDegraded)
+            return 1;
+        double budget = (double)dockableWindow.guiTimeBudgetMs / 1000.;
+        int factor = (int)std::ceil(state.stats.guiTimeAverage / budget);
+        return ImClamp(factor, 1, kMaxBudgetSkipFactor);
+    }
+
+    // GuiFunction is timed only if the cost is measured, or if the window has a time budget
+    void CallGuiFunction(const DockableWindow& dockableWindow, WindowState& state, ImGuiWindow* window)
+    {
+        if (IsMeasuringGuiCost() || dockableWindow.guiTimeBudgetMs > 0.f)
+            CallAndMeasure(dockableWindow.GuiFunction, state.stats, window);
+        else
+        {
+            dockableWindow.GuiFunction();
+            ++state.stats.nbGuiCalls;
+        }
+        UpdateBudget(dockableWindow, state);
+    }
+
+    // Calls GuiFunction inside a separate draw channel, and keeps a copy of its draw commands.
+    // The copy is dropped if the content cannot be replayed (child windows, draw callbacks).
+    void CallGuiFunction_AndCache(const DockableWindow& dockableWindow, WindowState& state, ImGuiWindow* window)
+    {
+        ImDrawList* drawList = window->DrawList;
+        // A dedicated splitter: GuiFunction may itself call drawList->ChannelsSplit()
+        // (nested splits of the draw list own splitter are not supported by ImGui)
+        ImDrawListSplitter splitter;
+        splitter.Split(drawList, 2);
+        splitter.SetCurrentChannel(drawList, 1);
+
+        CallGuiFunction(dockableWindow, state, window);
+
+        state.cachedCmds.clear();
+        state.hasCache = (window->DC.ChildWindows.Size == 0);
+        // During the split, drawList->CmdBuffer and drawList->IdxBuffer are those of channel 1
+        for (const ImDrawCmd& cmd: drawList->CmdBuffer)
+        {
+            if (!state.hasCache)
+                break;
+            if (cmd.UserCallback != nullptr)
+            {
+                state.hasCache = false;
+                break;
+            }
+            if (cmd.ElemCount == 0)
+                continue;
+            const ImDrawIdx* indices = drawList->IdxBuffer.Data + cmd.IdxOffset;
+            unsigned int minIdx = indices[0], maxIdx = indices[0];
+            for (unsigned int i = 0; i < cmd.ElemCount; ++i)
+            {
+                minIdx = ImMin(minIdx, (unsigned int)indices[i]);
+                maxIdx = ImMax(maxIdx, (unsigned int)indices[i]);
+            }
+            CachedDrawCmd cachedCmd;
+            cachedCmd.clipRect = cmd.ClipRect;
+            cachedCmd.textureId = cmd.TextureId;
+            const ImDrawVert* vertices = drawList->VtxBuffer.Data + cmd.VtxOffset;
+            cachedCmd.vertices.assign(vertices + minIdx, vertices + maxIdx + 1);
+            cachedCmd.indices.resize(cmd.ElemCount);
+            for (unsigned int i = 0; i < cmd.ElemCount; ++i)
+                cachedCmd.indices[i] = (ImDrawIdx)(indices[i] - minIdx);
+            state.cachedCmds.push_back(std::move(cachedCmd));
+        }
+        if (!state.hasCache)
+            state.cachedCmds.clear();
+
+        splitter.Merge(drawList);
+
+        state.cachePos = window->Pos;
+        state.cacheSize = window->Size;
+        state.cacheScroll = window->Scroll;
+        state.cacheCursorMaxPos = window->DC.CursorMaxPos - window->Pos;
+        state.cacheIdealMaxPos = window->DC.IdealMaxPos - window->Pos;
+        state.lastRefreshTime = Internal::ClockSeconds();
+        state.nbFramesSinceRefresh = 0;
+    }
+
+    // Draws the cached content (translated if the window moved), and restores the content size
+    void ReplayCachedGui(WindowState& state, ImGuiWindow* window)
+    {
+        ImDrawList* drawList = window->DrawList;
+        ImVec2 delta = window->Pos - state.cachePos;
+        for (const CachedDrawCmd& cmd: state.cachedCmds)
+        {
+            drawList->PushClipRect(ImVec2(cmd.clipRect.x, cmd.clipRect.y) + delta, ImVec2(cmd.clipRect.z, cmd.clipRect.w) + delta, false);
+            drawList->PushTextureID(cmd.textureId);
+            drawList->PrimReserve((int)cmd.indices.size(), (int)cmd.vertices.size());
+            unsigned int baseIdx = drawList->_VtxCurrentIdx;
+            for (ImDrawIdx idx: cmd.indices)
+                drawList->PrimWriteIdx((ImDrawIdx)(baseIdx + idx));
+            for (const ImDrawVert& vertex: cmd.vertices)
+                drawList->PrimWriteVtx(vertex.pos + delta, vertex.uv, vertex.col);
+            drawList->PopTextureID();
+            drawList->PopClipRect();
+        }
+        window->DC.CursorMaxPos = ImMax(window->DC.CursorMaxPos, window->Pos + state.cacheCursorMaxPos);
+        window->DC.IdealMaxPos = ImMax(window->DC.IdealMaxPos, window->Pos + state.cacheIdealMaxPos);
+        ++state.stats.nbReplayedFrames;
+        ++state.nbFramesSinceRefresh;
+    }
+
+    bool ShallRefresh(const DockableWindow& dockableWindow, const WindowState& state, ImGuiWindow* window)
+    {
+        if (!state.hasCache)
+            return true;
+        bool isGeometryChanged = (window->Size.x != state.cacheSize.x) || (window->Size.y != state.cacheSize.y)
+                              || (window->Scroll.x != state.cacheScroll.x) || (window->Scroll.y != state.cacheScroll.y);
+        if (isGeometryChanged || IsInteractedWith(window))
+            return true;
+
+        bool isRefreshRateDue = (dockableWindow.refreshRate <= 0.f)
+            || (Internal::ClockSeconds() - state.lastRefreshTime >= 1. / (double)dockableWindow.refreshRate);
+        bool isBudgetDue = (state.nbFramesSinceRefresh + 1 >= BudgetSkipFactor(dockableWindow, state));
+        return isRefreshRateDue && isBudgetDue;
+    }
+
+    // Called between ImGui::Begin and ImGui::End
+    void ScheduleGuiFunction(const DockableWindow& dockableWindow, bool beginResult)
+    {
+        WindowState& state = GetWindowState(dockableWindow.label);
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        DockableWindowVisibility visibility = ComputeVisibility(window, beginResult);
+        state.stats.visibility = visibility;
+        gCurrentVisibility = visibility;
+
+        bool isHidden = !beginResult;
+        bool isOccluded = (visibility == DockableWindowVisibility::OffScreen) || (visibility == DockableWindowVisibility::Occluded);
+        if (isHidden || (isOccluded && dockableWindow.skipGuiWhenOccluded) || !dockableWindow.GuiFunction)
+        {
+            ++state.stats.nbSkippedFrames;
+            state.hasCache = false;
+            return;
+        }
+
+        bool useCache = (dockableWindow.refreshRate > 0.f) || (BudgetSkipFactor(dockableWindow, state) > 1);
+        if (!useCache)
+            CallGuiFunction(dockableWindow, state, window);
+        else if (ShallRefresh(dockableWindow, state, window))
+            CallGuiFunction_AndCache(dockableWindow, state, window);
+        else
+            ReplayCachedGui(state, window);
+    }
+
+    // For windows with callBeginEnd=false: the user calls ImGui::Begin inside GuiFunction.
+    // The visibility is read after the call, and is available to GuiFunction at the next frame.
+    void CallGuiFunction_NoBeginEnd(const DockableWindow& dockableWindow)
+    {
+        WindowState& state = GetWindowState(dockableWindow.label);
+        gCurrentVisibility = state.stats.visibility;
+        CallGuiFunction(dockableWindow, state, nullptr);
+
+        ImGuiWindow* window = ImGui::FindWindowByName(dockableWindow.label.c_str());
+        bool wasSubmitted = (window != nullptr) && (window->LastFrameActive == ImGui::GetFrameCount());
+        if (!wasSubmitted)
+            state.stats.visibility = DockableWindowVisibility::Hidden;
+        else
+        {
+            state.stats.visibility = ComputeVisibility(window, !window->SkipItems);
+            if (IsMeasuringGuiCost())
+                state.stats.nbVerticesLast = CountVertices(window);
+        }
+    }
+
+    // "Windows cost" window, opened from the View menu
+    bool gShowWindowsCostWindow = false;
+
+    const char* VisibilityName(DockableWindowVisibility visibility)
+    {
+        switch (visibility)
+        {
+            case DockableWindowVisibility::Hidden: return "Hidden";
+            case DockableWindowVisibility::Collapsed: return "Collapsed";
+            case DockableWindowVisibility::InactiveTab: return "Inactive tab";
+            case DockableWindowVisibility::OffScreen: return "Off screen";
+            case DockableWindowVisibility::Occluded: return "Occluded";
+            case DockableWindowVisibility::Visible: return "Visible";
+        }
+        return "";
+    }
+
+    void ShowWindowsCostWindow()
+    {
+        if (!gShowWindowsCostWindow || !IsMeasuringGuiCost())
+            return;
+        ImGui::SetNextWindowSize(HelloImGui::EmToVec2(50.f, 20.f), ImGuiCond_FirstUseEver);
+        if (ImGui::Begin("Windows cost", &gShowWindowsCostWindow))
+        {
+            std::vector<DockableWindowStats> allStats = GuiCostStats();
+            std::stable_sort(allStats.begin(), allStats.end(),
+                [](const DockableWindowStats& a, const DockableWindowStats& b) { return a.guiTimeAverage > b.guiTimeAverage; });
+
+            ImGuiTableFlags tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+            if (ImGui::BeginTable("WindowsCost", 8, tableFlags))
+            {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn("Window");
+                ImGui::TableSetupColumn("Visibility");
+                ImGui::TableSetupColumn("Avg ms");
+                ImGui::TableSetupColumn("Budget ms");
+                ImGui::TableSetupColumn("Vertices");
+                ImGui::TableSetupColumn("Allocs");
+                ImGui::TableSetupColumn("Calls");
+                ImGui::TableSetupColumn("Skipped / Replayed");
+                ImGui::TableHeadersRow();
+                for (const auto& stats: allStats)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(stats.label.c_str());
+                    ImGui::TableNextColumn(); ImGui::TextUnformatted(VisibilityName(stats.visibility));
+                    ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.guiTimeAverage * 1000.);
+                    ImGui::TableNextColumn();
+                    if (stats.guiTimeBudgetMs > 0.f)
+                    {
+                        if (stats.isOverBudget)
+                            ImGui::TextColored(ImVec4(1.f, 0.4f, 0.4f, 1.f), "%.2f (over)", (double)stats.guiTimeBudgetMs);
+                        else
+                            ImGui::Text("%.2f", (double)stats.guiTimeBudgetMs);
+                    }
+                    ImGui::TableNextColumn(); ImGui::Text("%d", stats.nbVerticesLast);
+                    ImGui::TableNextColumn(); ImGui::Text("%d", stats.nbAllocationsLast);
+                    ImGui::TableNextColumn(); ImGui::Text("%zu", stats.nbGuiCalls);
+                    ImGui::TableNextColumn(); ImGui::Text("%zu / %zu", stats.nbSkippedFrames, stats.nbReplayedFrames);
+                }
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+}
+
+void ShowWindowsCostWindow_Static()
+{
+    DockableWindowScheduling::ShowWindowsCostWindow();
+}
+
+
 static bool gShowTweakWindow = false;
 
 void ShowThemeTweakGuiWindow_Static()
@@ -271,6 +720,10 @@ void MenuView_Misc(RunnerParams& runnerParams)
 		ImGui::EndMenu();
 	}
 
+    if (runnerParams.imGuiWindowParams.measureGuiCost)
+        if (ImGui::MenuItem("Windows cost", nullptr, DockableWindowScheduling::gShowWindowsCostWindow))
+            DockableWindowScheduling::gShowWindowsCostWindow = !DockableWindowScheduling::gShowWindowsCostWindow;
+
     if (runnerParams.imGuiWindowParams.showMenu_View_Themes)
         MenuTheme();
 }
@@ -313,8 +766,7 @@ void ShowDockableWindows(std::vector<DockableWindow>& dockableWindows)
                     not_collapsed = ImGui::Begin(dockableWindow.label.c_str(), &dockableWindow.isVisible, dockableWindow.imGuiWindowFlags);
                 else
                     not_collapsed = ImGui::Begin(dockableWindow.label.c_str(), nullptr, dockableWindow.imGuiWindowFlags);
-                if (not_collapsed && dockableWindow.GuiFunction)
-                    dockableWindow.GuiFunction();
+                DockableWindowScheduling::ScheduleGuiFunction(dockableWindow, not_collapsed);
                 ImGui::End();
 
                 if (shallFocusWindow)
@@ -325,10 +777,18 @@ void ShowDockableWindows(std::vector<DockableWindow>& dockableWindows)
             }
             else
             {
-                dockableWindow.GuiFunction();
+                DockableWindowScheduling::CallGuiFunction_NoBeginEnd(dockableWindow);
             }
         }
+        else
+        {
+            auto& stats = DockableWindowScheduling::GetWindowState(dockableWindow.label).stats;
+            stats.visibility = DockableWindowVisibility::Hidden;
+            ++stats.nbSkippedFrames;
+        }
     }
+    DockableWindowScheduling::gCurrentVisibility = DockableWindowVisibility::Visible;
+    DockableWindowScheduling::PruneWindowStates();
 }
 
 ImRect FullScreenRect_MinusInsets(const RunnerParams& runnerParams)
@@ -534,6 +994,21 @@ void DoShowToolbar(
 }
 
 
+void MeasureGuiCost(const std::string& sectionName, const VoidFunction& guiFunction)
+{
+    if (!guiFunction)
+        return;
+    if (!DockableWindowScheduling::IsMeasuringGuiCost())
+    {
+        guiFunction();
+        return;
+    }
+    auto& stats = DockableWindowScheduling::gSectionStates[sectionName].stats;
+    stats.label = sectionName;
+    stats.visibility = DockableWindowVisibility::Visible;
+    DockableWindowScheduling::CallAndMeasure(guiFunction, stats, ImGui::GetCurrentWindow());
+}
+
 void ShowToolbars(const RunnerParams& runnerParams)
 {
     for (auto edgeToolbarType: HelloImGui::AllEdgeToolbarTypes())
@@ -543,7 +1018,9 @@ void ShowToolbars(const RunnerParams& runnerParams)
             auto& edgeToolbar = runnerParams.callbacks.edgesToolbars.at(edgeToolbarType);
             auto fullScreenRect = FixedWindowRect(runnerParams, edgeToolbarType);
             std::string windowName = std::string("##") + HelloImGui::EdgeToolbarTypeName(edgeToolbarType) + "_2123243";
-            DoShowToolbar(fullScreenRect, edgeToolbar.ShowToolbar, windowName, edgeToolbar.options.WindowPaddingEm, edgeToolbar.options.WindowBg);
+            std::string sectionName = std::string("[Toolbar ") + HelloImGui::EdgeToolbarTypeName(edgeToolbarType) + "]";
+            VoidFunction measuredToolbarFunction = [&]() { MeasureGuiCost(sectionName, edgeToolbar.ShowToolbar); };
+            DoShowToolbar(fullScreenRect, measuredToolbarFunction, windowName, edgeToolbar.options.WindowPaddingEm, edgeToolbar.options.WindowBg);
         }
     }
 }
@@ -634,12 +1111,64 @@ void CloseWindowOrDock(ImGuiWindowParams& imGuiWindowParams)
 
 }  // namespace DockingDetails
 
+// Incremented when AddDockableWindowHelper adds or removes windows in RunnerParams.dockingParams.dockableWindows
+static uint64_t gDockableWindowsGeneration = 0;
+
+// Index of the labels used by DockingParams::dockableWindowOfName (label -> index in dockableWindows),
+// and the state of dockableWindows when it was built.
+// The indexes are stored here, keyed by DockingParams instance, so that DockingParams stays an aggregate.
+// An index may outlive its DockingParams: a found window is always checked, and a stale index is only
+// a slower lookup.
+struct DockableWindowsIndex
+{
+    std::unordered_map<std::string, std::size_t> labelToIndex;
+    const DockableWindow* indexedData = nullptr;
+    std::size_t indexedSize = 0;
+    uint64_t indexedGeneration = 0;
+};
+static std::unordered_map<const DockingParams*, DockableWindowsIndex> gDockableWindowsIndexes;
+// The indexes of the destroyed DockingParams are dropped when there are more than this many
+constexpr std::size_t kMaxDockableWindowsIndexes = 16;
+
 DockableWindow * DockingParams::dockableWindowOfName(const std::string &name)
 {
-    for (auto & dockableWindow: dockableWindows)
-        if (dockableWindow.label == name)
-            return &dockableWindow;
-    return nullptr;
+    if (gDockableWindowsIndexes.size() >= kMaxDockableWindowsIndexes && gDockableWindowsIndexes.count(this) == 0)
+        gDockableWindowsIndexes.clear();
+    DockableWindowsIndex& index = gDockableWindowsIndexes[this];
+
+    auto rebuildIndex = [this, &index]() {
+        index.labelToIndex.clear();
+        for (std::size_t i = 0; i < dockableWindows.size(); ++i)
+            index.labelToIndex.emplace(dockableWindows[i].label, i);  // the first window wins for duplicate labels
+        index.indexedData = dockableWindows.data();
+        index.indexedSize = dockableWindows.size();
+        index.indexedGeneration = gDockableWindowsGeneration;
+    };
+    auto findInIndex = [this, &index, &name]() -> DockableWindow * {
+        auto it = index.labelToIndex.find(name);
+        if (it == index.labelToIndex.end() || it->second >= dockableWindows.size())
+            return nullptr;
+        DockableWindow & dockableWindow = dockableWindows[it->second];
+        return (dockableWindow.label == name) ? &dockableWindow : nullptr;
+    };
+
+    bool wasIndexUpToDate = (index.indexedGeneration == gDockableWindowsGeneration)
+        && (index.indexedData == dockableWindows.data())
+        && (index.indexedSize == dockableWindows.size());
+    if (!wasIndexUpToDate)
+        rebuildIndex();
+    if (DockableWindow * r = findInIndex())
+        return r;
+    if (!wasIndexUpToDate)
+        return nullptr;
+
+    // The labels may have been modified in place: the index is rebuilt only if the window exists
+    bool exists = std::any_of(dockableWindows.begin(), dockableWindows.end(),
+        [&name](const DockableWindow& dockableWindow) { return dockableWindow.label == name; });
+    if (!exists)
+        return nullptr;
+    rebuildIndex();
+    return findInIndex();
 }
 
 bool DockingParams::focusDockableWindow(const std::string& windowName)
@@ -690,7 +1219,23 @@ namespace AddDockableWindowHelper
     };
 
     std::vector<DockableWindowWaitingForAddition> gDockableWindowsToAdd;
-    std::vector<std::string> gDockableWindowsToRemove;
+    std::unordered_set<std::string> gDockableWindowsToRemove;
+
+    void EraseDockableWindows(std::vector<DockableWindow>& dockableWindows, const std::unordered_set<std::string>& labels)
+    {
+        if (labels.empty())
+            return;
+        dockableWindows.erase(
+            std::remove_if(
+                dockableWindows.begin(),
+                dockableWindows.end(),
+                [&labels](const DockableWindow& dockableWindow) {
+                    return labels.find(dockableWindow.label) != labels.end();
+                }
+            ),
+            dockableWindows.end()
+        );
+    }
 
     void AddDockableWindow(const DockableWindow& dockableWindow, bool forceDockspace)
     {
@@ -738,13 +1283,17 @@ namespace AddDockableWindowHelper
 
     void Callback_2_PreNewFrame()
     {
+        auto& dockableWindows = HelloImGui::GetRunnerParams()->dockingParams.dockableWindows;
+
         // Add the dockable windows that have been added as dummy to ImGui to HelloImGui
+        bool wereDockableWindowsModified = false;
         for (auto & dockableWindow: gDockableWindowsToAdd)
         {
             if (dockableWindow.state == DockableWindowAdditionState::AddedAsDummyToImGui)
             {
-                HelloImGui::GetRunnerParams()->dockingParams.dockableWindows.push_back(dockableWindow.dockableWindow);
+                dockableWindows.push_back(std::move(dockableWindow.dockableWindow));
                 dockableWindow.state = DockableWindowAdditionState::AddedToHelloImGui;
+                wereDockableWindowsModified = true;
             }
         }
 
@@ -761,21 +1310,14 @@ namespace AddDockableWindowHelper
         );
 
         // Remove the dockable windows that have been requested to be removed
-        auto& dockableWindows = HelloImGui::GetRunnerParams()->dockingParams.dockableWindows;
-        for (const auto& dockableWindowName: gDockableWindowsToRemove)
-        {
-            dockableWindows.erase(
-                std::remove_if(
-                    dockableWindows.begin(),
-                    dockableWindows.end(),
-                    [&dockableWindowName](const DockableWindow& dockableWindow) {
-                        return dockableWindow.label == dockableWindowName;
-                    }
-                ),
-                dockableWindows.end()
-            );
-        }
+        std::size_t sizeBeforeRemoval = dockableWindows.size();
+        EraseDockableWindows(dockableWindows, gDockableWindowsToRemove);
         gDockableWindowsToRemove.clear();
+        wereDockableWindowsModified = wereDockableWindowsModified || (dockableWindows.size() != sizeBeforeRemoval);
+
+        // Invalidates the index used by dockableWindowOfName
+        if (wereDockableWindowsModified)
+            ++gDockableWindowsGeneration;
     }
 
 } // namespace AddDockableWindowHelper
@@ -788,7 +1330,39 @@ void AddDockableWindow(const DockableWindow& dockableWindow, bool forceDockspace
 
 void RemoveDockableWindow(const std::string& dockableWindowName)
 {
-    AddDockableWindowHelper::gDockableWindowsToRemove.push_back(dockableWindowName);
+    AddDockableWindowHelper::gDockableWindowsToRemove.insert(dockableWindowName);
+}
+
+void AddDockableWindows(const std::vector<DockableWindow>& dockableWindows, bool forceDockspace)
+{
+    for (const auto& dockableWindow: dockableWindows)
+        AddDockableWindowHelper::AddDockableWindow(dockableWindow, forceDockspace);
+}
+
+void RemoveDockableWindows(const std::vector<std::string>& dockableWindowNames)
+{
+    AddDockableWindowHelper::gDockableWindowsToRemove.insert(dockableWindowNames.begin(), dockableWindowNames.end());
+}
+
+DockableWindowVisibility CurrentDockableWindowVisibility()
+{
+    return DockableWindowScheduling::gCurrentVisibility;
+}
+
+std::vector<DockableWindowStats> DockableWindowsStats()
+{
+    std::vector<DockableWindowStats> r;
+    for (const auto& dockableWindow: GetRunnerParams()->dockingParams.dockableWindows)
+        r.push_back(DockableWindowScheduling::GetWindowState(dockableWindow.label).stats);
+    return r;
+}
+
+std::vector<DockableWindowStats> GuiCostStats()
+{
+    std::vector<DockableWindowStats> r = DockableWindowsStats();
+    for (const auto& kv: DockableWindowScheduling::gSectionStates)
+        r.push_back(kv.second.stats);
+    return r;
 }
 
 
@@ -4,6 +4,9 @@
 #include "hello_imgui/runner_params.h"
 #include "hello_imgui/imgui_window_params.h"
 #include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 namespace HelloImGui
 {
@@ -17,6 +20,17 @@ void ProvideWindowOrDock(RunnerParams& runnerParams);
 void CloseWindowOrDock(ImGuiWindowParams& imGuiWindowParams);
 void ShowViewMenu(RunnerParams & runnerParams);
 void ShowDockableWindows(std::vector<DockableWindow>& dockableWindows);
+// Calls guiFunction, and records its cost (see GuiCostStats())
+void MeasureGuiCost(const std::string& sectionName, const VoidFunction& guiFunction);
 }  // namespace DockingDetails
 
+// Implementation of AddDockableWindow(s) and RemoveDockableWindow(s)
+namespace AddDockableWindowHelper
+{
+void Callback_1_GuiRender();
+void Callback_2_PreNewFrame();
+// Removes all the windows whose label is in labels, in a single pass
+void EraseDockableWindows(std::vector<DockableWindow>& dockableWindows, const std::unordered_set<std::string>& labels);
+}  // namespace AddDockableWindowHelper
+
 }  // namespace HelloImGui
\ No newline at end of file
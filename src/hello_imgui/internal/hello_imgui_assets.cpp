@@ -1,4 +1,6 @@
 #include "hello_imgui/hello_imgui_assets.h"
+#include "hello_imgui/internal/hello_imgui_assets_prefetch.h"
+#include "hello_imgui/internal/startup_tracer.h"
 #include "imgui.h"
 
 #ifdef HELLOIMGUI_INSIDE_APPLE_BUNDLE
@@ -15,6 +17,8 @@
 
 #include "hello_imgui/hello_imgui_error.h"
 #include <fstream>
+#include <future>
+#include <map>
 #include <sstream>
 #include <vector>
 #include <stdio.h>
@@ -267,6 +271,10 @@ bool AssetExists(const std::string& assetFilename)
 
 AssetFileData LoadAssetFileData(const char *assetPath)
 {
+    AssetFileData prefetched;
+    if (AssetsPrefetch::TakePrefetchedAsset(assetPath, &prefetched))
+        return prefetched;
+
     #ifdef __ANDROID__
     {
         AssetFileData r;
@@ -332,6 +340,10 @@ AssetFileData LoadAssetFileData_Impl(const char *assetPath)
 
 AssetFileData LoadAssetFileData(const char *assetPath)
 {
+    AssetFileData prefetched;
+    if (AssetsPrefetch::TakePrefetchedAsset(assetPath, &prefetched))
+        return prefetched;
+
     std::string fullPath = assetFileFullPath(assetPath);
     AssetFileData r = LoadAssetFileData_Impl(fullPath.c_str());
     if (!r.data)
@@ -353,4 +365,91 @@ void FreeAssetFileData(AssetFileData * assetFileData)
 #endif // #ifdef HELLOIMGUI_USE_SDL2
 
 
+namespace AssetsPrefetch
+{
+    using PrefetchedAssets = std::map<std::string, AssetFileData>;  // assetPath -> data
+
+    std::future<PrefetchedAssets> gPrefetchFuture;
+    PrefetchedAssets gPrefetchedAssets;
+
+    // Reads a file (given by its full path) without reporting errors: this runs on a worker thread
+    AssetFileData _ReadFile(const std::string& fullPath)
+    {
+    #ifdef HELLOIMGUI_USE_SDL2
+        AssetFileData r;
+        r.data = SDL_LoadFile(fullPath.c_str(), &r.dataSize);
+        return r;
+    #else
+        return LoadAssetFileData_Impl(fullPath.c_str());
+    #endif
+    }
+
+    void _WaitPrefetch()
+    {
+        if (gPrefetchFuture.valid())
+            gPrefetchedAssets = gPrefetchFuture.get();
+    }
+
+    void Prefetch(const std::vector<std::string>& assetPaths)
+    {
+        DiscardPrefetchedAssets();
+    #ifdef __ANDROID__
+        // Android assets are read through SDL and JNI: keep them on the main thread
+        (void)assetPaths;
+    #else
+        // The paths are resolved here, since the assets folders are not protected against concurrent changes
+        std::vector<std::pair<std::string, std::string>> files;  // assetPath, fullPath
+        for (const auto& assetPath: assetPaths)
+        {
+            std::string fullPath = AssetFileFullPath(assetPath, false);
+            if (!fullPath.empty())
+                files.push_back({assetPath, fullPath});
+        }
+        if (files.empty())
+            return;
+
+        #if defined(__EMSCRIPTEN__) && !defined(HELLOIMGUI_EMSCRIPTEN_PTHREAD)
+            auto launchPolicy = std::launch::deferred;  // no threads: the files are read on demand
+        #else
+            auto launchPolicy = std::launch::async;
+        #endif
+        gPrefetchFuture = std::async(launchPolicy, [files]()
+        {
+            StartupTracer::SetThreadName("Assets prefetch");
+            StartupTracer::ScopedEvent traceEvent("Prefetch assets");
+            PrefetchedAssets r;
+            for (const auto& [assetPath, fullPath]: files)
+            {
+                AssetFileData data = _ReadFile(fullPath);
+                if (data.data != nullptr)
+                    r[assetPath] = data;
+            }
+            return r;
+        });
+    #endif
+    }
+
+    bool TakePrefetchedAsset(const std::string& assetPath, AssetFileData* r)
+    {
+        if (!gPrefetchFuture.valid() && gPrefetchedAssets.empty())
+            return false;
+        _WaitPrefetch();
+        auto it = gPrefetchedAssets.find(assetPath);
+        if (it == gPrefetchedAssets.end())
+            return false;
+        *r = it->second;
+        gPrefetchedAssets.erase(it);
+        return true;
+    }
+
+    void DiscardPrefetchedAssets()
+    {
+        _WaitPrefetch();
+        for (auto& [assetPath, data]: gPrefetchedAssets)
+            FreeAssetFileData(&data);
+        gPrefetchedAssets.clear();
+    }
+} // namespace AssetsPrefetch
+
+
 }  // namespace HelloImGui
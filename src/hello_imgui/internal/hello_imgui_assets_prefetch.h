@@ -0,0 +1,25 @@
+#pragma once
+#include "hello_imgui/hello_imgui_assets.h"
+
+#include <string>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    // During startup, asset files (fonts, window icon, ...) are read on a worker thread
+    // while the application window and its rendering context are being created.
+    // LoadAssetFileData() then hands over the prefetched data instead of reading the file again.
+    // (Encapsulated in hello_imgui_assets.cpp)
+    namespace AssetsPrefetch
+    {
+        // Starts reading the given assets in the background (the missing ones are ignored)
+        void Prefetch(const std::vector<std::string>& assetPaths);
+
+        // If assetPath was prefetched, waits for it, transfers its ownership to *r, and returns true.
+        bool TakePrefetchedAsset(const std::string& assetPath, AssetFileData* r);
+
+        // Frees the prefetched data which was not used (called once the window is shown, and by TearDown)
+        void DiscardPrefetchedAssets();
+    }
+}
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <optional>
 
@@ -30,55 +32,108 @@ namespace HelloImGui
             return result;
         };
 
-        std::vector<std::string> _allHelloImGuiIniFilesToSearch()
+        std::vector<std::string> _allHelloImGuiIniFilesToSearch(const std::string& currentFolder)
         {
             std::vector<std::string> allIniFileToSearch;
-
-            std::string currentFolder = std::filesystem::current_path().string();
             for (const auto& folder : _folderAndAllParents(currentFolder))
                 allIniFileToSearch.push_back(folder + "/hello_imgui.ini");
-
             return allIniFileToSearch;
         };
 
-        template<typename T>
-        std::optional<T> _readIniValue(const std::string& iniFilePath, const std::string& sectionName, const std::string& valueName)
+        // Modification time of a candidate file (nullopt if it does not exist)
+        std::optional<std::filesystem::file_time_type> _iniFileWriteTime(const std::string& iniFilePath)
         {
-            if (! std::filesystem::exists(iniFilePath))
+            std::error_code ec;
+            if (!std::filesystem::is_regular_file(iniFilePath, ec))
                 return std::nullopt;
-            if (! std::filesystem::is_regular_file(iniFilePath))
+            auto writeTime = std::filesystem::last_write_time(iniFilePath, ec);
+            if (ec)
                 return std::nullopt;
+            return writeTime;
+        }
 
-            try
-            {
+        // The merged content of all the hello_imgui.ini files, for a given folder. Immutable once built.
+        struct ConfigSnapshot
+        {
+            std::string Folder;
+            ini::IniFile Merged;
+            // All the candidate files, with their modification time (used by ReloadIfChanged)
+            std::vector<std::pair<std::string, std::optional<std::filesystem::file_time_type>>> Candidates;
+        };
 
-                std::optional<T> result = std::nullopt;
-                ini::IniFile ini;
-                ini.load(iniFilePath);
-                if (ini.find(sectionName) != ini.end())
+        std::shared_ptr<const ConfigSnapshot> _buildSnapshot(const std::string& folder)
+        {
+            auto snapshot = std::make_shared<ConfigSnapshot>();
+            snapshot->Folder = folder;
+            // From the deepest folder to the root: the values which are already present are not overwritten
+            for (const auto& iniFile: _allHelloImGuiIniFilesToSearch(folder))
+            {
+                auto writeTime = _iniFileWriteTime(iniFile);
+                snapshot->Candidates.push_back({iniFile, writeTime});
+                if (!writeTime.has_value())
+                    continue;
+                try
+                {
+                    ini::IniFile ini;
+                    ini.load(iniFile);
+                    for (const auto& [sectionName, section]: ini)
+                        for (const auto& [valueName, field]: section)
+                            snapshot->Merged[sectionName].emplace(valueName, field);
+                }
+                catch(...)
                 {
-                    auto& section = ini.at(sectionName);
-                    if (section.find(valueName) != section.end())
-                        result =  ini[sectionName][valueName].as<T>();
                 }
-                return result;
             }
-            catch(...)
+            return snapshot;
+        }
+
+        std::mutex gSnapshotMutex;
+        std::shared_ptr<const ConfigSnapshot> gSnapshot;
+
+        std::shared_ptr<const ConfigSnapshot> _currentSnapshot()
+        {
+            std::error_code ec;
+            std::string currentFolder = std::filesystem::current_path(ec).string();
+            std::lock_guard<std::mutex> lock(gSnapshotMutex);
+            if (!gSnapshot || gSnapshot->Folder != currentFolder)
+                gSnapshot = _buildSnapshot(currentFolder);
+            return gSnapshot;
+        }
+
+        bool ReloadIfChanged()
+        {
+            std::lock_guard<std::mutex> lock(gSnapshotMutex);
+            if (!gSnapshot)
+                return false;
+            for (const auto& [iniFile, writeTime]: gSnapshot->Candidates)
             {
-                return std::nullopt;
+                if (_iniFileWriteTime(iniFile) != writeTime)
+                {
+                    gSnapshot = _buildSnapshot(gSnapshot->Folder);
+                    return true;
+                }
             }
-        };
+            return false;
+        }
 
         template <typename T>
         std::optional<T> _readIniValueInParentFolders(const std::string& sectionName, const std::string& valueName)
         {
-            for (const auto& iniFile: _allHelloImGuiIniFilesToSearch())
+            auto snapshot = _currentSnapshot();
+            auto itSection = snapshot->Merged.find(sectionName);
+            if (itSection == snapshot->Merged.end())
+                return std::nullopt;
+            auto itValue = itSection->second.find(valueName);
+            if (itValue == itSection->second.end())
+                return std::nullopt;
+            try
             {
-                auto value = _readIniValue<T>(iniFile, sectionName, valueName);
-                if (value.has_value())
-                    return value;
+                return itValue->second.as<T>();
+            }
+            catch(...)
+            {
+                return std::nullopt;
             }
-            return std::nullopt;
         };
 
 
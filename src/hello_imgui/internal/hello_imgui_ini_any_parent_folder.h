@@ -7,9 +7,19 @@ namespace HelloImGui
 {
     namespace HelloImGuiIniAnyParentFolder
     {
+        // Read settings from the hello_imgui.ini files located in the current folder or any of its parents
+        // (when a value is present in several files, the one in the deepest folder wins).
+        //
+        // The files are discovered and parsed once, into a merged snapshot, and the lookups are answered from memory.
+        // The snapshot is rebuilt when the current folder changes.
         std::optional<float> readFloatValue(const std::string &sectionName, const std::string &valueName);
         std::optional<bool> readBoolValue(const std::string &sectionName, const std::string &valueName);
         std::optional<std::string> readStringValue(const std::string &sectionName, const std::string &valueName);
         std::optional<int> readIntValue(const std::string &sectionName, const std::string &valueName);
+
+        // Optional: takes into account the hello_imgui.ini files which were created, modified or removed
+        // since the snapshot was built. Returns true if the snapshot was rebuilt.
+        // (this checks the modification time of each candidate file: do not call it at every frame)
+        bool ReloadIfChanged();
     }
-}
\ No newline at end of file
+}
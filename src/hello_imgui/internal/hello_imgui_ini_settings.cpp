@@ -1,7 +1,10 @@
 #include "hello_imgui/internal/hello_imgui_ini_settings.h"
 #include "hello_imgui/internal/inicpp.h"
 #include "hello_imgui/internal/functional_utils.h"
+#include "hello_imgui/internal/startup_tracer.h"
 #include "imgui_internal.h"
+#include <future>
+#include <unordered_set>
 
 
 namespace HelloImGui
@@ -167,15 +170,46 @@ namespace HelloImGui
         }
 
 
+        std::string gPrefetchedIniFilename;
+        std::shared_future<std::string> gPrefetchedIniContent;
+
+        void PrefetchIniFile(const std::string& iniPartsFilename)
+        {
+            #if defined(__EMSCRIPTEN__) && !defined(HELLOIMGUI_EMSCRIPTEN_PTHREAD)
+                auto launchPolicy = std::launch::deferred;  // no threads: the file is read on demand
+            #else
+                auto launchPolicy = std::launch::async;
+            #endif
+            gPrefetchedIniFilename = iniPartsFilename;
+            gPrefetchedIniContent = std::async(launchPolicy, [iniPartsFilename]()
+            {
+                StartupTracer::SetThreadName("Ini prefetch");
+                StartupTracer::ScopedEvent traceEvent("Prefetch ini file");
+                return FunctionalUtils::read_text_file_or_empty(iniPartsFilename);
+            }).share();
+        }
+
+        void DiscardPrefetchedIniFile()
+        {
+            gPrefetchedIniFilename.clear();
+            gPrefetchedIniContent = {};
+        }
+
         IniParts IniParts::LoadFromFile(const std::string& iniPartsFilename)
         {
-            std::string iniPartsContent = FunctionalUtils::read_text_file_or_empty(iniPartsFilename);
+            std::string iniPartsContent;
+            if (gPrefetchedIniContent.valid() && iniPartsFilename == gPrefetchedIniFilename)
+                iniPartsContent = gPrefetchedIniContent.get();
+            else
+                iniPartsContent = FunctionalUtils::read_text_file_or_empty(iniPartsFilename);
             auto iniParts = SplitIniParts(iniPartsContent);
             return iniParts;
         }
 
         void IniParts::WriteToFile(const std::string& iniPartsFilename)
         {
+            if (iniPartsFilename == gPrefetchedIniFilename)
+                DiscardPrefetchedIniFile();
             std::string iniPartsContent = JoinIniParts(*this);
             FunctionalUtils::write_text_file(iniPartsFilename, iniPartsContent);
         }
@@ -321,21 +355,19 @@ namespace HelloImGui
             auto iniPartContent = iniParts.GetIniPart(iniPartName);
             std::stringstream ss(iniPartContent);
 
-            std::vector<std::string> windowsWithSettings;
+            std::unordered_set<std::string> windowsWithSettings;
             std::string line;
             while (ss)
             {
                 std::getline (ss, line);
                 std::string w = details::_windowNameInImguiIniLine(line);
                 if (!w.empty())
-                    windowsWithSettings.push_back(w);
+                    windowsWithSettings.insert(w);
             }
 
             for (const auto& dockableWindow: dockingParams.dockableWindows)
             {
-                if (
-                std::find(windowsWithSettings.begin(), windowsWithSettings.end(), dockableWindow.label)
-                == windowsWithSettings.end())
+                if (windowsWithSettings.find(dockableWindow.label) == windowsWithSettings.end())
                 {
                     return false;
                 }
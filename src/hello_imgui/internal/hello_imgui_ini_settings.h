@@ -56,6 +56,12 @@ namespace HelloImGui
         IniParts SplitIniParts(const std::string& s);
         std::string JoinIniParts(const IniParts& parts);
 
+        // During startup, the ini file is read once on a worker thread (while the window is being created),
+        // and its content is shared by all the IniParts::LoadFromFile calls, until it is discarded
+        // or written to.
+        void PrefetchIniFile(const std::string& iniPartsFilename);
+        void DiscardPrefetchedIniFile();
+
         //
         // The settings below are global to the app
         //
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "imgui.h"
+#include "hello_imgui/internal/compressed_texture.h"
 
 #include <memory>
 
@@ -13,6 +14,10 @@ namespace HelloImGui
          int Height = 0;
          virtual ImTextureID TextureID() = 0;
 
+         // If true, the mipmaps are generated, and the texture is sampled with trilinear filtering
+         // (set it before storing the texture; implemented with OpenGL only)
+         bool UseMipmaps = false;
+
         ImageAbstract() = default;
         virtual ~ImageAbstract();
 
@@ -22,6 +27,10 @@ namespace HelloImGui
             _impl_StoreTexture(width, height, image_data_rgba);
         };
         virtual void _impl_ReleaseTexture() = 0;
+
+        // Stores a pre-compressed texture (with its mipmaps, if any).
+        // Returns false if the rendering backend does not support its format: the caller then falls back to RGBA8.
+        virtual bool _impl_StoreCompressedTexture(const CompressedTexture& texture) { (void)texture; return false; }
     };
 
     using ImageAbstractPtr = std::shared_ptr<ImageAbstract>;
@@ -0,0 +1,172 @@
+#include "hello_imgui/internal/image_atlas.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace HelloImGui
+{
+    // Images which were not displayed during the last frames may be evicted, to make room for new ones
+    static constexpr int kFramesBeforeEviction = 60;
+
+    ImageAtlas::ImageAtlas(const ImageAtlasParams& params, TextureUploader textureUploader)
+        : mParams(params), mTextureUploader(std::move(textureUploader))
+    {
+        mParams.padding = std::max(mParams.padding, 0);
+    }
+
+    bool ImageAtlas::CanContain(int width, int height) const
+    {
+        int paddedMaxSize = std::min(mParams.maxImageSize, mParams.pageSize - 2 * mParams.padding);
+        return width > 0 && height > 0 && width <= paddedMaxSize && height <= paddedMaxSize;
+    }
+
+    void ImageAtlas::_AddPage()
+    {
+        Page page { ImageAtlasPacker(mParams.pageSize, mParams.pageSize), {}, nullptr, false };
+        page.Pixels.resize((size_t)mParams.pageSize * mParams.pageSize * 4, 0);
+        mPages.push_back(std::move(page));
+    }
+
+    // Copies the image inside the padded rectangle, and repeats its border pixels in the padding
+    // (so that the linear filtering does not sample the neighbour images)
+    void ImageAtlas::_CopyToPage(Page& page, const ImageAtlasPacker::Rect& paddedRect, int width, int height, const unsigned char* image_data_rgba)
+    {
+        int padding = mParams.padding;
+        for (int py = 0; py < paddedRect.h; ++py)
+        {
+            int srcY = std::clamp(py - padding, 0, height - 1);
+            unsigned char* dstLine = page.Pixels.data() + ((size_t)(paddedRect.y + py) * mParams.pageSize + paddedRect.x) * 4;
+            const unsigned char* srcLine = image_data_rgba + (size_t)srcY * width * 4;
+            for (int px = 0; px < padding; ++px)
+                memcpy(dstLine + px * 4, srcLine, 4);
+            memcpy(dstLine + padding * 4, srcLine, (size_t)width * 4);
+            for (int px = padding + width; px < paddedRect.w; ++px)
+                memcpy(dstLine + px * 4, srcLine + (width - 1) * 4, 4);
+        }
+        page.Dirty = true;
+    }
+
+    bool ImageAtlas::Insert(const std::string& name, int width, int height, const unsigned char* image_data_rgba, int frameIndex)
+    {
+        Remove(name);
+        if (!CanContain(width, height))
+            return false;
+
+        int paddedWidth = width + 2 * mParams.padding, paddedHeight = height + 2 * mParams.padding;
+        int packerId = mNextPackerId++;
+        ImageAtlasPacker::Rect rect;
+        int pageIndex = -1;
+        for (int i = 0; i < (int)mPages.size() && pageIndex < 0; ++i)
+            if (mPages[i].Packer.Insert(packerId, paddedWidth, paddedHeight, &rect))
+                pageIndex = i;
+        if (pageIndex < 0 && (int)mPages.size() < mParams.maxPages)
+        {
+            _AddPage();
+            pageIndex = (int)mPages.size() - 1;
+            mPages[pageIndex].Packer.Insert(packerId, paddedWidth, paddedHeight, &rect);
+        }
+        if (pageIndex < 0)
+        {
+            mDefragmentationRequested = true;
+            return false;
+        }
+
+        Page& page = mPages[pageIndex];
+        _CopyToPage(page, rect, width, height, image_data_rgba);
+        // A new page needs a texture id now; later changes are uploaded by FlushUploads
+        if (page.Texture == nullptr)
+        {
+            mTextureUploader(page.Texture, mParams.pageSize, mParams.pageSize, page.Pixels.data());
+            page.Dirty = false;
+        }
+        mEntries[name] = Entry { pageIndex, packerId, width, height, frameIndex };
+        return true;
+    }
+
+    void ImageAtlas::Remove(const std::string& name)
+    {
+        auto it = mEntries.find(name);
+        if (it == mEntries.end())
+            return;
+        mPages[it->second.PageIndex].Packer.Remove(it->second.PackerId);
+        mEntries.erase(it);
+    }
+
+    bool ImageAtlas::Find(const std::string& name, int frameIndex, ImageAndSize* out)
+    {
+        auto it = mEntries.find(name);
+        if (it == mEntries.end())
+            return false;
+        Entry& entry = it->second;
+        entry.LastUsedFrame = frameIndex;
+
+        const Page& page = mPages[entry.PageIndex];
+        const ImageAtlasPacker::Rect& rect = page.Packer.Rects().at(entry.PackerId);
+        float pageSize = (float)mParams.pageSize;
+        out->textureId = page.Texture->TextureID();
+        out->size = ImVec2((float)entry.Width, (float)entry.Height);
+        out->uv0 = ImVec2((float)(rect.x + mParams.padding) / pageSize, (float)(rect.y + mParams.padding) / pageSize);
+        out->uv1 = ImVec2((float)(rect.x + mParams.padding + entry.Width) / pageSize, (float)(rect.y + mParams.padding + entry.Height) / pageSize);
+        return true;
+    }
+
+    void ImageAtlas::_DefragmentPage(int pageIndex, int frameIndex)
+    {
+        Page& page = mPages[pageIndex];
+
+        // Evict the images which were not displayed recently
+        for (auto it = mEntries.begin(); it != mEntries.end(); )
+        {
+            const Entry& entry = it->second;
+            if (entry.PageIndex == pageIndex && frameIndex - entry.LastUsedFrame > kFramesBeforeEviction)
+            {
+                page.Packer.Remove(entry.PackerId);
+                it = mEntries.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        // Repack the remaining images, and move their pixels
+        auto oldRects = page.Packer.Rects();
+        if (!page.Packer.Repack())
+            return;
+        std::vector<unsigned char> newPixels(page.Pixels.size(), 0);
+        size_t pageStride = (size_t)mParams.pageSize * 4;
+        for (const auto& [packerId, newRect]: page.Packer.Rects())
+        {
+            const auto& oldRect = oldRects.at(packerId);
+            for (int y = 0; y < newRect.h; ++y)
+                memcpy(newPixels.data() + (size_t)(newRect.y + y) * pageStride + (size_t)newRect.x * 4,
+                       page.Pixels.data() + (size_t)(oldRect.y + y) * pageStride + (size_t)oldRect.x * 4,
+                       (size_t)newRect.w * 4);
+        }
+        page.Pixels.swap(newPixels);
+        page.Dirty = true;
+    }
+
+    void ImageAtlas::FlushUploads(int frameIndex)
+    {
+        if (mDefragmentationRequested)
+        {
+            mDefragmentationRequested = false;
+            for (int i = 0; i < (int)mPages.size(); ++i)
+                _DefragmentPage(i, frameIndex);
+        }
+        for (Page& page: mPages)
+        {
+            if (!page.Dirty)
+                continue;
+            mTextureUploader(page.Texture, mParams.pageSize, mParams.pageSize, page.Pixels.data());
+            page.Dirty = false;
+        }
+    }
+
+    bool ImageAtlas::HasPendingUploads() const
+    {
+        if (mDefragmentationRequested)
+            return true;
+        return std::any_of(mPages.begin(), mPages.end(), [](const Page& p) { return p.Dirty; });
+    }
+}
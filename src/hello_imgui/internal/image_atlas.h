@@ -0,0 +1,73 @@
+#pragma once
+#include "hello_imgui/image_from_asset.h"
+#include "hello_imgui/internal/image_abstract.h"
+#include "hello_imgui/internal/image_atlas_packer.h"
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    // ImageAtlas packs small images into shared textures ("pages"), so that many icons are drawn
+    // with the same texture (instead of one texture, and one draw call, per icon). See ImageAtlasParams.
+    //
+    // The pixels of the pages are kept in memory, and the textures are updated at the start of the next frame
+    // (FlushUploads): the texture ids and the UVs used by the draw commands of the current frame stay valid.
+    // As a consequence, an image inserted into an existing page is visible one frame later.
+    class ImageAtlas
+    {
+    public:
+        // Creates the texture if it is null, or updates it (its texture id may change)
+        using TextureUploader = std::function<void(ImageAbstractPtr& texture, int width, int height, unsigned char* image_data_rgba)>;
+
+        ImageAtlas(const ImageAtlasParams& params, TextureUploader textureUploader);
+
+        // True if the image is small enough for the atlas
+        bool CanContain(int width, int height) const;
+
+        // Returns false if the image does not fit (all the pages are full): it shall then use its own texture.
+        // A later FlushUploads() will try to make room (by evicting unused images and repacking the pages).
+        bool Insert(const std::string& name, int width, int height, const unsigned char* image_data_rgba, int frameIndex);
+        void Remove(const std::string& name);
+
+        // Returns false if the image is not in the atlas (e.g. if it was evicted)
+        bool Find(const std::string& name, int frameIndex, ImageAndSize* out);
+
+        // Call this at the start of a frame, before any image of the atlas is used
+        void FlushUploads(int frameIndex);
+        bool HasPendingUploads() const;
+
+        int NbPages() const { return (int)mPages.size(); }
+        int NbImages() const { return (int)mEntries.size(); }
+
+    private:
+        struct Page
+        {
+            ImageAtlasPacker Packer;
+            std::vector<unsigned char> Pixels;  // RGBA
+            ImageAbstractPtr Texture;
+            bool Dirty = false;
+        };
+        struct Entry
+        {
+            int PageIndex;
+            int PackerId;
+            int Width, Height;
+            int LastUsedFrame;
+        };
+
+        void _AddPage();
+        void _CopyToPage(Page& page, const ImageAtlasPacker::Rect& paddedRect, int width, int height, const unsigned char* image_data_rgba);
+        void _DefragmentPage(int pageIndex, int frameIndex);
+
+        ImageAtlasParams mParams;
+        TextureUploader mTextureUploader;
+        std::vector<Page> mPages;
+        std::unordered_map<std::string, Entry> mEntries;
+        int mNextPackerId = 0;
+        bool mDefragmentationRequested = false;
+    };
+}
@@ -0,0 +1,151 @@
+#include "hello_imgui/internal/image_atlas_packer.h"
+
+#include <algorithm>
+
+
+namespace HelloImGui
+{
+    ImageAtlasPacker::ImageAtlasPacker(int pageWidth, int pageHeight)
+        : mPageWidth(pageWidth), mPageHeight(pageHeight)
+    {
+    }
+
+    // Returns the x of the first free segment which is wide enough (or -1)
+    int ImageAtlasPacker::_FindFreeSegment(const Shelf& shelf, int w)
+    {
+        for (const auto& [x, segmentWidth]: shelf.FreeSegments)
+            if (segmentWidth >= w)
+                return x;
+        return -1;
+    }
+
+    void ImageAtlasPacker::_TakeFreeSegment(Shelf& shelf, int x, int w)
+    {
+        int segmentWidth = shelf.FreeSegments.at(x);
+        shelf.FreeSegments.erase(x);
+        if (segmentWidth > w)
+            shelf.FreeSegments[x + w] = segmentWidth - w;
+    }
+
+    bool ImageAtlasPacker::Insert(int id, int w, int h, Rect* outRect)
+    {
+        if (w <= 0 || h <= 0 || w > mPageWidth || h > mPageHeight || mRects.count(id) > 0)
+            return false;
+
+        auto fnPlace = [&](Shelf& shelf, int x) {
+            _TakeFreeSegment(shelf, x, w);
+            Rect r { x, shelf.y, w, h };
+            mRects[id] = r;
+            if (outRect)
+                *outRect = r;
+            return true;
+        };
+
+        // 1. the shelf which fits best: tall enough, and wasting less than a third of its height
+        Shelf* bestShelf = nullptr;
+        int bestX = -1;
+        for (Shelf& shelf: mShelves)
+        {
+            bool goodFit = shelf.h >= h && (shelf.h - h) * 3 <= shelf.h;
+            if (!goodFit || (bestShelf != nullptr && shelf.h >= bestShelf->h))
+                continue;
+            int x = _FindFreeSegment(shelf, w);
+            if (x >= 0)
+            {
+                bestShelf = &shelf;
+                bestX = x;
+            }
+        }
+        if (bestShelf != nullptr)
+            return fnPlace(*bestShelf, bestX);
+
+        // 2. a new shelf
+        if (_ShelvesBottom() + h <= mPageHeight)
+        {
+            Shelf shelf { _ShelvesBottom(), h, {} };
+            shelf.FreeSegments[0] = mPageWidth;
+            mShelves.push_back(shelf);
+            return fnPlace(mShelves.back(), 0);
+        }
+
+        // 3. any shelf which is tall enough
+        for (Shelf& shelf: mShelves)
+        {
+            int x = _FindFreeSegment(shelf, w);
+            if (shelf.h >= h && x >= 0)
+                return fnPlace(shelf, x);
+        }
+        return false;
+    }
+
+    void ImageAtlasPacker::Remove(int id)
+    {
+        auto itRect = mRects.find(id);
+        if (itRect == mRects.end())
+            return;
+        Rect r = itRect->second;
+        mRects.erase(itRect);
+
+        auto itShelf = std::find_if(mShelves.begin(), mShelves.end(), [&r](const Shelf& s) { return s.y == r.y; });
+        if (itShelf == mShelves.end())
+            return;
+        auto& segments = itShelf->FreeSegments;
+
+        // Give back the segment, and merge it with its free neighbours
+        int x = r.x, w = r.w;
+        auto next = segments.lower_bound(x);
+        if (next != segments.end() && next->first == x + w)
+        {
+            w += next->second;
+            next = segments.erase(next);
+        }
+        if (next != segments.begin())
+        {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == x)
+            {
+                x = prev->first;
+                w += prev->second;
+                segments.erase(prev);
+            }
+        }
+        segments[x] = w;
+
+        // Empty shelves at the bottom are released
+        while (!mShelves.empty())
+        {
+            const auto& lastSegments = mShelves.back().FreeSegments;
+            bool isEmpty = lastSegments.size() == 1 && lastSegments.begin()->second == mPageWidth;
+            if (!isEmpty)
+                break;
+            mShelves.pop_back();
+        }
+    }
+
+    bool ImageAtlasPacker::Repack()
+    {
+        std::vector<std::pair<int, Rect>> rects(mRects.begin(), mRects.end());
+        std::sort(rects.begin(), rects.end(), [](const auto& a, const auto& b) {
+            if (a.second.h != b.second.h)
+                return a.second.h > b.second.h;
+            if (a.second.w != b.second.w)
+                return a.second.w > b.second.w;
+            return a.first < b.first;
+        });
+
+        ImageAtlasPacker repacked(mPageWidth, mPageHeight);
+        for (const auto& [id, rect]: rects)
+            if (!repacked.Insert(id, rect.w, rect.h, nullptr))
+                return false;
+        *this = repacked;
+        return true;
+    }
+
+    long long ImageAtlasPacker::UsedArea() const
+    {
+        long long r = 0;
+        for (const auto& [id, rect]: mRects)
+            r += (long long)rect.w * rect.h;
+        return r;
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <map>
+#include <vector>
+
+namespace HelloImGui
+{
+    // ImageAtlasPacker places rectangles inside an atlas page (shelf packing), with incremental insertion and removal.
+    //
+    // The page is divided into horizontal shelves: a rectangle goes into a shelf which is tall enough
+    // (but not much taller), and the space freed by the removed rectangles is reused by later insertions.
+    // When the free space is too fragmented, Repack() places all the rectangles again, tallest first.
+    //
+    // The rectangles include the padding: the caller adds it to the image size.
+    class ImageAtlasPacker
+    {
+    public:
+        struct Rect
+        {
+            int x = 0, y = 0, w = 0, h = 0;
+            bool operator==(const Rect& o) const { return x == o.x && y == o.y && w == o.w && h == o.h; }
+        };
+
+        ImageAtlasPacker(int pageWidth, int pageHeight);
+
+        // Returns false if there is no room for the rectangle
+        bool Insert(int id, int w, int h, Rect* outRect);
+        void Remove(int id);
+
+        // Places all the rectangles again (tallest first). Returns false, and changes nothing, if they do not fit.
+        // After this, use Rects() to get their new positions.
+        bool Repack();
+
+        const std::map<int, Rect>& Rects() const { return mRects; }
+        int PageWidth() const { return mPageWidth; }
+        int PageHeight() const { return mPageHeight; }
+        long long UsedArea() const;
+        bool IsEmpty() const { return mRects.empty(); }
+
+    private:
+        struct Shelf
+        {
+            int y, h;
+            std::map<int, int> FreeSegments;  // x -> width
+        };
+        static int _FindFreeSegment(const Shelf& shelf, int w);
+        static void _TakeFreeSegment(Shelf& shelf, int x, int w);
+        int _ShelvesBottom() const { return mShelves.empty() ? 0 : mShelves.back().y + mShelves.back().h; }
+
+        int mPageWidth, mPageHeight;
+        std::vector<Shelf> mShelves;  // Sorted by y
+        std::map<int, Rect> mRects;   // id -> rect
+    };
+}
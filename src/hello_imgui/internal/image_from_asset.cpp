@@ -1,6 +1,9 @@
 #include "hello_imgui/image_from_asset.h"
 
 #include "hello_imgui/internal/image_abstract.h"
+#include "hello_imgui/internal/image_atlas.h"
+#include "hello_imgui/internal/compressed_texture.h"
+#include "hello_imgui/internal/backend_impls/abstract_runner.h"
 #include "hello_imgui/hello_imgui.h"
 #include "image_opengl.h"
 #include "image_dx11.h"
@@ -13,11 +16,14 @@
 #include "imgui.h"
 #include "hello_imgui/hello_imgui_assets.h"
 #include "hello_imgui/hello_imgui_logger.h"
+#include "hello_imgui/pixel_conversion.h"
 #include "stb_image.h"
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <stdexcept>
+#include <vector>
 
 
 namespace HelloImGui
@@ -37,10 +43,28 @@ namespace HelloImGui
 
     static std::unordered_map<std::string, ImageAbstractPtr > gImageFromAssetMap;
 
+    AbstractRunner *GetAbstractRunner();
 
-    static ImageAbstractPtr _GetImageFromMemory(int width, int height, unsigned char* image_data_rgba)
+    // When displaying remotely, the remote display needs a copy of the image
+    static void _MirrorOnRemoteDisplay(const ImageAbstractPtr& concreteImage, int width, int height, unsigned char* image_data_rgba)
     {
+        AbstractRunner* runner = GetAbstractRunner();
+        if (runner == nullptr || concreteImage == nullptr)
+            return;
+        runner->GetRemoteDisplayHandler().SetUserTexture(concreteImage->TextureID(), width, height, image_data_rgba);
+    }
+
+    static void _RemoveFromRemoteDisplay(const ImageAbstractPtr& concreteImage)
+    {
+        AbstractRunner* runner = GetAbstractRunner();
+        if (runner == nullptr || concreteImage == nullptr)
+            return;
+        runner->GetRemoteDisplayHandler().RemoveUserTexture(concreteImage->TextureID());
+    }
 
+
+    static ImageAbstractPtr _CreateConcreteImage()
+    {
         HelloImGui::RendererBackendType rendererBackendType = HelloImGui::GetRunnerParams()->rendererBackendType;
         ImageAbstractPtr concreteImage;
 
@@ -61,19 +85,27 @@ namespace HelloImGui
                 concreteImage = std::make_shared<ImageDx11>();
         #endif
         if (concreteImage == nullptr)
-        {
             HelloImGui::Log(LogLevel::Warning, "_GetImageFromMemory: not implemented for this rendering backend!");
+        return concreteImage;
+    }
+
+    static ImageAbstractPtr _GetImageFromMemory(int width, int height, unsigned char* image_data_rgba, bool useMipmaps)
+    {
+        ImageAbstractPtr concreteImage = _CreateConcreteImage();
+        if (concreteImage == nullptr)
             return nullptr;
-        }
 
         IM_ASSERT(image_data_rgba != nullptr && width > 0 && height > 0 && "_GetImageFromMemory: image_data_rgba is empty!");
     
+        concreteImage->UseMipmaps = useMipmaps;
         concreteImage->_impl_StoreTexture(width, height, image_data_rgba);
+        concreteImage->Width = width;
+        concreteImage->Height = height;
 
         return concreteImage;
     }
 
-    static bool _UpdateImageFromMemory(ImageAbstractPtr & concreteImage, unsigned char * image_data_rgba, int width, int height)
+    static bool _UpdateImageFromMemory(ImageAbstractPtr & concreteImage, unsigned char * image_data_rgba, int width, int height, bool useMipmaps = false)
     {
 
         if (image_data_rgba == nullptr || width <= 0 || height <= 0)
@@ -83,37 +115,200 @@ namespace HelloImGui
         }
 
         if(!concreteImage) {
-            concreteImage = _GetImageFromMemory(width, height, image_data_rgba);
+            concreteImage = _GetImageFromMemory(width, height, image_data_rgba, useMipmaps);
+            _MirrorOnRemoteDisplay(concreteImage, width, height, image_data_rgba);
             return true;
         }
         
+        // The texture id may change during the upload
+        _RemoveFromRemoteDisplay(concreteImage);
         concreteImage->_impl_UploadTexture(width, height, image_data_rgba);
+        concreteImage->Width = width;
+        concreteImage->Height = height;
+        _MirrorOnRemoteDisplay(concreteImage, width, height, image_data_rgba);
         return false;
     }
 
-    static ImageAbstractPtr _GetCachedAssetImage(const char*assetPath, bool updateCache = false)
+    // An image decoded by stb_image, as RGBA pixels.
+    // Gray and RGB images are decoded with their own channels, and then converted by PixelConversion
+    // (which is faster than the conversion inside stb_image)
+    struct _DecodedRgbaImage
     {
-        
+        int Width = 0, Height = 0;
+        unsigned char* Rgba = nullptr;  // nullptr if the image could not be decoded
+
+        _DecodedRgbaImage(const unsigned char* data, int dataSize)
+        {
+            int nbChannels = 0;
+            if (!stbi_info_from_memory(data, dataSize, &Width, &Height, &nbChannels))
+                return;
+            bool isConverted = (nbChannels == 1 || nbChannels == 3);
+            mStbPixels = stbi_load_from_memory(data, dataSize, &Width, &Height, &nbChannels, isConverted ? 0 : 4);
+            if (mStbPixels == nullptr || !isConverted)
+            {
+                Rgba = mStbPixels;
+                return;
+            }
+            size_t nbPixels = (size_t)Width * (size_t)Height;
+            mConvertedPixels.resize(nbPixels * 4);
+            if (nbChannels == 1)
+                PixelConversion::GrayToRgba(mStbPixels, mConvertedPixels.data(), nbPixels);
+            else
+                PixelConversion::RgbToRgba(mStbPixels, mConvertedPixels.data(), nbPixels);
+            stbi_image_free(mStbPixels);
+            mStbPixels = nullptr;
+            Rgba = mConvertedPixels.data();
+        }
+        ~_DecodedRgbaImage()
+        {
+            if (mStbPixels != nullptr)
+                stbi_image_free(mStbPixels);
+        }
+        _DecodedRgbaImage(const _DecodedRgbaImage&) = delete;
+        _DecodedRgbaImage& operator=(const _DecodedRgbaImage&) = delete;
+
+    private:
+        unsigned char* mStbPixels = nullptr;
+        std::vector<unsigned char> mConvertedPixels;
+    };
+
+    // "maps/world.png" => {"maps/world.ktx2", "maps/world.dds"}
+    static std::vector<std::string> _SiblingAssets(const std::string& assetPath, const std::vector<std::string>& extensions)
+    {
+        std::string stem = assetPath;
+        size_t dotPos = stem.find_last_of('.');
+        if (dotPos != std::string::npos && stem.find_first_of("/\\", dotPos) == std::string::npos)
+            stem = stem.substr(0, dotPos);
+        std::vector<std::string> r;
+        for (const auto& extension: extensions)
+        {
+            std::string sibling = stem + extension;
+            if (sibling != assetPath && AssetExists(sibling))
+                r.push_back(sibling);
+        }
+        return r;
+    }
+
+    // Returns nullptr if the file is invalid, or if the rendering backend does not support its format
+    static ImageAbstractPtr _GetCompressedImageFromAsset(const std::string& assetPath)
+    {
+        auto assetData = LoadAssetFileData(assetPath.c_str());
+        CompressedTexture compressedTexture;
+        std::string error;
+        ImageAbstractPtr concreteImage;
+        if (!ParseCompressedTexture(assetData.data, assetData.dataSize, &compressedTexture, &error))
+            HelloImGui::Log(LogLevel::Warning, "ImageFromAsset: cannot load %s (%s)", assetPath.c_str(), error.c_str());
+        else
+        {
+            concreteImage = _CreateConcreteImage();
+            if (concreteImage && !concreteImage->_impl_StoreCompressedTexture(compressedTexture))
+            {
+                HelloImGui::Log(LogLevel::Info, "ImageFromAsset: the format of %s is not supported by the rendering backend", assetPath.c_str());
+                concreteImage = nullptr;
+            }
+        }
+        FreeAssetFileData(&assetData);
+        if (concreteImage)
+        {
+            concreteImage->Width = compressedTexture.Width();
+            concreteImage->Height = compressedTexture.Height();
+        }
+        return concreteImage;
+    }
+
+    // Returns the pre-compressed version of the image (see ImageLoadingParams), or nullptr.
+    // If the asset itself is pre-compressed but cannot be used, *decodedAssetPath is its .png or .jpg version.
+    static ImageAbstractPtr _GetCompressedImageFromAsset_IfAvailable(const std::string& assetPath, std::string* decodedAssetPath)
+    {
+        *decodedAssetPath = assetPath;
+        bool isCompressedAsset = IsCompressedTextureFilename(assetPath);
+        if (!isCompressedAsset && !HelloImGui::GetRunnerParams()->imageLoadingParams.useCompressedTextures)
+            return nullptr;
+
+        std::vector<std::string> candidates;
+        if (isCompressedAsset)
+            candidates.push_back(assetPath);
+        else
+            candidates = _SiblingAssets(assetPath, {".ktx2", ".dds"});
+        for (const auto& candidate: candidates)
+            if (auto concreteImage = _GetCompressedImageFromAsset(candidate))
+                return concreteImage;
+
+        if (isCompressedAsset)
+        {
+            auto fallbacks = _SiblingAssets(assetPath, {".png", ".jpg", ".jpeg"});
+            if (fallbacks.empty())
+            {
+                HelloImGui::Log(LogLevel::Error, "ImageFromAsset: cannot use %s, and there is no .png or .jpg fallback", assetPath.c_str());
+                IM_ASSERT(false && "_GetCachedAssetImage: Failed to load compressed image!");
+                throw std::runtime_error("_GetCachedImage: Failed to load compressed image!");
+            }
+            *decodedAssetPath = fallbacks.front();
+        }
+        return nullptr;
+    }
+
+    // Small images from the assets may be packed into an atlas (see ImageAtlasParams)
+    static std::unique_ptr<ImageAtlas> gImageAtlas;
+
+    static ImageAtlas* _GetImageAtlas()
+    {
+        const auto& atlasParams = HelloImGui::GetRunnerParams()->imageAtlasParams;
+        if (!atlasParams.enabled)
+            return nullptr;
+        if (!gImageAtlas)
+            gImageAtlas = std::make_unique<ImageAtlas>(atlasParams,
+                [](ImageAbstractPtr& texture, int width, int height, unsigned char* image_data_rgba) {
+                    _UpdateImageFromMemory(texture, image_data_rgba, width, height);
+                });
+        return gImageAtlas.get();
+    }
+
+    static ImageAndSize _ImageAndSizeOf(const ImageAbstractPtr& concreteImage)
+    {
+        if (concreteImage == nullptr)
+            return {};
+        return {concreteImage->TextureID(), ImVec2((float)concreteImage->Width, (float)concreteImage->Height)};
+    }
+
+    static ImageAndSize _GetCachedAssetImage(const char*assetPath, bool updateCache = false)
+    {
+        ImageAtlas* imageAtlas = _GetImageAtlas();
+        ImageAndSize r;
+        if (imageAtlas && !updateCache && imageAtlas->Find(assetPath, ImGui::GetFrameCount(), &r))
+            return r;
+
         ImageAbstractPtr concreteImage;
         if (gImageFromAssetMap.find(assetPath) != gImageFromAssetMap.end())
         {
             concreteImage = gImageFromAssetMap.at(assetPath);
             if (updateCache == false)
-                return concreteImage;
+                return _ImageAndSizeOf(concreteImage);
         }
 
-        unsigned char* image_data_rgba;
-        int width, height;
+        // Pre-compressed textures are not packed into the atlas, and not mirrored on the remote display
+        std::string decodedAssetPath;
+        if (auto compressedImage = _GetCompressedImageFromAsset_IfAvailable(assetPath, &decodedAssetPath))
+        {
+            if (concreteImage)
+                _RemoveFromRemoteDisplay(concreteImage);
+            if (imageAtlas)
+                imageAtlas->Remove(assetPath);
+            gImageFromAssetMap[assetPath] = compressedImage;
+            return _ImageAndSizeOf(compressedImage);
+        }
+
+        std::unique_ptr<_DecodedRgbaImage> decodedImage;
         {
             // Load the image using stbi_load_from_memory
-            auto assetData = LoadAssetFileData(assetPath);
+            auto assetData = LoadAssetFileData(decodedAssetPath.c_str());
             
             IM_ASSERT(assetData.data != nullptr);
-            image_data_rgba = stbi_load_from_memory(
-                (unsigned char *)assetData.data, (int)assetData.dataSize,
-                &width, &height, NULL, 4);
+            decodedImage = std::make_unique<_DecodedRgbaImage>((const unsigned char *)assetData.data, (int)assetData.dataSize);
             FreeAssetFileData(&assetData);
         }
+        unsigned char* image_data_rgba = decodedImage->Rgba;
+        int width = decodedImage->Width, height = decodedImage->Height;
 
         if (image_data_rgba == nullptr)
         {
@@ -121,12 +316,26 @@ namespace HelloImGui
             throw std::runtime_error("_GetCachedImage: Failed to load image!");
         }
 
-        if(_UpdateImageFromMemory(concreteImage, image_data_rgba, width, height))   // if a new image pointer was created
-            gImageFromAssetMap[assetPath] = concreteImage;
+        if (imageAtlas && imageAtlas->CanContain(width, height)
+            && imageAtlas->Insert(assetPath, width, height, image_data_rgba, ImGui::GetFrameCount()))
+        {
+            // The image may have used its own texture before (e.g. if the atlas was full)
+            if (concreteImage)
+            {
+                _RemoveFromRemoteDisplay(concreteImage);
+                gImageFromAssetMap.erase(assetPath);
+            }
+            imageAtlas->Find(assetPath, ImGui::GetFrameCount(), &r);
+            return r;
+        }
+        if (imageAtlas)
+            imageAtlas->Remove(assetPath);
 
-        stbi_image_free(image_data_rgba);
+        bool useMipmaps = HelloImGui::GetRunnerParams()->imageLoadingParams.generateMipmaps;
+        if(_UpdateImageFromMemory(concreteImage, image_data_rgba, width, height, useMipmaps))   // if a new image pointer was created
+            gImageFromAssetMap[assetPath] = concreteImage;
 
-        return concreteImage;
+        return _ImageAndSizeOf(concreteImage);
     }
 
     static ImageAbstractPtr _GetCachedMemoryImage(const char*assetName, unsigned char * image_data_rgba, int width, int height)
@@ -151,22 +360,27 @@ namespace HelloImGui
         return concreteImage;
     }
 
+    // uv (relative to the image) => uv inside the texture (which may be an atlas page)
+    static ImVec2 _TextureUv(const ImageAndSize& image, const ImVec2& uv)
+    {
+        return ImVec2(image.uv0.x + uv.x * (image.uv1.x - image.uv0.x), image.uv0.y + uv.y * (image.uv1.y - image.uv0.y));
+    }
+
     inline void _CachedImGuiImage(
-        ImageAbstractPtr & cachedImage,
+        const ImageAndSize& cachedImage,
         const ImVec2& size,
         const ImVec2& uv0, const ImVec2& uv1,
         const ImVec4& tint_col, const ImVec4& border_col,
         const char *txtFail)
     {
-        if (cachedImage == nullptr)
+        if (cachedImage.textureId == ImTextureID(0))
         {
             ImGui::TextColored(ImVec4(1.f, 0.f, 0.f, 1.f), txtFail);
             return;
         }
-        auto textureId = cachedImage->TextureID();
-        auto imageSize = ImVec2((float)cachedImage->Width, (float)cachedImage->Height);
-        ImVec2 displayedSize = ImageProportionalSize(size, imageSize);
-        ImGui::Image(textureId, displayedSize, uv0, uv1, tint_col, border_col);
+        ImVec2 displayedSize = ImageProportionalSize(size, cachedImage.size);
+        ImGui::Image(cachedImage.textureId, displayedSize,
+                     _TextureUv(cachedImage, uv0), _TextureUv(cachedImage, uv1), tint_col, border_col);
     }
 
     void ImageFromAsset(
@@ -195,7 +409,7 @@ namespace HelloImGui
         const ImVec2& uv0, const ImVec2& uv1,
         const ImVec4& tint_col, const ImVec4& border_col) 
     {
-        auto cachedImage = _GetCachedMemoryImage(assetName, image.image_buffer_rgba, image.width, image.height);
+        auto cachedImage = _ImageAndSizeOf(_GetCachedMemoryImage(assetName, image.image_buffer_rgba, image.width, image.height));
         _CachedImGuiImage(cachedImage, size, uv0, uv1, tint_col, border_col, "ImageFromMemory: fail!");
     }
 
@@ -210,19 +424,18 @@ namespace HelloImGui
 
 
     inline bool _CachedImguiImageButton(
-        ImageAbstractPtr & cachedImage,
+        const ImageAndSize& cachedImage,
         const char *str_id,  const ImVec2& size, const ImVec2& uv0,  const ImVec2& uv1, int frame_padding, const ImVec4& bg_col, const ImVec4& tint_col,
         const char *txtFail)
     {
-        if (cachedImage == nullptr)
+        if (cachedImage.textureId == ImTextureID(0))
         {
             ImGui::TextColored(ImVec4(1.f, 0.f, 0.f, 1.f), txtFail);
             return false;
         }
-        auto textureId = cachedImage->TextureID();
-        auto imageSize = ImVec2((float)cachedImage->Width, (float)cachedImage->Height);
-        ImVec2 displayedSize = ImageProportionalSize(size, imageSize);
-        bool clicked = ImGui::ImageButton(str_id, textureId, displayedSize, uv0, uv1, bg_col, tint_col);
+        ImVec2 displayedSize = ImageProportionalSize(size, cachedImage.size);
+        bool clicked = ImGui::ImageButton(str_id, cachedImage.textureId, displayedSize,
+                                          _TextureUv(cachedImage, uv0), _TextureUv(cachedImage, uv1), bg_col, tint_col);
         return clicked;
     }
 
@@ -239,7 +452,7 @@ namespace HelloImGui
 
     bool ImageButtonFromMemory(const char *assetName, MemoryImage image, const ImVec2& size, const ImVec2& uv0,  const ImVec2& uv1, int frame_padding, const ImVec4& bg_col, const ImVec4& tint_col)
     {
-        auto cachedImage = _GetCachedMemoryImage(assetName, image.image_buffer_rgba, image.width, image.height);
+        auto cachedImage = _ImageAndSizeOf(_GetCachedMemoryImage(assetName, image.image_buffer_rgba, image.width, image.height));
         return _CachedImguiImageButton(cachedImage, assetName, size, uv0, uv1, frame_padding, bg_col, tint_col, "ImageButtonFromMemory: fail!");
     }
 
@@ -250,10 +463,7 @@ namespace HelloImGui
 
     ImTextureID ImTextureIdFromAsset(const char *assetPath, bool updateCache)
     {
-        auto cachedImage = _GetCachedAssetImage(assetPath, updateCache);
-        if (cachedImage == nullptr)
-            return ImTextureID(0);
-        return cachedImage->TextureID();
+        return _GetCachedAssetImage(assetPath, updateCache).textureId;
     }
 
     ImTextureID ImTextureIdFromAsset(const char *assetPath)
@@ -276,10 +486,7 @@ namespace HelloImGui
 
     ImVec2 ImageSizeFromAsset(const char *assetPath, bool updateCache)
     {
-        auto cachedImage = _GetCachedAssetImage(assetPath, updateCache);
-        if (cachedImage == nullptr)
-            return ImVec2(0.f, 0.f);
-        return ImVec2((float)cachedImage->Width, (float)cachedImage->Height);
+        return _GetCachedAssetImage(assetPath, updateCache).size;
     }
 
     ImVec2 ImageSizeFromAsset(const char *assetPath)
@@ -303,10 +510,7 @@ namespace HelloImGui
 
     ImageAndSize ImageAndSizeFromAsset(const char *assetPath, bool updateCache)
     {
-        auto cachedImage = _GetCachedAssetImage(assetPath, updateCache);
-        if (cachedImage == nullptr)
-            return {};
-        return {cachedImage->TextureID(), ImVec2((float)cachedImage->Width, (float)cachedImage->Height)};
+        return _GetCachedAssetImage(assetPath, updateCache);
     }
 
     ImageAndSize ImageAndSizeFromAsset(const char *assetPath)
@@ -317,10 +521,7 @@ namespace HelloImGui
 
     ImageAndSize ImageAndSizeFromMemory(const char *assetName, MemoryImage image)
     {
-        auto cachedImage = _GetCachedMemoryImage(assetName, image.image_buffer_rgba, image.width, image.height);
-        if (cachedImage == nullptr)
-            return {};
-        return {cachedImage->TextureID(), ImVec2((float)cachedImage->Width, (float)cachedImage->Height)};
+        return _ImageAndSizeOf(_GetCachedMemoryImage(assetName, image.image_buffer_rgba, image.width, image.height));
     }
 
     ImageAndSize ImageAndSizeFromMemory(const char *assetName)
@@ -332,7 +533,21 @@ namespace HelloImGui
     {
         void Free_ImageFromAssetMap()
         {
+            for (const auto& kv: gImageFromAssetMap)
+                _RemoveFromRemoteDisplay(kv.second);
             gImageFromAssetMap.clear();
+            gImageAtlas.reset();
+        }
+
+        void ImageAtlas_FlushUploads()
+        {
+            if (gImageAtlas)
+                gImageAtlas->FlushUploads(ImGui::GetFrameCount());
+        }
+
+        bool ImageAtlas_HasPendingUploads()
+        {
+            return gImageAtlas && gImageAtlas->HasPendingUploads();
         }
     }
 
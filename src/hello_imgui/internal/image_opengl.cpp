@@ -3,9 +3,97 @@
 
 #include "imgui.h"
 
+#include <cstring>
+#include <string>
+
+
+// Compressed formats (their extensions may not be declared by the GL headers)
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#endif
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#endif
+#ifndef GL_COMPRESSED_RGBA_ASTC_4x4_KHR
+#define GL_COMPRESSED_RGBA_ASTC_4x4_KHR 0x93B0
+#endif
+#ifndef GL_NUM_EXTENSIONS
+#define GL_NUM_EXTENSIONS 0x821D
+#endif
+
 
 namespace HelloImGui
 {
+    static bool _HasGlExtension(const char* extensionName)
+    {
+#if defined(HELLOIMGUI_USE_GLES2)
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        if (extensions == nullptr)
+            return false;
+        std::string allExtensions = std::string(" ") + extensions + " ";
+        return allExtensions.find(std::string(" ") + extensionName + " ") != std::string::npos;
+#else
+        GLint nbExtensions = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &nbExtensions);
+        for (GLint i = 0; i < nbExtensions; ++i)
+        {
+            const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+            if (extension != nullptr && strcmp(extension, extensionName) == 0)
+                return true;
+        }
+        return false;
+#endif
+    }
+
+    // Returns 0 if the format is not supported by the current context
+    static GLenum _GlCompressedFormat(CompressedTextureFormat format)
+    {
+        // The extensions are queried once (they do not change during the life of the context)
+        static bool isQueried = false;
+        static bool hasS3tc, hasBptc, hasEtc2, hasAstc;
+        if (!isQueried)
+        {
+            hasS3tc = _HasGlExtension("GL_EXT_texture_compression_s3tc") || _HasGlExtension("WEBGL_compressed_texture_s3tc");
+            hasBptc = _HasGlExtension("GL_ARB_texture_compression_bptc") || _HasGlExtension("GL_EXT_texture_compression_bptc");
+#if defined(HELLOIMGUI_USE_GLES3)
+            hasEtc2 = true;  // ETC2 is part of OpenGL ES 3
+#else
+            hasEtc2 = _HasGlExtension("GL_ARB_ES3_compatibility");
+#endif
+            hasAstc = _HasGlExtension("GL_KHR_texture_compression_astc_ldr");
+            isQueried = true;
+        }
+
+        switch (format)
+        {
+            case CompressedTextureFormat::BC1: return hasS3tc ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT : 0;
+            case CompressedTextureFormat::BC1_RGBA: return hasS3tc ? GL_COMPRESSED_RGBA_S3TC_DXT1_EXT : 0;
+            case CompressedTextureFormat::BC3: return hasS3tc ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : 0;
+            case CompressedTextureFormat::BC7: return hasBptc ? GL_COMPRESSED_RGBA_BPTC_UNORM : 0;
+            case CompressedTextureFormat::ETC2_RGB8: return hasEtc2 ? GL_COMPRESSED_RGB8_ETC2 : 0;
+            case CompressedTextureFormat::ETC2_RGBA8: return hasEtc2 ? GL_COMPRESSED_RGBA8_ETC2_EAC : 0;
+            case CompressedTextureFormat::ASTC_4x4: return hasAstc ? GL_COMPRESSED_RGBA_ASTC_4x4_KHR : 0;
+        }
+        return 0;
+    }
+
+    // Trilinear filtering when the texture has mipmaps
+    static void _SetMinFilter(bool hasMipmaps)
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, hasMipmaps ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    }
 
     void _UpdateOrphanTexture(GLuint textureID, int width, int height, unsigned char* image_data_rgba) 
     {
@@ -35,6 +123,11 @@ namespace HelloImGui
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA,
                      width,
                      height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image_data_rgba);
+        if (self.UseMipmaps)
+        {
+            glGenerateMipmap(GL_TEXTURE_2D);
+            _SetMinFilter(true);
+        }
     }
 
     void ImageOpenGl::_impl_UploadTexture(int width, int height, unsigned char* image_data_rgba)
@@ -45,6 +138,51 @@ namespace HelloImGui
             return;
         }
         _UpdateOrphanTexture(self.TextureId, width, height, image_data_rgba);
+        if (self.UseMipmaps)
+            glGenerateMipmap(GL_TEXTURE_2D);
+    }
+
+    bool ImageOpenGl::_impl_StoreCompressedTexture(const CompressedTexture& texture)
+    {
+        GLenum glFormat = _GlCompressedFormat(texture.Format);
+        if (glFormat == 0 || texture.Levels.empty())
+            return false;
+
+        auto& self = *this;
+        if (self.TextureId == 0)
+            glGenTextures(1, &self.TextureId);
+        glBindTexture(GL_TEXTURE_2D, self.TextureId);
+        bool hasMipmaps = texture.Levels.size() > 1;
+        _SetMinFilter(hasMipmaps);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+#if defined(HELLOIMGUI_USE_GLES2) || defined(HELLOIMGUI_USE_GLES3)
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+#endif
+#if !defined(HELLOIMGUI_USE_GLES2)
+        // The files may contain an incomplete mip chain
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)texture.Levels.size() - 1);
+#endif
+        // Drain the errors left by previous GL calls, so that only the errors of the upload are checked below
+        // (bounded: a lost context may keep reporting an error)
+        for (int i = 0; i < 16 && glGetError() != GL_NO_ERROR; ++i)
+            ;
+        for (size_t i = 0; i < texture.Levels.size(); ++i)
+        {
+            const auto& level = texture.Levels[i];
+            glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, glFormat, level.Width, level.Height, 0,
+                                   (GLsizei)level.DataSize, level.Data);
+        }
+
+        // If the driver rejects the texture, the .png / .jpg version is used instead
+        if (glGetError() != GL_NO_ERROR)
+        {
+            _impl_ReleaseTexture();
+            return false;
+        }
+        self.Width = texture.Width();
+        self.Height = texture.Height();
+        return true;
     }
 
 
@@ -16,6 +16,7 @@ namespace HelloImGui
         void _impl_StoreTexture(int width, int height, unsigned char* image_data_rgba) override;
         void _impl_UploadTexture(int width, int height, unsigned char* image_data_rgba) override;
         void _impl_ReleaseTexture() override;
+        bool _impl_StoreCompressedTexture(const CompressedTexture& texture) override;
 
         GLuint TextureId = 0;
     };
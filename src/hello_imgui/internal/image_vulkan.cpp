@@ -2,7 +2,9 @@
 #include "image_vulkan.h"
 
 #include "imgui.h"
+#include "hello_imgui/hello_imgui.h"
 #include "hello_imgui/internal/backend_impls/rendering_vulkan.h"
+#include "hello_imgui/internal/backend_impls/vulkan_textures.h"
 
 // Inspired from https://github.com/ocornut/imgui/wiki/Image-Loading-and-Displaying-Examples#example-for-vulkan-users
 // WARNING: THIS IS ONE WAY TO DO THIS AMONG MANY, and provided for informational purpose.
@@ -33,9 +35,6 @@ namespace HelloImGui
         
         auto &self = *this;
 
-        // Calculate allocation size (in number of bytes)
-        size_t image_size = width * height * self.Channels;
-
         VkResult err;
 
         // Create the Vulkan image.
@@ -82,25 +81,51 @@ namespace HelloImGui
             VulkanSetup::check_vk_result(err);
         }
 
-        // Create Sampler
+        self.UsesGrowableDescriptorPools = GetRunnerParams()->rendererBackendOptions.vulkanGrowableDescriptorPools;
+        if (self.UsesGrowableDescriptorPools)
         {
-            VkSamplerCreateInfo sampler_info{};
-            sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
-            sampler_info.magFilter = VK_FILTER_LINEAR;
-            sampler_info.minFilter = VK_FILTER_LINEAR;
-            sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
-            sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT; // outside image bounds just use border color
-            sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-            sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
-            sampler_info.minLod = -1000;
-            sampler_info.maxLod = 1000;
-            sampler_info.maxAnisotropy = 1.0f;
-            err = vkCreateSampler(vkGlobals.Device, &sampler_info, vkGlobals.Allocator, &self.Sampler);
-            VulkanSetup::check_vk_result(err);
+            // Create the Descriptor Set: it is allocated from growable pools, and uses a sampler shared by all the images
+            // (see VulkanTextures::AllocateTextureDescriptorSet)
+            self.DS = VulkanTextures::AllocateTextureDescriptorSet(self.ImageView);
+        }
+        else
+        {
+            // Create Sampler
+            {
+                VkSamplerCreateInfo sampler_info{};
+                sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+                sampler_info.magFilter = VK_FILTER_LINEAR;
+                sampler_info.minFilter = VK_FILTER_LINEAR;
+                sampler_info.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+                sampler_info.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT; // outside image bounds just use border color
+                sampler_info.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+                sampler_info.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+                sampler_info.minLod = -1000;
+                sampler_info.maxLod = 1000;
+                sampler_info.maxAnisotropy = 1.0f;
+                err = vkCreateSampler(vkGlobals.Device, &sampler_info, vkGlobals.Allocator, &self.Sampler);
+                VulkanSetup::check_vk_result(err);
+            }
+
+            // Create Descriptor Set using ImGUI's implementation
+            self.DS = ImGui_ImplVulkan_AddTexture(self.Sampler, self.ImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
         }
 
-        // Create Descriptor Set using ImGUI's implementation
-        self.DS = ImGui_ImplVulkan_AddTexture(self.Sampler, self.ImageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        _UploadNow(width, height, image_data_rgba);
+
+        //this->imTextureId = (ImTextureID)(intptr_t)vkImageView;
+    }
+
+    // Uploads the pixels with an upload buffer and a dedicated submission, and waits for the device
+    void ImageVulkan::_UploadNow(int width, int height, unsigned char* image_data_rgba)
+    {
+        VulkanGlobals& vkGlobals = GetVulkanGlobals();
+        auto &self = *this;
+
+        // Calculate allocation size (in number of bytes)
+        size_t image_size = width * height * self.Channels;
+
+        VkResult err;
 
         // Create Upload Buffer
         {
@@ -177,8 +202,8 @@ namespace HelloImGui
             VkBufferImageCopy region = {};
             region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
             region.imageSubresource.layerCount = 1;
-            region.imageExtent.width = self.Width;
-            region.imageExtent.height = self.Height;
+            region.imageExtent.width = width;
+            region.imageExtent.height = height;
             region.imageExtent.depth = 1;
             vkCmdCopyBufferToImage(command_buffer, self.UploadBuffer, self.Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 
@@ -210,24 +235,44 @@ namespace HelloImGui
             err = vkDeviceWaitIdle(vkGlobals.Device);
             VulkanSetup::check_vk_result(err);
         }
-
-
-        //this->imTextureId = (ImTextureID)(intptr_t)vkImageView;
     }
 
     void ImageVulkan::_impl_ReleaseTexture()
     {
-        VulkanGlobals& vkGlobals = GetVulkanGlobals();
         auto& self = *this;
-
-        vkFreeMemory(vkGlobals.Device, self.UploadBufferMemory, nullptr);
-        vkDestroyBuffer(vkGlobals.Device, self.UploadBuffer, nullptr);
-        vkDestroySampler(vkGlobals.Device, self.Sampler, nullptr);
-        vkDestroyImageView(vkGlobals.Device, self.ImageView, nullptr);
-        vkDestroyImage(vkGlobals.Device, self.Image, nullptr);
-        vkFreeMemory(vkGlobals.Device, self.ImageMemory, nullptr);
-        ImGui_ImplVulkan_RemoveTexture(self.DS);
-		self.DS = {};
+        if (self.Image == VK_NULL_HANDLE)
+            return;
+
+        // The resources are destroyed once the GPU does not use them anymore: the frames in flight
+        // may still sample the image, and the descriptor set must not be reused or freed before
+        VkDescriptorSet ds = self.DS;
+        VkImageView imageView = self.ImageView;
+        VkSampler sampler = self.Sampler;
+        VkBuffer uploadBuffer = self.UploadBuffer;
+        VkDeviceMemory uploadBufferMemory = self.UploadBufferMemory;
+        bool usesGrowableDescriptorPools = self.UsesGrowableDescriptorPools;
+        VulkanTextures::DestroyImageDeferred(self.Image, self.ImageMemory,
+            [ds, imageView, sampler, uploadBuffer, uploadBufferMemory, usesGrowableDescriptorPools]() {
+                VulkanGlobals& vkGlobals = GetVulkanGlobals();
+                if (usesGrowableDescriptorPools)
+                    VulkanTextures::FreeTextureDescriptorSet(ds);
+                else
+                {
+                    ImGui_ImplVulkan_RemoveTexture(ds);
+                    vkDestroySampler(vkGlobals.Device, sampler, vkGlobals.Allocator);
+                }
+                vkDestroyImageView(vkGlobals.Device, imageView, vkGlobals.Allocator);
+                vkDestroyBuffer(vkGlobals.Device, uploadBuffer, vkGlobals.Allocator);
+                vkFreeMemory(vkGlobals.Device, uploadBufferMemory, vkGlobals.Allocator);
+            });
+
+        self.DS = VK_NULL_HANDLE;
+        self.ImageView = VK_NULL_HANDLE;
+        self.Image = VK_NULL_HANDLE;
+        self.ImageMemory = VK_NULL_HANDLE;
+        self.Sampler = VK_NULL_HANDLE;
+        self.UploadBuffer = VK_NULL_HANDLE;
+        self.UploadBufferMemory = VK_NULL_HANDLE;
     }
 
     // Destructor to clean up Vulkan resources
@@ -17,14 +17,19 @@ namespace HelloImGui
         void _impl_ReleaseTexture() override;
         
         // Specific to Vulkan
-        VkDescriptorSet DS;
+        VkDescriptorSet DS = VK_NULL_HANDLE;
         static constexpr int Channels = 4; // We intentionally only support RGBA for now
-        VkImageView     ImageView = nullptr;
-        VkImage         Image = nullptr;
-        VkDeviceMemory  ImageMemory = nullptr;
-        VkSampler       Sampler = nullptr;
-        VkBuffer        UploadBuffer = nullptr;
-        VkDeviceMemory  UploadBufferMemory = nullptr;
+        VkImageView     ImageView = VK_NULL_HANDLE;
+        VkImage         Image = VK_NULL_HANDLE;
+        VkDeviceMemory  ImageMemory = VK_NULL_HANDLE;
+        VkSampler       Sampler = VK_NULL_HANDLE;  // Unused with growable descriptor pools (they share one sampler)
+        VkBuffer        UploadBuffer = VK_NULL_HANDLE;
+        VkDeviceMemory  UploadBufferMemory = VK_NULL_HANDLE;
+        // RendererBackendOptions.vulkanGrowableDescriptorPools, when the texture was created
+        bool            UsesGrowableDescriptorPools = false;
+
+    private:
+        void _UploadNow(int width, int height, unsigned char* image_data_rgba);
     };
 }
 
@@ -0,0 +1,276 @@
+#include "hello_imgui/internal/imgui_allocator.h"
+#include "imgui.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    namespace ImGuiAllocator
+    {
+        //
+        // Blocks
+        //
+        struct alignas(16) _BlockHeader
+        {
+            size_t   Size;       // requested by ImGui
+            uint32_t SizeClass;  // kHeapBlock if allocated by malloc
+            uint16_t Magic;
+            uint16_t IsTracked;  // if true, the block is accounted in the live allocations
+        };
+        static_assert(sizeof(_BlockHeader) == 16, "The blocks shall keep the alignment of malloc");
+
+        constexpr uint32_t kHeapBlock = 0xFFFFFFFF;
+        constexpr uint16_t kMagic = 0x1A1C;
+
+
+        //
+        // Size class pool: blocks of 32, 64, ..., 2048 bytes (header included),
+        // carved from slabs of 64 KB, and recycled through a free list per size class
+        //
+        constexpr int kNbSizeClasses = 7;
+        constexpr size_t kSmallestBlockSize = 32;
+        constexpr size_t kSlabSize = 64 * 1024;
+
+        struct _SizeClassPool
+        {
+            std::mutex Mutex;
+            void* FreeLists[kNbSizeClasses] = {};  // each free block stores the next one
+            unsigned char* SlabCursor = nullptr;
+            size_t SlabRemaining = 0;
+            std::vector<void*> Slabs;  // never freed (blocks may be in use until the application exits)
+            size_t BytesReserved = 0;
+        };
+        // Never destroyed: ImGui blocks may be freed during the destruction of static objects
+        static _SizeClassPool& _Pool()
+        {
+            static _SizeClassPool* pool = new _SizeClassPool();
+            return *pool;
+        }
+
+        static size_t _BlockSize(int sizeClass) { return kSmallestBlockSize << sizeClass; }
+
+        // Returns -1 if the block is too large for the pool
+        static int _SizeClassOf(size_t blockSize)
+        {
+            for (int sizeClass = 0; sizeClass < kNbSizeClasses; ++sizeClass)
+                if (blockSize <= _BlockSize(sizeClass))
+                    return sizeClass;
+            return -1;
+        }
+
+        static void* _PoolAlloc(int sizeClass, bool* outIsHeapAllocation)
+        {
+            _SizeClassPool& pool = _Pool();
+            std::lock_guard<std::mutex> lock(pool.Mutex);
+            *outIsHeapAllocation = false;
+            if (void* block = pool.FreeLists[sizeClass])
+            {
+                pool.FreeLists[sizeClass] = *(void**)block;
+                return block;
+            }
+            size_t blockSize = _BlockSize(sizeClass);
+            if (pool.SlabRemaining < blockSize)
+            {
+                // The end of the previous slab is lost (less than 2 KB)
+                void* slab = malloc(kSlabSize);
+                if (slab == nullptr)
+                    return nullptr;
+                *outIsHeapAllocation = true;
+                pool.Slabs.push_back(slab);
+                pool.BytesReserved += kSlabSize;
+                pool.SlabCursor = (unsigned char*)slab;
+                pool.SlabRemaining = kSlabSize;
+            }
+            void* block = pool.SlabCursor;
+            pool.SlabCursor += blockSize;
+            pool.SlabRemaining -= blockSize;
+            return block;
+        }
+
+        static void _PoolFree(void* block, int sizeClass)
+        {
+            _SizeClassPool& pool = _Pool();
+            std::lock_guard<std::mutex> lock(pool.Mutex);
+            *(void**)block = pool.FreeLists[sizeClass];
+            pool.FreeLists[sizeClass] = block;
+        }
+
+
+        //
+        // Tracking
+        //
+        struct _AtomicCounters
+        {
+            std::atomic<size_t> Allocations { 0 }, Frees { 0 }, BytesAllocated { 0 }, HeapAllocations { 0 };
+
+            ImGuiAllocationCounters Exchange()
+            {
+                ImGuiAllocationCounters r;
+                r.allocations = Allocations.exchange(0, std::memory_order_relaxed);
+                r.frees = Frees.exchange(0, std::memory_order_relaxed);
+                r.bytesAllocated = BytesAllocated.exchange(0, std::memory_order_relaxed);
+                r.heapAllocations = HeapAllocations.exchange(0, std::memory_order_relaxed);
+                return r;
+            }
+        };
+
+        static std::atomic<bool> gIsTracking { false };
+        static std::atomic<bool> gUseSizeClassPool { false };
+        static std::atomic<int> gPhase { (int)Phase::BeforeNewFrame };
+
+        // Counters of the current frame, per phase
+        static _AtomicCounters gCurrentFrame[(int)Phase::Count];
+        static std::atomic<size_t> gLiveAllocations { 0 }, gLiveBytes { 0 }, gLiveBytesHighWaterMark { 0 };
+
+        // Stats of the previous frames (protected by gStatsMutex)
+        static std::mutex gStatsMutex;
+        static ImGuiAllocationStats gStats;
+
+        static void _Add(ImGuiAllocationCounters* counters, const ImGuiAllocationCounters& other)
+        {
+            counters->allocations += other.allocations;
+            counters->frees += other.frees;
+            counters->bytesAllocated += other.bytesAllocated;
+            counters->heapAllocations += other.heapAllocations;
+        }
+
+        static void _OnTrackedAlloc(size_t size, bool isHeapAllocation)
+        {
+            auto& counters = gCurrentFrame[gPhase.load(std::memory_order_relaxed)];
+            counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.BytesAllocated.fetch_add(size, std::memory_order_relaxed);
+            if (isHeapAllocation)
+                counters.HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+
+            gLiveAllocations.fetch_add(1, std::memory_order_relaxed);
+            size_t liveBytes = gLiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+            size_t highWaterMark = gLiveBytesHighWaterMark.load(std::memory_order_relaxed);
+            while (liveBytes > highWaterMark
+                   && !gLiveBytesHighWaterMark.compare_exchange_weak(highWaterMark, liveBytes, std::memory_order_relaxed))
+                ;
+        }
+
+
+        //
+        // API
+        //
+        void* Alloc(size_t size, void* userData)
+        {
+            (void)userData;
+            size_t blockSize = size + sizeof(_BlockHeader);
+            int sizeClass = gUseSizeClassPool.load(std::memory_order_relaxed) ? _SizeClassOf(blockSize) : -1;
+            bool isHeapAllocation = true;
+            _BlockHeader* header;
+            if (sizeClass >= 0)
+                header = (_BlockHeader*)_PoolAlloc(sizeClass, &isHeapAllocation);
+            else
+                header = (_BlockHeader*)malloc(blockSize);
+            if (header == nullptr)
+                return nullptr;
+
+            bool isTracking = gIsTracking.load(std::memory_order_relaxed);
+            header->Size = size;
+            header->SizeClass = sizeClass >= 0 ? (uint32_t)sizeClass : kHeapBlock;
+            header->Magic = kMagic;
+            header->IsTracked = isTracking ? 1 : 0;
+            if (isTracking)
+                _OnTrackedAlloc(size, isHeapAllocation);
+            return header + 1;
+        }
+
+        void Free(void* ptr, void* userData)
+        {
+            (void)userData;
+            if (ptr == nullptr)
+                return;
+            _BlockHeader* header = (_BlockHeader*)ptr - 1;
+            IM_ASSERT(header->Magic == kMagic && "ImGuiAllocator::Free: this block was not allocated by ImGuiAllocator::Alloc");
+
+            if (gIsTracking.load(std::memory_order_relaxed))
+                gCurrentFrame[gPhase.load(std::memory_order_relaxed)].Frees.fetch_add(1, std::memory_order_relaxed);
+            if (header->IsTracked)
+            {
+                gLiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+                gLiveBytes.fetch_sub(header->Size, std::memory_order_relaxed);
+            }
+
+            header->Magic = 0;
+            if (header->SizeClass == kHeapBlock)
+                free(header);
+            else
+                _PoolFree(header, (int)header->SizeClass);
+        }
+
+        void Configure(bool enableTracking, bool useSizeClassPool)
+        {
+            gIsTracking = enableTracking;
+            gUseSizeClassPool = useSizeClassPool;
+        }
+
+        void SetPhase(Phase phase)
+        {
+            gPhase.store((int)phase, std::memory_order_relaxed);
+        }
+
+        size_t OnFrameEnd()
+        {
+            std::lock_guard<std::mutex> lock(gStatsMutex);
+            ImGuiAllocationCounters phases[(int)Phase::Count];
+            ImGuiAllocationCounters frame;
+            for (int i = 0; i < (int)Phase::Count; ++i)
+            {
+                phases[i] = gCurrentFrame[i].Exchange();
+                _Add(&frame, phases[i]);
+            }
+            if (!gIsTracking)
+                return 0;
+
+            gStats.lastFrame = frame;
+            gStats.lastFrame_BeforeNewFrame = phases[(int)Phase::BeforeNewFrame];
+            gStats.lastFrame_NewFrame = phases[(int)Phase::NewFrame];
+            gStats.lastFrame_Gui = phases[(int)Phase::Gui];
+            gStats.lastFrame_Render = phases[(int)Phase::Render];
+            _Add(&gStats.total, frame);
+            gStats.nbFrames += 1;
+            if (frame.allocations > gStats.frameAllocations_HighWaterMark)
+                gStats.frameAllocations_HighWaterMark = frame.allocations;
+            if (frame.bytesAllocated > gStats.frameBytesAllocated_HighWaterMark)
+                gStats.frameBytesAllocated_HighWaterMark = frame.bytesAllocated;
+            gStats.nbFramesWithoutHeapAllocation = (frame.heapAllocations == 0) ? gStats.nbFramesWithoutHeapAllocation + 1 : 0;
+            return frame.heapAllocations;
+        }
+
+        ImGuiAllocationStats GetStats()
+        {
+            ImGuiAllocationStats r;
+            {
+                std::lock_guard<std::mutex> lock(gStatsMutex);
+                r = gStats;
+            }
+            r.isTracking = gIsTracking;
+            r.liveAllocations = gLiveAllocations.load(std::memory_order_relaxed);
+            r.liveBytes = gLiveBytes.load(std::memory_order_relaxed);
+            r.liveBytes_HighWaterMark = gLiveBytesHighWaterMark.load(std::memory_order_relaxed);
+            {
+                _SizeClassPool& pool = _Pool();
+                std::lock_guard<std::mutex> lock(pool.Mutex);
+                r.poolBytesReserved = pool.BytesReserved;
+            }
+            return r;
+        }
+
+        void ResetStats()
+        {
+            std::lock_guard<std::mutex> lock(gStatsMutex);
+            for (auto& counters: gCurrentFrame)
+                counters.Exchange();
+            gStats = ImGuiAllocationStats();
+            gLiveBytesHighWaterMark = gLiveBytes.load();
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "hello_imgui/imgui_allocator_params.h"
+
+#include <cstddef>
+
+
+namespace HelloImGui
+{
+    // ImGuiAllocator: the allocator functions installed into ImGui (see ImGuiAllocatorParams)
+    //
+    // Each block is preceded by a 16 bytes header (its size, its origin: heap or size class pool, whether it was tracked),
+    // so that the settings can be changed at any time: a block is always freed where it came from.
+    // Once installed, the allocator functions are never uninstalled (ImGui may still free blocks afterward).
+    namespace ImGuiAllocator
+    {
+        // The phases of a frame (see ImGuiAllocationStats)
+        enum class Phase
+        {
+            BeforeNewFrame,
+            NewFrame,
+            Gui,
+            Render,
+            Count
+        };
+
+        // The functions given to ImGui::SetAllocatorFunctions
+        void* Alloc(size_t size, void* userData);
+        void  Free(void* ptr, void* userData);
+
+        // May be called at any time
+        void Configure(bool enableTracking, bool useSizeClassPool);
+
+        // Called by AbstractRunner::CreateFramesAndRender
+        void SetPhase(Phase phase);
+        // Closes the counters of the current frame, and returns its number of heap allocations
+        size_t OnFrameEnd();
+
+        ImGuiAllocationStats GetStats();
+        // Resets the frame counters, the totals and the high-water marks (not the live allocations)
+        void ResetStats();
+    }
+}
@@ -0,0 +1,231 @@
+#include "hello_imgui/internal/job_system.h"
+#include "hello_imgui/internal/startup_tracer.h"
+
+#include <algorithm>
+#include <string>
+
+
+namespace HelloImGui
+{
+    static std::atomic<JobSystem*> gCurrentJobSystem { nullptr };
+
+    // The job system and the index of the worker running on this thread (if any)
+    static thread_local JobSystem* tWorkerJobSystem = nullptr;
+    static thread_local int tWorkerIndex = -1;
+
+
+    JobSystem::~JobSystem()
+    {
+        Stop();
+    }
+
+    JobSystem* JobSystem::Current()
+    {
+        if (tWorkerJobSystem != nullptr)
+            return tWorkerJobSystem;
+        return gCurrentJobSystem.load();
+    }
+
+    int JobSystem::CurrentWorkerIndex(const JobSystem* jobSystem)
+    {
+        return (tWorkerJobSystem == jobSystem) ? tWorkerIndex : -1;
+    }
+
+    void JobSystem::Start(int nbThreads)
+    {
+        StartLazily(nbThreads);
+        StartWorkersIfPending();
+    }
+
+    void JobSystem::StartLazily(int nbThreads)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mStartMutex);
+            if (IsRunning() || mIsStartPending)
+                return;
+            mNbThreadsToStart = nbThreads;
+            mIsStartPending = true;
+        }
+        gCurrentJobSystem = this;
+    }
+
+    void JobSystem::StartWorkersIfPending()
+    {
+        std::lock_guard<std::mutex> lock(mStartMutex);
+        if (!mIsStartPending)
+            return;
+        StartupTracer::ScopedEvent traceEvent("Start async workers");
+        int nbThreads = mNbThreadsToStart;
+        if (nbThreads <= 0)
+            nbThreads = std::max(1, (int)std::thread::hardware_concurrency() - 1);
+
+        mStopRequested = false;
+        for (int i = 0; i < nbThreads; ++i)
+            mQueues.push_back(std::make_unique<WorkerQueue>());
+        for (int i = 0; i < nbThreads; ++i)
+            mWorkers.emplace_back([this, i]() { WorkerLoop(i); });
+        // Stored last: the threads which see it false also see the workers
+        mIsStartPending = false;
+    }
+
+    void JobSystem::Stop()
+    {
+        {
+            // A job system which was never used has no workers
+            std::lock_guard<std::mutex> lock(mStartMutex);
+            mIsStartPending = false;
+        }
+        JobSystem* self = this;
+        gCurrentJobSystem.compare_exchange_strong(self, nullptr);
+        if (!IsRunning())
+            return;
+        {
+            std::lock_guard<std::mutex> lock(mSleepMutex);
+            mStopRequested = true;
+        }
+        mSleepCondition.notify_all();
+        for (auto& worker: mWorkers)
+            worker.join();
+        mWorkers.clear();
+        mQueues.clear();
+    }
+
+    void JobSystem::Push(std::function<void()> job)
+    {
+        if (mIsStartPending)
+            StartWorkersIfPending();
+        if (!IsRunning())
+        {
+            job();
+            return;
+        }
+
+        int queueIndex = CurrentWorkerIndex(this);
+        if (queueIndex < 0)
+            queueIndex = (int)(mNextQueue.fetch_add(1) % mQueues.size());
+
+        // The pending count is incremented first: it is never lower than the number of queued jobs
+        {
+            std::lock_guard<std::mutex> lock(mSleepMutex);
+            mNbPendingJobs += 1;
+        }
+        {
+            WorkerQueue& queue = *mQueues[(size_t)queueIndex];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            queue.Jobs.push_back(std::move(job));
+        }
+        mSleepCondition.notify_one();
+    }
+
+    bool JobSystem::PopJob(int workerIndex, std::function<void()>* outJob)
+    {
+        const size_t nbQueues = mQueues.size();
+        if (nbQueues == 0)
+            return false;
+
+        // The worker takes the most recent job of its own queue (it is likely to use the data of its parent job)
+        if (workerIndex >= 0)
+        {
+            WorkerQueue& queue = *mQueues[(size_t)workerIndex];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            if (!queue.Jobs.empty())
+            {
+                *outJob = std::move(queue.Jobs.back());
+                queue.Jobs.pop_back();
+                mNbPendingJobs -= 1;
+                return true;
+            }
+        }
+
+        // Otherwise, it steals the oldest job of another queue
+        size_t start = (workerIndex >= 0) ? (size_t)workerIndex + 1 : 0;
+        for (size_t k = 0; k < nbQueues; ++k)
+        {
+            size_t victim = (start + k) % nbQueues;
+            if ((int)victim == workerIndex)
+                continue;
+            WorkerQueue& queue = *mQueues[victim];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            if (!queue.Jobs.empty())
+            {
+                *outJob = std::move(queue.Jobs.front());
+                queue.Jobs.pop_front();
+                mNbPendingJobs -= 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool JobSystem::RunPendingJob()
+    {
+        std::function<void()> job;
+        if (!PopJob(CurrentWorkerIndex(this), &job))
+            return false;
+        job();
+        return true;
+    }
+
+    void JobSystem::WorkerLoop(int workerIndex)
+    {
+        tWorkerJobSystem = this;
+        tWorkerIndex = workerIndex;
+        StartupTracer::SetThreadName("Async worker " + std::to_string(workerIndex));
+
+        while (true)
+        {
+            std::function<void()> job;
+            if (PopJob(workerIndex, &job))
+            {
+                job();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mSleepMutex);
+            mSleepCondition.wait(lock, [this]() { return mStopRequested || mNbPendingJobs > 0; });
+            // When stopping, the pending jobs are run first
+            if (mStopRequested && mNbPendingJobs == 0)
+                break;
+        }
+
+        tWorkerJobSystem = nullptr;
+        tWorkerIndex = -1;
+    }
+
+    void JobSystem::PostToMainThread(std::function<void()> fn)
+    {
+        std::function<void()> wakeUp;
+        {
+            std::lock_guard<std::mutex> lock(mContinuationsMutex);
+            mContinuations.push_back(std::move(fn));
+            wakeUp = mWakeUp;
+        }
+        if (wakeUp)
+            wakeUp();
+    }
+
+    size_t JobSystem::RunMainThreadContinuations()
+    {
+        std::vector<std::function<void()>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(mContinuationsMutex);
+            continuations.swap(mContinuations);
+        }
+        // The continuations posted by these continuations will run at the next call
+        for (auto& continuation: continuations)
+            continuation();
+        return continuations.size();
+    }
+
+    bool JobSystem::HasMainThreadContinuations() const
+    {
+        std::lock_guard<std::mutex> lock(mContinuationsMutex);
+        return !mContinuations.empty();
+    }
+
+    void JobSystem::SetWakeUpCallback(std::function<void()> wakeUp)
+    {
+        std::lock_guard<std::mutex> lock(mContinuationsMutex);
+        mWakeUp = std::move(wakeUp);
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    // JobSystem: a pool of worker threads, owned by the runner (see HelloImGui::Async)
+    //
+    // Each worker has its own queue: the jobs pushed by a worker (nested jobs) go to its own queue,
+    // where it takes them in LIFO order, and the other workers steal them in FIFO order when their queue is empty.
+    // The jobs pushed by the other threads are distributed round-robin.
+    //
+    // The continuations are posted from any thread, and run on the main thread by RunMainThreadContinuations().
+    class JobSystem
+    {
+    public:
+        JobSystem() = default;
+        ~JobSystem();
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // nbThreads: if 0, the number of hardware threads minus one (at least one).
+        // The started job system becomes the current one (see Current()).
+        void Start(int nbThreads);
+        // Same as Start(), but the workers are only started by the first call to Push()
+        // (an application which never calls Async() does not spawn any thread)
+        void StartLazily(int nbThreads);
+        // Waits until all the pending jobs were run, then joins the workers.
+        // The pending continuations are kept (call RunMainThreadContinuations() afterward).
+        void Stop();
+        bool IsRunning() const { return !mWorkers.empty(); }
+        int NbThreads() const { return (int)mWorkers.size(); }
+
+        // On a worker thread, its job system. Otherwise, the running job system of the application (or nullptr).
+        static JobSystem* Current();
+
+        // Thread safe. If the job system is not running, the job is run immediately.
+        // The jobs shall not throw.
+        void Push(std::function<void()> job);
+        // Runs a pending job (if any) on the calling thread: used to help the workers while waiting for a job.
+        // Returns false if no job was pending.
+        bool RunPendingJob();
+
+        // Thread safe: fn will be called by the next call to RunMainThreadContinuations()
+        void PostToMainThread(std::function<void()> fn);
+        // Runs the continuations posted until now, and returns their number
+        size_t RunMainThreadContinuations();
+        bool HasMainThreadContinuations() const;
+        // Called (from any thread) each time a continuation is posted, so that the main loop stops idling
+        void SetWakeUpCallback(std::function<void()> wakeUp);
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex Mutex;
+            std::deque<std::function<void()>> Jobs;
+        };
+
+        void StartWorkersIfPending();
+        void WorkerLoop(int workerIndex);
+        bool PopJob(int workerIndex, std::function<void()>* outJob);
+        static int CurrentWorkerIndex(const JobSystem* jobSystem);
+
+        std::vector<std::unique_ptr<WorkerQueue>> mQueues;
+        std::vector<std::thread> mWorkers;
+        std::atomic<size_t> mNextQueue { 0 };
+
+        // Set by StartLazily(), until the workers are started (mNbThreadsToStart is guarded by mStartMutex)
+        std::mutex mStartMutex;
+        std::atomic<bool> mIsStartPending { false };
+        int mNbThreadsToStart = 0;
+
+        // mNbPendingJobs (number of queued jobs) is incremented under mSleepMutex, so that a worker cannot miss a wake up
+        std::mutex mSleepMutex;
+        std::condition_variable mSleepCondition;
+        std::atomic<size_t> mNbPendingJobs { 0 };
+        bool mStopRequested = false;
+
+        mutable std::mutex mContinuationsMutex;
+        std::vector<std::function<void()>> mContinuations;
+        std::function<void()> mWakeUp;
+    };
+}
@@ -65,7 +65,7 @@ void ShowMenu(RunnerParams & runnerParams)
         DockingDetails::ShowViewMenu(runnerParams);
 
     if (runnerParams.callbacks.ShowMenus)
-        runnerParams.callbacks.ShowMenus();
+        DockingDetails::MeasureGuiCost("[Menus]", runnerParams.callbacks.ShowMenus);
 
     ImGui::EndMainMenuBar();
 }
@@ -95,7 +95,7 @@ void ShowStatusBar(RunnerParams & params)
     ImGui::Begin("StatusBar", nullptr, windowFlags);
 
     if (params.callbacks.ShowStatus)
-        params.callbacks.ShowStatus();
+        DockingDetails::MeasureGuiCost("[Status bar]", params.callbacks.ShowStatus);
 
     if (params.imGuiWindowParams.showStatus_Fps)
     {
@@ -115,6 +115,25 @@ void ShowStatusBar(RunnerParams & params)
 			ImGui::SameLine();
 			ImGui::SetCursorPosY(ImGui::GetCursorPosY() - dy);
 			ImGui::Text("FPS: %.1f%s", HelloImGui::FrameRate(), idlingInfo);
+			if (ImGui::IsItemHovered())
+			{
+				auto stats = HelloImGui::GetFramePacingStats();
+				auto allocationStats = HelloImGui::GetImGuiAllocationStats();
+				ImGui::BeginTooltip();
+				ImGui::Text(
+					"Input latency: %.1f ms (mean), %.1f ms (max)\nFrame duration: %.1f ms",
+					stats.inputLatencyMs_Mean, stats.inputLatencyMs_Max, stats.frameDurationMs_Estimated);
+				if (allocationStats.isTracking)
+					ImGui::Text(
+						"ImGui allocations: %zu/frame (heap: %zu), live: %zu KB",
+						allocationStats.lastFrame.allocations, allocationStats.lastFrame.heapAllocations,
+						allocationStats.liveBytes / 1024);
+				for (const auto& viewportStats: HelloImGui::GetViewportsRenderStats())
+					ImGui::Text(
+						"Viewport %08X: %.1f ms, %d presents skipped",
+						viewportStats.viewportId, viewportStats.renderMs_Mean, viewportStats.nbSkippedPresents);
+				ImGui::EndTooltip();
+			}
 		}
     }
 
@@ -0,0 +1,141 @@
+#include "hello_imgui/internal/startup_tracer.h"
+#include "hello_imgui/internal/clock_seconds.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    namespace StartupTracer
+    {
+        struct TraceEvent
+        {
+            std::string Name;
+            char Phase;            // 'X': complete event, 'i': instant event
+            int ThreadIndex;
+            double StartSeconds;   // relative to Start()
+            double DurationSeconds;
+        };
+
+        std::atomic<bool> gRecording { false };
+        double gStartSeconds = 0.;
+        std::mutex gMutex;
+        std::vector<TraceEvent> gEvents;
+        std::map<std::thread::id, int> gThreadIndices;
+        std::map<int, std::string> gThreadNames;
+
+        // Must be called with gMutex locked
+        int _ThreadIndex()
+        {
+            auto threadId = std::this_thread::get_id();
+            auto it = gThreadIndices.find(threadId);
+            if (it != gThreadIndices.end())
+                return it->second;
+            int index = (int)gThreadIndices.size();
+            gThreadIndices[threadId] = index;
+            return index;
+        }
+
+        void _AddEvent(const char* name, char phase, double startSeconds, double durationSeconds)
+        {
+            std::lock_guard<std::mutex> lock(gMutex);
+            if (!gRecording)
+                return;
+            gEvents.push_back({name, phase, _ThreadIndex(), startSeconds - gStartSeconds, durationSeconds});
+        }
+
+        void Start()
+        {
+            std::lock_guard<std::mutex> lock(gMutex);
+            gEvents.clear();
+            gThreadIndices.clear();
+            gThreadNames.clear();
+            gThreadNames[_ThreadIndex()] = "Main thread";
+            gStartSeconds = Internal::ClockSeconds();
+            gRecording = true;
+        }
+
+        bool IsRecording() { return gRecording; }
+
+        ScopedEvent::ScopedEvent(const char* name)
+            : mName(name), mStartSeconds(gRecording ? Internal::ClockSeconds() : -1.)
+        {
+        }
+
+        ScopedEvent::~ScopedEvent()
+        {
+            if (mStartSeconds >= 0.)
+                _AddEvent(mName, 'X', mStartSeconds, Internal::ClockSeconds() - mStartSeconds);
+        }
+
+        void AddInstantEvent(const char* name)
+        {
+            if (gRecording)
+                _AddEvent(name, 'i', Internal::ClockSeconds(), 0.);
+        }
+
+        void SetThreadName(const std::string& threadName)
+        {
+            if (!gRecording)
+                return;
+            std::lock_guard<std::mutex> lock(gMutex);
+            gThreadNames[_ThreadIndex()] = threadName;
+        }
+
+        std::string _JsonString(const std::string& s)
+        {
+            std::string r = "\"";
+            for (char c: s)
+            {
+                if (c == '"' || c == '\\')
+                    r += '\\';
+                if ((unsigned char)c >= 0x20)
+                    r += c;
+            }
+            return r + "\"";
+        }
+
+        bool StopAndSave(const std::string& traceFilename)
+        {
+            std::lock_guard<std::mutex> lock(gMutex);
+            if (!gRecording)
+                return false;
+            gRecording = false;
+
+            std::ofstream os(traceFilename, std::ios::binary);
+            char buffer[128];
+            os << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+            bool first = true;
+            for (const auto& [threadIndex, threadName]: gThreadNames)
+            {
+                os << (first ? "" : ",\n");
+                os << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << threadIndex
+                   << ", \"args\": {\"name\": " << _JsonString(threadName) << "}}";
+                first = false;
+            }
+            for (const auto& event: gEvents)
+            {
+                // Chrome trace timestamps are in microseconds
+                if (event.Phase == 'X')
+                    snprintf(buffer, sizeof(buffer), "\"ph\": \"X\", \"ts\": %.1f, \"dur\": %.1f",
+                             event.StartSeconds * 1e6, event.DurationSeconds * 1e6);
+                else
+                    snprintf(buffer, sizeof(buffer), "\"ph\": \"i\", \"s\": \"g\", \"ts\": %.1f", event.StartSeconds * 1e6);
+                os << (first ? "" : ",\n");
+                os << "{\"name\": " << _JsonString(event.Name) << ", " << buffer
+                   << ", \"pid\": 1, \"tid\": " << event.ThreadIndex << "}";
+                first = false;
+            }
+            os << "\n]}\n";
+
+            gEvents.clear();
+            return os.good();
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <string>
+
+
+namespace HelloImGui
+{
+    // StartupTracer records the steps of the application startup (until the first visible frame),
+    // and saves them in the Chrome trace format (open the file with chrome://tracing or https://ui.perfetto.dev)
+    //
+    // It is enabled by RunnerParams.startupTraceFilename. When disabled, the events cost almost nothing.
+    namespace StartupTracer
+    {
+        // Starts recording (the timestamps are relative to this call)
+        void Start();
+        bool IsRecording();
+
+        // Records an event which lasts for the scope of this object (may be used from any thread)
+        class ScopedEvent
+        {
+        public:
+            explicit ScopedEvent(const char* name);
+            ~ScopedEvent();
+            ScopedEvent(const ScopedEvent&) = delete;
+            ScopedEvent& operator=(const ScopedEvent&) = delete;
+        private:
+            const char* mName;
+            double mStartSeconds;
+        };
+
+        // Records an instant event (e.g. "First visible frame")
+        void AddInstantEvent(const char* name);
+
+        // Names the current thread in the trace (the thread which called Start() is named "Main thread")
+        void SetThreadName(const std::string& threadName);
+
+        // Saves the recorded events, stops recording and clears them. Returns false if the file could not be written.
+        bool StopAndSave(const std::string& traceFilename);
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include "imgui.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    // WidgetStateStorage<T> stores a state per widget id, for stateful widgets (e.g. WidgetWithResizeHandle).
+    //
+    // - Each access stamps the entry with the current frame: the entries which were not accessed
+    //   during maxIdleFrames frames are recycled (e.g. widgets with dynamic ids inside a table).
+    // - The entries are stored in a compact open addressing table (linear probing), which grows and
+    //   shrinks with the number of live entries.
+    //
+    // The returned pointers are valid until the next call to Get() (which may rehash the table).
+    template<typename T>
+    class WidgetStateStorage
+    {
+    public:
+        explicit WidgetStateStorage(int maxIdleFrames = 300) : mMaxIdleFrames(maxIdleFrames) {}
+
+        // Returns the state of the widget (value initialized if new or stale), and stamps it with the frame
+        // (use ImGui::GetFrameCount())
+        T* Get(ImGuiID id, int frame)
+        {
+            if (frame >= mNextCollectFrame)
+                CollectGarbage(frame);
+
+            if (mSlots.empty() || (mSize + 1) * 2 > mSlots.size())
+                Rehash(mSlots.empty() ? kMinCapacity : mSlots.size() * 2, frame);
+
+            size_t mask = mSlots.size() - 1;
+            for (size_t i = Hash(id) & mask; ; i = (i + 1) & mask)
+            {
+                Slot& slot = mSlots[i];
+                if (!slot.Used)
+                {
+                    slot.Used = true;
+                    slot.Id = id;
+                    slot.Value = T();
+                    ++mSize;
+                }
+                if (slot.Id == id)
+                {
+                    // A stale entry, which was not yet recycled, is reused as a new one
+                    if (!IsAlive(slot, frame))
+                        slot.Value = T();
+                    slot.LastFrame = frame;
+                    return &slot.Value;
+                }
+            }
+        }
+
+        // Recycles the entries which were not accessed during maxIdleFrames frames.
+        // Called automatically by Get(), about twice per maxIdleFrames frames.
+        void CollectGarbage(int frame)
+        {
+            size_t capacity = mSlots.size();
+            while (capacity > kMinCapacity && CountLive(frame) * 8 < capacity)
+                capacity /= 2;
+            Rehash(capacity, frame);
+        }
+
+        void Clear()
+        {
+            mSlots.clear();
+            mSize = 0;
+        }
+
+        size_t Size() const { return mSize; }
+        size_t Capacity() const { return mSlots.size(); }
+
+    private:
+        struct Slot
+        {
+            ImGuiID Id = 0;
+            int LastFrame = 0;
+            bool Used = false;
+            T Value = T();
+        };
+
+        static constexpr size_t kMinCapacity = 16;
+
+        static size_t Hash(ImGuiID id)
+        {
+            // ImGuiID are already hashes, but consecutive ids (e.g. PushID(int)) shall not fill consecutive slots
+            return (size_t)((uint32_t)id * 2654435761u);
+        }
+
+        bool IsAlive(const Slot& slot, int frame) const
+        {
+            return slot.Used && (frame - slot.LastFrame) <= mMaxIdleFrames;
+        }
+
+        size_t CountLive(int frame) const
+        {
+            size_t r = 0;
+            for (const Slot& slot: mSlots)
+                if (IsAlive(slot, frame))
+                    ++r;
+            return r;
+        }
+
+        // Reinserts the live entries into a table of the given capacity (a power of 2)
+        void Rehash(size_t capacity, int frame)
+        {
+            std::vector<Slot> oldSlots(capacity);
+            oldSlots.swap(mSlots);
+            mSize = 0;
+            size_t mask = capacity - 1;
+            for (Slot& oldSlot: oldSlots)
+            {
+                if (!IsAlive(oldSlot, frame))
+                    continue;
+                size_t i = Hash(oldSlot.Id) & mask;
+                while (mSlots[i].Used)
+                    i = (i + 1) & mask;
+                mSlots[i] = std::move(oldSlot);
+                ++mSize;
+            }
+            mNextCollectFrame = frame + (mMaxIdleFrames / 2 > 0 ? mMaxIdleFrames / 2 : 1);
+        }
+
+        std::vector<Slot> mSlots;
+        size_t mSize = 0;
+        int mMaxIdleFrames;
+        int mNextCollectFrame = 0;
+    };
+}
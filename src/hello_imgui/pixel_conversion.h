@@ -0,0 +1,77 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace HelloImGui
+{
+/**
+@@md#PixelConversion
+
+ImageFromMemory, ImageButtonFromMemory, etc. expect tightly packed RGBA8 pixels (see MemoryImage).
+`HelloImGui::PixelConversion` converts other pixel formats into RGBA8, using SIMD instructions when available
+(SSE2 or AVX2 on x86, NEON on ARM64, selected at runtime), with a scalar fallback.
+
+All the functions work on tightly packed pixels: `nbPixels` is width * height (or the width of a row).
+Unless specified, `src` and `dst` must not overlap.
+
+* `RgbToRgba(src, dst, nbPixels)`: 3 bytes per pixel => 4 bytes per pixel (alpha = 255)
+* `RgbaToRgb(src, dst, nbPixels)`: 4 bytes per pixel => 3 bytes per pixel (alpha is dropped)
+* `BgraToRgba(src, dst, nbPixels)` / `RgbaToBgra(src, dst, nbPixels)`: swap the red and blue channels
+  (src and dst may be the same buffer)
+* `GrayToRgba(src, dst, nbPixels)`: 1 byte per pixel => gray RGBA pixels (alpha = 255)
+* `FloatToRgba(src, dst, nbPixels, minValue, maxValue)` / `Uint16ToRgba(...)`: single channel images
+  (depth maps, scientific or medical images) => gray RGBA pixels, with windowing:
+  minValue is displayed as black, maxValue as white, the values outside the window are clamped
+  (and NaN values are displayed as black).
+  Use `MinMax(src, nbPixels)` to normalize the image (i.e. to use its full range as a window).
+* `FlipVertically(pixels, width, height, bytesPerPixel)`: in place (e.g. for OpenGL framebuffers)
+
+Example:
+```cpp
+std::vector<uint8_t> rgba(width * height * 4);
+auto window = HelloImGui::PixelConversion::MinMax(depthMap.data(), width * height);
+HelloImGui::PixelConversion::FloatToRgba(depthMap.data(), rgba.data(), width * height, window.minValue, window.maxValue);
+HelloImGui::ImageFromMemory("depth", {rgba.data(), width, height});
+```
+@@md
+*/
+namespace PixelConversion
+{
+    void RgbToRgba(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+    void RgbaToRgb(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+    void BgraToRgba(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+    void RgbaToBgra(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+    void GrayToRgba(const uint8_t* src, uint8_t* dst, size_t nbPixels);
+
+    void FloatToRgba(const float* src, uint8_t* dst, size_t nbPixels, float minValue, float maxValue);
+    void Uint16ToRgba(const uint16_t* src, uint8_t* dst, size_t nbPixels, float minValue, float maxValue);
+
+    struct ValueWindow
+    {
+        float minValue = 0.f, maxValue = 0.f;
+    };
+    // Returns the range of the values (NaN values are ignored)
+    ValueWindow MinMax(const float* src, size_t nbPixels);
+    ValueWindow MinMax(const uint16_t* src, size_t nbPixels);
+
+    void FlipVertically(uint8_t* pixels, size_t width, size_t height, size_t bytesPerPixel);
+
+
+    // The instruction set used by the functions above.
+    enum class SimdLevel
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+        NEON
+    };
+    // Returns the instruction set in use (by default, the best one supported by the CPU)
+    SimdLevel GetSimdLevel();
+    // Forces the instruction set (for tests and benchmarks).
+    // An instruction set which is not supported by the CPU is replaced by the best supported one.
+    void SetSimdLevel(SimdLevel level);
+    const char* SimdLevelName(SimdLevel level);
+}
+}
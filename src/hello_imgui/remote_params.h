@@ -17,12 +17,41 @@ struct RemoteParams
 {
     bool enableRemoting = false;
 
+    //
+    // Params used by netImgui and imgui-ws
+    //
+    // If true, a frame whose draw lists are identical to the last transmitted frame
+    // is not transmitted again (imgui-ws only: netImgui transmits frames on its own)
+    bool skipIdenticalFrames = false;
+    // If true, draw lists are transmitted as a delta against the previous frame
+    // (netImgui: forces the client side compression; imgui-ws always compresses its draw lists)
+    bool compressDrawData = true;
+    // If true, the rate at which frames are produced is adapted to the rate at which
+    // the clients acknowledge them, and a client that still has pacingMaxFramesInFlight frames
+    // to acknowledge does not receive new frames (imgui-ws only: netImgui paces its frames on the server side).
+    // Note: imgui-ws broadcasts the same draw data to all clients, so that the pacing follows
+    // the aggregate of all clients (the fastest one), not each client individually:
+    // the per client "in flight" and "dropped" stats are estimates, not what each client actually received.
+    bool adaptiveFramePacing = false;
+    float pacingMinFps = 5.f;
+    float pacingMaxFps = 60.f;
+    int pacingMaxFramesInFlight = 2;
+    // Frame rate used when adaptive pacing is not available
+    float fpsWithoutPacing = 30.f;
+    // User textures (ImageFromAsset, ImageFromMemory) are streamed to the remote display after the draw data,
+    // with at most this many bytes per frame (at least one texture is sent per frame).
+    // Textures whose content was already transmitted are never sent again.
+    int userTexturesBytesPerFrame = 1024 * 1024;
+
     //
     // Params used only by imgui-ws
     //
     int wsPort = 5003;
     std::string wsHttpRootFolder = "";  // Optional folder were some additional files can be served
     bool wsProvideIndexHtml = true;     // If true, will automatically serve a simple index.html file that contains the canvas and the imgui-ws client code
+    // If true, the frames are serialized and compressed (once for all clients) on a dedicated thread,
+    // from a copy of the draw data. If the clients are slower than the application, intermediate frames are skipped.
+    bool wsBroadcastThread = false;
 
     //
     // Params used only by netImgui
@@ -77,6 +77,90 @@ struct OpenGlOptions
 bool hasEdrSupport();
 
 
+// `VulkanPresentMode`: the presentation mode of the Vulkan swapchain
+enum class VulkanPresentMode
+{
+    // Wait for the vertical blank (vsync). Always available.
+    // (if framePacing.vsync is false, Immediate is used instead)
+    Fifo,
+    // Replace the queued image at each present: no tearing, and the latest image is shown at the next vblank
+    // (lower latency than Fifo, the GPU may render more frames than displayed)
+    Mailbox,
+    // Present immediately: lowest latency, but may tear
+    Immediate
+};
+
+
+// FramePacingOptions: controls when the frames are started and presented.
+// By default, the frames are synchronized on the screen refresh (vsync), and the input events
+// are polled right after the previous frame was presented.
+// For applications where the input-to-photon latency matters, use `justInTime`.
+struct FramePacingOptions
+{
+    // `vsync`: _bool, default=true_.
+    // Wait for the vertical blank when presenting (swap interval 1 on OpenGL and DirectX, Fifo on Vulkan
+    // unless `vulkanPresentMode` is set).
+    bool vsync = true;
+
+    // `targetFps`: _float, default=0_.
+    // If > 0, the frame rate will be limited to this value (by sleeping before polling the events),
+    // independently of vsync. If 0, the frame rate is only limited by vsync (and by FpsIdling).
+    float targetFps = 0.f;
+
+    // `justInTime`: _bool, default=false_.
+    // If true, HelloImGui sleeps until shortly before the next vblank before polling the input events,
+    // so that the frame is rendered with the most recent input, just in time to be presented.
+    // The duration of a frame is measured at each frame, and `justInTimeMarginMs` is added to it.
+    // (with vsync, the vblank is estimated from the monitor refresh rate and the previous presentations;
+    //  without vsync, it is the next frame at `targetFps`).
+    // Note: if a frame takes longer than expected, it will miss the vblank (one refresh period later):
+    //       increase justInTimeMarginMs if this happens often.
+    bool justInTime = false;
+    // `justInTimeMarginMs`: _float, default=2_.
+    // Safety margin (in milliseconds) between the expected end of the frame and the vblank.
+    float justInTimeMarginMs = 2.f;
+
+    // `vulkanPresentMode`: _VulkanPresentMode, default=Fifo_.
+    // Vulkan only. Falls back to Fifo if the mode is not supported by the driver.
+    // Mailbox and Immediate do not wait for the vblank (vsync is then ignored).
+    VulkanPresentMode vulkanPresentMode = VulkanPresentMode::Fifo;
+};
+
+
+// FramePacingStats: measures of the frame pacing (see HelloImGui::GetFramePacingStats())
+struct FramePacingStats
+{
+    // Input latency: duration between the moment the input events were polled,
+    // and the moment the frame which handled them was presented (i.e. when the swap returned;
+    // with vsync, this is the vblank. Without vsync, the image may be displayed a bit later.)
+    // Measured on the frames which received input events, over the last 120 such frames.
+    float inputLatencyMs_Last = 0.f;
+    float inputLatencyMs_Mean = 0.f;
+    float inputLatencyMs_Max = 0.f;
+
+    // Estimated duration of a frame (from the event polling to the swap), used by justInTime
+    float frameDurationMs_Estimated = 0.f;
+    // Duration of the last sleep added by the frame pacing (targetFps / justInTime)
+    float pacingSleepMs_Last = 0.f;
+};
+
+
+// ViewportRenderStats: measures of the rendering of a secondary viewport (see HelloImGui::GetViewportsRenderStats())
+struct ViewportRenderStats
+{
+    // The ImGuiID of the viewport
+    unsigned int viewportId = 0;
+    // Duration of the render and present of the viewport (CPU side): last rendered frame, and moving average
+    float renderMs_Last = 0.f;
+    float renderMs_Mean = 0.f;
+    // Number of frames where the viewport was rendered and presented
+    int nbRenderedFrames = 0;
+    // Number of frames where the render and present were skipped, because the viewport content did not change
+    // (see ImGuiWindowParams.viewportsSkipUnchangedFrames)
+    int nbSkippedPresents = 0;
+};
+
+
 // RendererBackendOptions is a struct that contains options for the renderer backend
 // (Metal, Vulkan, DirectX, OpenGL)
 struct RendererBackendOptions
@@ -90,6 +174,23 @@ struct RendererBackendOptions
     // `openGlOptions`:
     // Advanced options for OpenGL. Use at your own risk.
     OpenGlOptions openGlOptions;
+
+    // `framePacing`:
+    // vsync, target frame rate, just-in-time input polling, and Vulkan present mode
+    FramePacingOptions framePacing;
+
+    // `vulkanPersistentPipelineCache`: _bool, default=true_.
+    // Only used with Vulkan: the pipeline cache is saved at exit into a file next to the ini file
+    // (e.g. "MyApp_vulkan_pipeline_cache.bin"), and loaded at startup, so that the pipelines
+    // (including those of the secondary viewports) are not recompiled by the driver at each launch.
+    // The cache is ignored when the GPU or the driver changed.
+    bool vulkanPersistentPipelineCache = true;
+
+    // `vulkanGrowableDescriptorPools`: _bool, default=false_.
+    // Only used with Vulkan (experimental): the descriptor sets of the textures (ImageFromAsset, ...) are
+    // allocated from growable pools and recycled, instead of ImGui_ImplVulkan_AddTexture, whose pool
+    // holds 100 sets (see VulkanGlobals.PoolCreateInfo_MaxSets).
+    bool vulkanGrowableDescriptorPools = false;
 };
 
 
@@ -7,6 +7,9 @@
 #include "hello_imgui/remote_params.h"
 #include "hello_imgui/renderer_backend_options.h"
 #include "hello_imgui/dpi_aware.h"
+#include "hello_imgui/image_from_asset.h"
+#include "hello_imgui/imgui_allocator_params.h"
+#include <string>
 #include <vector>
 
 namespace HelloImGui
@@ -161,6 +164,54 @@ struct FpsIdling
 // @@md
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+// @@md#TestEngineParams
+
+// TestEngineParams: options for ImGui Test Engine (only used if RunnerParams.useImGuiTestEngine is true)
+struct TestEngineParams
+{
+    // `runFast`: _bool, default=false_.
+    //  If true, tests run at full speed (ImGuiTestRunSpeed_Fast).
+    //  Otherwise, they run at human speed (ImGuiTestRunSpeed_Normal), so that you can watch them.
+    bool runFast = false;
+
+    // `headless`: _bool, default=false_.
+    //  Headless mode, for CI: the application runs with the Null backends (no window),
+    //  at full speed, without idling. It runs the registered tests which match `testFilter`,
+    //  then exits (HelloImGui::Run returns). The results are stored in `nbTestsTested` and `nbTestsSucceeded`.
+    //  Note: screen captures are not available with the Null backends.
+    bool headless = false;
+
+    // `testFilter`: _string, default="all"_.
+    //  Tests run in headless mode (same syntax as ImGuiTestEngine_QueueTests, e.g. "all", "demo_tests", "-capture")
+    std::string testFilter = "all";
+
+    // `shardIndex`, `shardCount`: _int, default=0, 1_.
+    //  In headless mode, run only the tests whose index (among the tests matching testFilter)
+    //  modulo shardCount is shardIndex (e.g. to split the tests between several CI machines).
+    int shardIndex = 0;
+    int shardCount = 1;
+
+    // `nbWorkerProcesses`: _int, default=1_.
+    //  In headless mode, if > 1, the executable relaunches itself in nbWorkerProcesses worker processes
+    //  (with the same arguments), each one running a shard of the tests with its own ImGui context,
+    //  and HelloImGui::Run returns when they are all done.
+    //  Only available on Windows, macOS and Linux.
+    int nbWorkerProcesses = 1;
+
+    // `junitXmlFilename`: _string, default=""_.
+    //  In headless mode, if not empty, the results are saved in this file as JUnit XML
+    //  (the results of the worker processes are merged into it).
+    std::string junitXmlFilename;
+
+    // `nbTestsTested`, `nbTestsSucceeded`: _int_. Results of the headless run (output)
+    int nbTestsTested = 0;
+    int nbTestsSucceeded = 0;
+};
+// @@md
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 // @@md#RunnerParams
@@ -283,6 +334,42 @@ struct RunnerParams
     //  Paid for larger businesses.)
     bool useImGuiTestEngine = false;
 
+    // `testEngineParams`: _TestEngineParams_.
+    //  Options for ImGui Test Engine (run speed, headless mode for CI, etc.)
+    TestEngineParams testEngineParams;
+
+    // `imGuiAllocatorParams`: _ImGuiAllocatorParams_.
+    //  Instrumentation of the ImGui allocations (allocations per frame, high-water marks, size class pool)
+    ImGuiAllocatorParams imGuiAllocatorParams;
+
+    // `startupTraceFilename`: _string, default=""_.
+    //  If not empty, the steps of the application startup (until the first visible frame)
+    //  are recorded and saved into this file, in the Chrome trace format
+    //  (open it with chrome://tracing or https://ui.perfetto.dev).
+    //  It can also be set with the environment variable HELLOIMGUI_STARTUP_TRACE.
+    std::string startupTraceFilename = "";
+
+    // `assetsToPrefetch`: _vector<string>, default=empty_.
+    //  Assets that will be read on a worker thread while the application window is being created,
+    //  e.g. the fonts loaded by callbacks.LoadAdditionalFonts (the default fonts and the window icon
+    //  are prefetched automatically). Each prefetched asset is freed once loaded; the unused ones
+    //  are freed when the window is shown.
+    std::vector<std::string> assetsToPrefetch;
+
+    // `imageAtlasParams`: _see image_from_asset.h_.
+    //  Packs the small images of ImageFromAsset into shared textures (disabled by default).
+    ImageAtlasParams imageAtlasParams;
+
+    // `imageLoadingParams`: _see image_from_asset.h_.
+    //  Pre-compressed textures (.ktx2 / .dds) and mipmaps for the images of ImageFromAsset.
+    ImageLoadingParams imageLoadingParams;
+
+    // `nbAsyncWorkerThreads`: _int, default=0_.
+    //  Number of worker threads used by HelloImGui::Async() (see hello_imgui_async.h).
+    //  If 0, the number of hardware threads minus one (at least one).
+    //  The threads are started by the first call to Async().
+    int nbAsyncWorkerThreads = 0;
+
     // `emscripten_fps`: _int, default = 0_.
     // Set the application refresh rate
     // (only used on emscripten: 0 stands for "let the app or the browser decide")
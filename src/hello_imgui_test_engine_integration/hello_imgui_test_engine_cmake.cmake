@@ -77,6 +77,8 @@ function(_add_hello_imgui_test_engine_integration)
     target_sources(hello_imgui PRIVATE
         ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/test_engine_integration.cpp
         ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/test_engine_integration.h
+        ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/test_engine_headless.cpp
+        ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/test_engine_headless.h
         )
     target_include_directories(hello_imgui PUBLIC $<BUILD_INTERFACE:${CMAKE_CURRENT_FUNCTION_LIST_DIR}/..>)
 endfunction()
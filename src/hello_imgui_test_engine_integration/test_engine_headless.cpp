@@ -0,0 +1,316 @@
+#include "hello_imgui_test_engine_integration/test_engine_headless.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <sstream>
+
+#ifdef __APPLE__
+#include <TargetConditionals.h>
+#endif
+
+#if defined(_WIN32)
+    #define HELLOIMGUI_TEST_WORKERS_WINDOWS
+    #ifndef NOMINMAX
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+#elif (defined(__linux__) && !defined(__ANDROID__)) || (defined(__APPLE__) && TARGET_OS_OSX)
+    #define HELLOIMGUI_TEST_WORKERS_POSIX
+    #include <spawn.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+    #ifdef __APPLE__
+        #include <crt_externs.h>
+        #include <mach-o/dyld.h>
+    #endif
+    extern char **environ;
+#endif
+
+
+namespace HelloImGui
+{
+    namespace TestEngineHeadless
+    {
+        // Environment variables sent to the worker processes
+        const char* kEnvShard = "HELLOIMGUI_TEST_SHARD";        // "shardIndex/shardCount"
+        const char* kEnvJUnitXml = "HELLOIMGUI_TEST_JUNIT_XML";  // where the worker saves its results
+
+        bool ApplyWorkerShard(TestEngineParams* testEngineParams)
+        {
+            const char* shard = std::getenv(kEnvShard);
+            if (shard == nullptr)
+                return false;
+            int shardIndex = 0, shardCount = 1;
+            if (sscanf(shard, "%d/%d", &shardIndex, &shardCount) != 2 || shardCount < 1 || shardIndex < 0 || shardIndex >= shardCount)
+            {
+                fprintf(stderr, "HelloImGui: invalid %s=%s\n", kEnvShard, shard);
+                return false;
+            }
+            testEngineParams->headless = true;
+            testEngineParams->nbWorkerProcesses = 1;
+            testEngineParams->shardIndex = shardIndex;
+            testEngineParams->shardCount = shardCount;
+            const char* junitXml = std::getenv(kEnvJUnitXml);
+            testEngineParams->junitXmlFilename = (junitXml != nullptr) ? junitXml : "";
+            return true;
+        }
+
+
+        // ---------------------------- JUnit XML merge ----------------------------
+
+        std::string _ReadFile(const std::string& filename, bool* ok)
+        {
+            std::ifstream is(filename, std::ios::binary);
+            *ok = is.good();
+            std::stringstream ss;
+            ss << is.rdbuf();
+            return ss.str();
+        }
+
+        int _IntAttribute(const std::string& tag, const char* name)
+        {
+            std::smatch match;
+            std::regex attributeRegex(std::string("\\s") + name + "=\"([0-9]+)\"");
+            if (std::regex_search(tag, match, attributeRegex))
+                return std::stoi(match[1].str());
+            return 0;
+        }
+
+        JUnitMergeResult MergeJUnitXmlFiles(const std::vector<std::string>& inputFilenames, const std::string& outputFilename)
+        {
+            JUnitMergeResult r;
+            std::string testSuites;
+            for (size_t i = 0; i < inputFilenames.size(); ++i)
+            {
+                bool ok;
+                std::string content = _ReadFile(inputFilenames[i], &ok);
+                size_t tagStart = ok ? content.find("<testsuites") : std::string::npos;
+                size_t tagEnd = (tagStart != std::string::npos) ? content.find('>', tagStart) : std::string::npos;
+                size_t closingTag = (tagEnd != std::string::npos) ? content.find("</testsuites>", tagEnd) : std::string::npos;
+                if (closingTag == std::string::npos)
+                {
+                    std::string name = "worker_" + std::to_string(i);
+                    testSuites += "  <testsuite name=\"" + name + "\" tests=\"1\" failures=\"1\" errors=\"0\">\n"
+                                  "    <testcase name=\"" + name + "\" classname=\"hello_imgui\">\n"
+                                  "      <failure message=\"The worker process did not produce results (crash?)\"></failure>\n"
+                                  "    </testcase>\n"
+                                  "  </testsuite>\n";
+                    r.nbTests += 1;
+                    r.nbFailures += 1;
+                    continue;
+                }
+                std::string tag = content.substr(tagStart, tagEnd - tagStart);
+                r.nbTests += _IntAttribute(tag, "tests");
+                r.nbFailures += _IntAttribute(tag, "failures") + _IntAttribute(tag, "errors");
+                std::string suites = content.substr(tagEnd + 1, closingTag - tagEnd - 1);
+                size_t first = suites.find_first_not_of(" \t\r\n"), last = suites.find_last_not_of(" \t\r\n");
+                if (first != std::string::npos)
+                    testSuites += "  " + suites.substr(first, last - first + 1) + "\n";
+            }
+
+            if (!outputFilename.empty())
+            {
+                std::ofstream os(outputFilename, std::ios::binary);
+                os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+                os << "<testsuites tests=\"" << r.nbTests << "\" failures=\"" << r.nbFailures << "\" errors=\"0\">\n";
+                os << testSuites;
+                os << "</testsuites>\n";
+                if (!os.good())
+                    fprintf(stderr, "HelloImGui: failed to write %s\n", outputFilename.c_str());
+            }
+            return r;
+        }
+
+
+        // ---------------------------- Worker processes ----------------------------
+
+    #if defined(HELLOIMGUI_TEST_WORKERS_POSIX)
+        std::string _ExecutablePath()
+        {
+        #ifdef __APPLE__
+            char path[4096];
+            uint32_t size = sizeof(path);
+            if (_NSGetExecutablePath(path, &size) != 0)
+                return "";
+            return path;
+        #else
+            std::error_code ec;
+            return std::filesystem::read_symlink("/proc/self/exe", ec).string();
+        #endif
+        }
+
+        std::vector<std::string> _CommandLineArguments()
+        {
+            std::vector<std::string> r;
+        #ifdef __APPLE__
+            int argc = *_NSGetArgc();
+            char** argv = *_NSGetArgv();
+            for (int i = 0; i < argc; ++i)
+                r.push_back(argv[i]);
+        #else
+            bool ok;
+            std::string cmdline = _ReadFile("/proc/self/cmdline", &ok);
+            std::stringstream ss(cmdline);
+            std::string arg;
+            while (std::getline(ss, arg, '\0'))
+                r.push_back(arg);
+        #endif
+            return r;
+        }
+
+        // Launches the workers, and returns their exit codes
+        bool _LaunchWorkersAndWait(const std::vector<std::string>& workerEnvironments, std::vector<int>* exitCodes)
+        {
+            std::string executable = _ExecutablePath();
+            std::vector<std::string> arguments = _CommandLineArguments();
+            if (executable.empty() || arguments.empty())
+                return false;
+            std::vector<char*> argv;
+            for (auto& argument: arguments)
+                argv.push_back(argument.data());
+            argv.push_back(nullptr);
+
+            std::vector<pid_t> pids;
+            for (const auto& workerEnvironment: workerEnvironments)
+            {
+                // The environment of the worker: ours, plus its shard
+                std::vector<std::string> environment;
+                for (char** env = environ; *env != nullptr; ++env)
+                    environment.push_back(*env);
+                std::stringstream ss(workerEnvironment);
+                std::string variable;
+                while (std::getline(ss, variable, '\n'))
+                    environment.push_back(variable);
+                std::vector<char*> envp;
+                for (auto& envVariable: environment)
+                    envp.push_back(envVariable.data());
+                envp.push_back(nullptr);
+
+                pid_t pid;
+                if (posix_spawn(&pid, executable.c_str(), nullptr, nullptr, argv.data(), envp.data()) != 0)
+                {
+                    fprintf(stderr, "HelloImGui: failed to launch a test worker process\n");
+                    pid = -1;
+                }
+                pids.push_back(pid);
+            }
+
+            for (pid_t pid: pids)
+            {
+                int exitCode = -1;
+                int status = 0;
+                if (pid > 0 && waitpid(pid, &status, 0) == pid)
+                    exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+                exitCodes->push_back(exitCode);
+            }
+            return true;
+        }
+
+        int _ProcessId() { return (int)getpid(); }
+
+    #elif defined(HELLOIMGUI_TEST_WORKERS_WINDOWS)
+        bool _LaunchWorkersAndWait(const std::vector<std::string>& workerEnvironments, std::vector<int>* exitCodes)
+        {
+            wchar_t executable[MAX_PATH];
+            if (GetModuleFileNameW(nullptr, executable, MAX_PATH) == 0)
+                return false;
+
+            // The workers inherit our environment, to which their shard is temporarily added
+            auto setWorkerEnvironment = [](const std::string& workerEnvironment, bool set) {
+                std::stringstream ss(workerEnvironment);
+                std::string variable;
+                while (std::getline(ss, variable, '\n'))
+                {
+                    size_t eq = variable.find('=');
+                    std::string name = variable.substr(0, eq);
+                    SetEnvironmentVariableA(name.c_str(), set ? variable.substr(eq + 1).c_str() : nullptr);
+                }
+            };
+
+            std::vector<HANDLE> processes;
+            for (const auto& workerEnvironment: workerEnvironments)
+            {
+                std::wstring commandLine = GetCommandLineW();  // CreateProcessW may modify it
+                STARTUPINFOW startupInfo = {};
+                startupInfo.cb = sizeof(startupInfo);
+                PROCESS_INFORMATION processInfo = {};
+
+                setWorkerEnvironment(workerEnvironment, true);
+                BOOL ok = CreateProcessW(executable, commandLine.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startupInfo, &processInfo);
+                setWorkerEnvironment(workerEnvironment, false);
+                if (!ok)
+                {
+                    fprintf(stderr, "HelloImGui: failed to launch a test worker process\n");
+                    processes.push_back(nullptr);
+                    continue;
+                }
+                CloseHandle(processInfo.hThread);
+                processes.push_back(processInfo.hProcess);
+            }
+
+            for (HANDLE process: processes)
+            {
+                int exitCode = -1;
+                if (process != nullptr)
+                {
+                    WaitForSingleObject(process, INFINITE);
+                    DWORD code;
+                    if (GetExitCodeProcess(process, &code))
+                        exitCode = (int)code;
+                    CloseHandle(process);
+                }
+                exitCodes->push_back(exitCode);
+            }
+            return true;
+        }
+
+        int _ProcessId() { return (int)GetCurrentProcessId(); }
+    #endif
+
+        bool RunWorkerProcesses(TestEngineParams* testEngineParams)
+        {
+        #if defined(HELLOIMGUI_TEST_WORKERS_POSIX) || defined(HELLOIMGUI_TEST_WORKERS_WINDOWS)
+            int nbWorkers = testEngineParams->nbWorkerProcesses;
+            std::filesystem::path tempDir = std::filesystem::temp_directory_path();
+            std::vector<std::string> resultFiles, workerEnvironments;
+            for (int i = 0; i < nbWorkers; ++i)
+            {
+                std::string resultFile = (tempDir / ("hello_imgui_tests_" + std::to_string(_ProcessId()) + "_" + std::to_string(i) + ".xml")).string();
+                std::error_code ec;
+                std::filesystem::remove(resultFile, ec);
+                resultFiles.push_back(resultFile);
+                workerEnvironments.push_back(
+                    std::string(kEnvShard) + "=" + std::to_string(i) + "/" + std::to_string(nbWorkers) + "\n"
+                    + kEnvJUnitXml + "=" + resultFile);
+            }
+
+            printf("HelloImGui: running tests in %d worker processes\n", nbWorkers);
+            fflush(stdout);
+            std::vector<int> exitCodes;
+            if (!_LaunchWorkersAndWait(workerEnvironments, &exitCodes))
+                return false;
+            for (size_t i = 0; i < exitCodes.size(); ++i)
+                if (exitCodes[i] != 0)
+                    fprintf(stderr, "HelloImGui: test worker %d exited with code %d\n", (int)i, exitCodes[i]);
+
+            JUnitMergeResult merged = MergeJUnitXmlFiles(resultFiles, testEngineParams->junitXmlFilename);
+            for (const auto& resultFile: resultFiles)
+            {
+                std::error_code ec;
+                std::filesystem::remove(resultFile, ec);
+            }
+
+            testEngineParams->nbTestsTested = merged.nbTests;
+            testEngineParams->nbTestsSucceeded = merged.nbTests - merged.nbFailures;
+            printf("HelloImGui: tests succeeded: %d/%d\n", testEngineParams->nbTestsSucceeded, testEngineParams->nbTestsTested);
+            return true;
+        #else
+            (void)testEngineParams;
+            return false;
+        #endif
+        }
+    } // namespace TestEngineHeadless
+}
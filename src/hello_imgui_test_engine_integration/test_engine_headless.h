@@ -0,0 +1,32 @@
+#pragma once
+#include "hello_imgui/runner_params.h"
+
+#include <string>
+#include <vector>
+
+
+namespace HelloImGui
+{
+    // Headless test runs, possibly split between several worker processes (see TestEngineParams)
+    namespace TestEngineHeadless
+    {
+        // If this process is a worker launched by RunWorkerProcesses(), applies its shard to testEngineParams.
+        // Returns true for a worker process.
+        bool ApplyWorkerShard(TestEngineParams* testEngineParams);
+
+        // Relaunches the executable in testEngineParams->nbWorkerProcesses worker processes (with the same arguments),
+        // waits for them, merges their results, and stores them in testEngineParams.
+        // Returns false if worker processes are not supported on this platform.
+        bool RunWorkerProcesses(TestEngineParams* testEngineParams);
+
+        struct JUnitMergeResult
+        {
+            int nbTests = 0;
+            int nbFailures = 0;   // failures + errors
+        };
+
+        // Merges the JUnit XML files written by the worker processes into outputFilename (if not empty).
+        // A missing input file (e.g. a crashed worker) is reported as a failed test suite.
+        JUnitMergeResult MergeJUnitXmlFiles(const std::vector<std::string>& inputFilenames, const std::string& outputFilename);
+    } // namespace TestEngineHeadless
+}
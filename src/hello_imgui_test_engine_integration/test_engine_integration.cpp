@@ -1,8 +1,15 @@
+#include "hello_imgui/internal/imgui_global_context.h" // must be included before imgui_internal.h
 #include "imgui_test_engine/imgui_te_engine.h"
+#include "imgui_test_engine/imgui_te_exporters.h"
+#include "imgui_test_engine/imgui_te_internal.h"
+#include "hello_imgui/hello_imgui.h"
 #include "hello_imgui/runner_params.h"
+#include "hello_imgui_test_engine_integration/test_engine_headless.h"
 #include "hello_imgui/internal/functional_utils.h"
 #include "hello_imgui/internal/backend_impls/opengl_setup_helper/opengl_screenshot.h"
 
+#include <cstdio>
+
 namespace HelloImGui
 {
     ImGuiTestEngine *GHImGuiTestEngine = nullptr;
@@ -12,13 +19,25 @@ namespace HelloImGui
 
         void _SetOptions()
         {
+            RunnerParams& params = *HelloImGui::GetRunnerParams();
+            const TestEngineParams& testEngineParams = params.testEngineParams;
+
             ImGuiTestEngineIO& test_io = ImGuiTestEngine_GetIO(GHImGuiTestEngine);
             test_io.ConfigVerboseLevel = ImGuiTestVerboseLevel_Info;
             test_io.ConfigVerboseLevelOnError = ImGuiTestVerboseLevel_Debug;
-            test_io.ConfigRunSpeed = ImGuiTestRunSpeed_Normal; // Default to slowest mode in this demo
+            bool runFast = testEngineParams.runFast || testEngineParams.headless;
+            test_io.ConfigRunSpeed = runFast ? ImGuiTestRunSpeed_Fast : ImGuiTestRunSpeed_Normal; // Default to slowest mode
+
+            if (testEngineParams.headless)
+            {
+                // No window: run as fast as possible
+                test_io.ConfigNoThrottle = true;
+                params.fpsIdling.enableIdling = false;
+            }
 
 #ifdef HELLOIMGUI_HAS_OPENGL
-            test_io.ScreenCaptureFunc = HelloImGui::ImGuiApp_ImplGL_CaptureFramebuffer;
+            if (params.rendererBackendType == RendererBackendType::OpenGL3)
+                test_io.ScreenCaptureFunc = HelloImGui::ImGuiApp_ImplGL_CaptureFramebuffer;
 #endif
         }
 
@@ -56,5 +75,77 @@ namespace HelloImGui
             return r;
         }
 
+
+        // Headless mode: queue the tests once they are registered, and exit when they are done
+        enum class HeadlessRunState
+        {
+            WaitingForTests,
+            Running,
+            Done
+        };
+        HeadlessRunState gHeadlessRunState = HeadlessRunState::WaitingForTests;
+
+        void _QueueHeadlessTests(const TestEngineParams& testEngineParams)
+        {
+            ImGuiTestEngine_QueueTests(GHImGuiTestEngine, ImGuiTestGroup_Tests, testEngineParams.testFilter.c_str());
+
+            // Keep only the tests of our shard
+            if (testEngineParams.shardCount > 1)
+            {
+                ImVector<ImGuiTestRunTask>& queue = GHImGuiTestEngine->TestsQueue;
+                ImVector<ImGuiTestRunTask> shardQueue;
+                for (int i = 0; i < queue.Size; ++i)
+                    if (i % testEngineParams.shardCount == testEngineParams.shardIndex)
+                        shardQueue.push_back(queue[i]);
+                queue.swap(shardQueue);
+            }
+        }
+
+        void HeadlessRun_OnFrame()
+        {
+            RunnerParams& params = *HelloImGui::GetRunnerParams();
+            TestEngineParams& testEngineParams = params.testEngineParams;
+            if (!testEngineParams.headless)
+                return;
+
+            if (gHeadlessRunState == HeadlessRunState::WaitingForTests && params.callbacks.registerTestsCalled)
+            {
+                _QueueHeadlessTests(testEngineParams);
+                gHeadlessRunState = HeadlessRunState::Running;
+            }
+            else if (gHeadlessRunState == HeadlessRunState::Running && ImGuiTestEngine_IsTestQueueEmpty(GHImGuiTestEngine))
+            {
+                ImGuiTestEngineResultSummary summary;
+                ImGuiTestEngine_GetResultSummary(GHImGuiTestEngine, &summary);
+                testEngineParams.nbTestsTested = summary.CountTested;
+                testEngineParams.nbTestsSucceeded = summary.CountSuccess;
+                ImGuiTestEngine_PrintResultSummary(GHImGuiTestEngine);
+                if (!testEngineParams.junitXmlFilename.empty())
+                    ImGuiTestEngine_ExportEx(GHImGuiTestEngine, ImGuiTestEngineExportFormat_JUnitXml, testEngineParams.junitXmlFilename.c_str());
+
+                gHeadlessRunState = HeadlessRunState::Done;
+                params.appShallExit = true;
+            }
+        }
+
+        bool RunInWorkerProcessesIfNeeded(RunnerParams& params)
+        {
+            if (!params.useImGuiTestEngine)
+                return false;
+            gHeadlessRunState = HeadlessRunState::WaitingForTests;
+            if (TestEngineHeadless::ApplyWorkerShard(&params.testEngineParams))
+                return false;  // We are a worker: run our shard
+
+            const TestEngineParams& testEngineParams = params.testEngineParams;
+            if (!testEngineParams.headless || testEngineParams.nbWorkerProcesses <= 1)
+                return false;
+            if (!TestEngineHeadless::RunWorkerProcesses(&params.testEngineParams))
+            {
+                fprintf(stderr, "HelloImGui: test worker processes are not supported on this platform, running the tests in-process\n");
+                return false;
+            }
+            return true;
+        }
+
     } // namespace TestEngineCallbacks
 }
\ No newline at end of file
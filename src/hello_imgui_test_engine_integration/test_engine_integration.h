@@ -11,5 +11,11 @@ namespace HelloImGui
         void TearDown_ImGuiContextDestroyed();
 
         bool IsRunningTest();
+
+        // Headless mode (see TestEngineParams.headless): queues the tests, and exits the app when they are done
+        void HeadlessRun_OnFrame();
+        // Called before the app starts: in headless mode with nbWorkerProcesses > 1, runs the tests
+        // in worker processes, and returns true (the app shall then not be run in this process)
+        bool RunInWorkerProcessesIfNeeded(RunnerParams& params);
     } // namespace TestEngineCallbacks
 }
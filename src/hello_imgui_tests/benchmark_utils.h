@@ -0,0 +1,17 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+
+
+// Helpers for the micro-benchmarks of hello_imgui_benchmarks (which are not run by hello_imgui_tests)
+
+// Average duration of fn (in milliseconds), after a warm up call
+template<typename Fn>
+double MeasureMs(Fn&& fn, int nbRuns = 5)
+{
+    fn();
+    auto start = std::chrono::steady_clock::now();
+    for (int run = 0; run < nbRuns; ++run)
+        fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / nbRuns;
+}
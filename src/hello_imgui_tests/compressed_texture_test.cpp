@@ -0,0 +1,118 @@
+#include "doctest.h"
+#include "hello_imgui/internal/compressed_texture.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace HelloImGui;
+
+
+static void PutU32(std::vector<unsigned char>& v, size_t offset, uint32_t value) { memcpy(v.data() + offset, &value, 4); }
+static void PutU64(std::vector<unsigned char>& v, size_t offset, uint64_t value) { memcpy(v.data() + offset, &value, 8); }
+
+// A DDS file with a full mip chain
+static std::vector<unsigned char> MakeDds(const char* fourCC, uint32_t width, uint32_t height, uint32_t mipMapCount, size_t dataSize)
+{
+    std::vector<unsigned char> file(128 + dataSize, 0);
+    memcpy(file.data(), "DDS ", 4);
+    PutU32(file, 4, 124);
+    PutU32(file, 12, height);
+    PutU32(file, 16, width);
+    PutU32(file, 28, mipMapCount);
+    PutU32(file, 80, 0x4);  // DDPF_FOURCC
+    memcpy(file.data() + 84, fourCC, 4);
+    return file;
+}
+
+static std::vector<unsigned char> MakeKtx2(uint32_t vkFormat, uint32_t width, uint32_t height, const std::vector<size_t>& levelSizes)
+{
+    static const unsigned char identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+    size_t dataOffset = 80 + levelSizes.size() * 24;
+    size_t totalSize = dataOffset;
+    for (size_t s: levelSizes)
+        totalSize += s;
+    std::vector<unsigned char> file(totalSize, 0);
+    memcpy(file.data(), identifier, 12);
+    PutU32(file, 12, vkFormat);
+    PutU32(file, 20, width);
+    PutU32(file, 24, height);
+    PutU32(file, 36, 1);  // faceCount
+    PutU32(file, 40, (uint32_t)levelSizes.size());
+    for (size_t i = 0; i < levelSizes.size(); ++i)
+    {
+        PutU64(file, 80 + i * 24, dataOffset);
+        PutU64(file, 80 + i * 24 + 8, levelSizes[i]);
+        dataOffset += levelSizes[i];
+    }
+    return file;
+}
+
+TEST_CASE("CompressedTexture: level sizes")
+{
+    CHECK(CompressedLevelDataSize(CompressedTextureFormat::BC1, 256, 256) == 64 * 64 * 8);
+    CHECK(CompressedLevelDataSize(CompressedTextureFormat::BC7, 256, 256) == 64 * 64 * 16);
+    CHECK(CompressedLevelDataSize(CompressedTextureFormat::BC1_RGBA, 256, 256) == 64 * 64 * 8);
+    CHECK(CompressedLevelDataSize(CompressedTextureFormat::BC3, 1, 1) == 16);
+    CHECK(CompressedLevelDataSize(CompressedTextureFormat::ETC2_RGB8, 5, 9) == 2 * 3 * 8);
+    CHECK(IsCompressedTextureFilename("maps/world.KTX2"));
+    CHECK(IsCompressedTextureFilename("world.dds"));
+    CHECK(!IsCompressedTextureFilename("world.png"));
+}
+
+TEST_CASE("CompressedTexture: DDS")
+{
+    // 16x8 BC1 with 3 levels: 16x8 (64 bytes), 8x4 (16 bytes), 4x2 (8 bytes)
+    auto file = MakeDds("DXT1", 16, 8, 3, 64 + 16 + 8);
+    CompressedTexture texture;
+    std::string error;
+    REQUIRE(ParseCompressedTexture(file.data(), file.size(), &texture, &error));
+    CHECK(texture.Format == CompressedTextureFormat::BC1);
+    REQUIRE(texture.Levels.size() == 3);
+    CHECK(texture.Width() == 16);
+    CHECK(texture.Levels[2].Width == 4);
+    CHECK(texture.Levels[2].Height == 2);
+    CHECK(texture.Levels[1].Data == file.data() + 128 + 64);
+
+    // Truncated
+    CHECK(!ParseCompressedTexture(file.data(), file.size() - 1, &texture, &error));
+    CHECK(error.find("truncated") != std::string::npos);
+
+    // Unsupported format
+    auto fileDxt3 = MakeDds("DXT3", 16, 8, 1, 128);
+    CHECK(!ParseCompressedTexture(fileDxt3.data(), fileDxt3.size(), &texture, &error));
+}
+
+TEST_CASE("CompressedTexture: KTX2")
+{
+    // 8x8 BC7 (vkFormat 145), 4 levels: 8x8, 4x4, 2x2, 1x1
+    auto file = MakeKtx2(145, 8, 8, { 64, 16, 16, 16 });
+    CompressedTexture texture;
+    std::string error;
+    REQUIRE(ParseCompressedTexture(file.data(), file.size(), &texture, &error));
+    CHECK(texture.Format == CompressedTextureFormat::BC7);
+    REQUIRE(texture.Levels.size() == 4);
+    CHECK(texture.Levels[3].Width == 1);
+    CHECK(texture.Levels[0].DataSize == 64);
+
+    // ASTC 4x4 (vkFormat 157)
+    auto fileAstc = MakeKtx2(157, 4, 4, { 16 });
+    REQUIRE(ParseCompressedTexture(fileAstc.data(), fileAstc.size(), &texture, &error));
+    CHECK(texture.Format == CompressedTextureFormat::ASTC_4x4);
+
+    // BC1, with or without alpha (vkFormat 131 and 133)
+    auto fileBc1 = MakeKtx2(131, 4, 4, { 8 });
+    REQUIRE(ParseCompressedTexture(fileBc1.data(), fileBc1.size(), &texture, &error));
+    CHECK(texture.Format == CompressedTextureFormat::BC1);
+    auto fileBc1Rgba = MakeKtx2(133, 4, 4, { 8 });
+    REQUIRE(ParseCompressedTexture(fileBc1Rgba.data(), fileBc1Rgba.size(), &texture, &error));
+    CHECK(texture.Format == CompressedTextureFormat::BC1_RGBA);
+
+    // Supercompressed files are rejected
+    PutU32(file, 44, 1);
+    CHECK(!ParseCompressedTexture(file.data(), file.size(), &texture, &error));
+
+    // Not a texture
+    std::vector<unsigned char> png = { 0x89, 'P', 'N', 'G', 0, 0, 0, 0 };
+    CHECK(!ParseCompressedTexture(png.data(), png.size(), &texture, &error));
+}
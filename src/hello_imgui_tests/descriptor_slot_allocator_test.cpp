@@ -0,0 +1,58 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/descriptor_slot_allocator.h"
+
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace HelloImGui;
+
+
+TEST_CASE("DescriptorSlotAllocator: the pools grow geometrically, up to the max capacity")
+{
+    DescriptorSlotAllocator allocator(4, 16);
+    std::set<std::pair<int, int>> slots;
+    for (int i = 0; i < 4 + 8 + 16 + 16; ++i)
+    {
+        auto slot = allocator.Allocate();
+        CHECK(!slot.Recycled);
+        CHECK(slot.IndexInPool < allocator.PoolCapacity(slot.PoolIndex));
+        slots.insert({slot.PoolIndex, slot.IndexInPool});
+    }
+    CHECK(slots.size() == 44);
+    REQUIRE(allocator.NbPools() == 4);
+    CHECK(allocator.PoolCapacity(0) == 4);
+    CHECK(allocator.PoolCapacity(1) == 8);
+    CHECK(allocator.PoolCapacity(2) == 16);
+    CHECK(allocator.PoolCapacity(3) == 16);
+    CHECK(allocator.NbUsedSlots() == 44);
+
+    allocator.Allocate();
+    CHECK(allocator.NbPools() == 5);
+}
+
+TEST_CASE("DescriptorSlotAllocator: the freed slots are recycled before adding a pool")
+{
+    DescriptorSlotAllocator allocator(8, 64);
+    std::vector<DescriptorSlotAllocator::Slot> slots;
+    for (int i = 0; i < 8; ++i)
+        slots.push_back(allocator.Allocate());
+    allocator.Free(slots[2]);
+    allocator.Free(slots[5]);
+    CHECK(allocator.NbUsedSlots() == 6);
+    CHECK(allocator.NbRecyclableSlots() == 2);
+
+    auto a = allocator.Allocate();
+    auto b = allocator.Allocate();
+    CHECK(a.Recycled);
+    CHECK(b.Recycled);
+    std::set<int> recycledIndices = { a.IndexInPool, b.IndexInPool };
+    CHECK(recycledIndices == std::set<int>{ 2, 5 });
+    CHECK(allocator.NbPools() == 1);
+
+    // Many textures which come and go do not add pools
+    for (int i = 0; i < 1000; ++i)
+        allocator.Free(allocator.Allocate());
+    CHECK(allocator.NbPools() == 2);
+    CHECK(allocator.NbUsedSlots() == 8);
+}
@@ -0,0 +1,59 @@
+#include "benchmark_utils.h"
+#include "hello_imgui/docking_params.h"
+#include "hello_imgui/internal/docking_details.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using HelloImGui::DockableWindow;
+using HelloImGui::DockingParams;
+
+
+// Lookups and removals in a layout with 10000 dockable windows:
+// indexed lookup vs linear search, batched removal vs one pass per removed window
+void BenchmarkDockingParams()
+{
+    const int nbWindows = 10000;
+    DockingParams dockingParams;
+    std::vector<std::string> labels;
+    for (int i = 0; i < nbWindows; ++i)
+    {
+        labels.push_back("Window " + std::to_string(i));
+        dockingParams.dockableWindows.emplace_back(labels.back(), "MainDockSpace");
+    }
+
+    size_t nbFound = 0;
+    double msIndexed = MeasureMs([&]() {
+        for (const auto& label: labels)
+            nbFound += (dockingParams.dockableWindowOfName(label) != nullptr) ? 1 : 0;
+    });
+    double msLinear = MeasureMs([&]() {
+        auto& windows = dockingParams.dockableWindows;
+        for (const auto& label: labels)
+            nbFound += std::any_of(windows.begin(), windows.end(), [&label](const DockableWindow& w) { return w.label == label; }) ? 1 : 0;
+    });
+    printf("DockingParams, %d windows: %d lookups: indexed %.3f ms, linear %.3f ms\n", nbWindows, nbWindows, msIndexed, msLinear);
+
+    // Removes one window out of two
+    std::unordered_set<std::string> labelsToRemove;
+    for (int i = 0; i < nbWindows; i += 2)
+        labelsToRemove.insert(labels[(size_t)i]);
+    double msBatched = MeasureMs([&]() {
+        std::vector<DockableWindow> windows = dockingParams.dockableWindows;
+        HelloImGui::AddDockableWindowHelper::EraseDockableWindows(windows, labelsToRemove);
+    }, 1);
+    double msPerWindow = MeasureMs([&]() {
+        std::vector<DockableWindow> windows = dockingParams.dockableWindows;
+        for (const auto& label: labelsToRemove)
+            windows.erase(
+                std::remove_if(windows.begin(), windows.end(), [&label](const DockableWindow& w) { return w.label == label; }),
+                windows.end());
+    }, 1);
+    printf("DockingParams, %d windows: %zu removals: batched %.3f ms, one by one %.3f ms\n",
+           nbWindows, labelsToRemove.size(), msBatched, msPerWindow);
+
+    if (nbFound != (size_t)nbWindows * 12)
+        printf("DockingParams: unexpected lookup results\n");
+}
@@ -0,0 +1,76 @@
+#include "doctest.h"
+#include "hello_imgui/docking_params.h"
+#include "hello_imgui/internal/docking_details.h"
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using HelloImGui::DockableWindow;
+using HelloImGui::DockingParams;
+
+
+static std::vector<DockableWindow> MakeWindows(int count)
+{
+    std::vector<DockableWindow> r;
+    r.reserve((std::size_t)count);
+    for (int i = 0; i < count; ++i)
+        r.emplace_back("Window " + std::to_string(i), "MainDockSpace");
+    return r;
+}
+
+
+TEST_CASE("DockingParams: dockableWindowOfName stays valid when dockableWindows is modified")
+{
+    DockingParams dockingParams;
+    dockingParams.dockableWindows = MakeWindows(5);
+
+    REQUIRE(dockingParams.dockableWindowOfName("Window 3") != nullptr);
+    CHECK(dockingParams.dockableWindowOfName("Window 3")->label == "Window 3");
+    CHECK(dockingParams.dockableWindowOfName("Unknown") == nullptr);
+
+    // Erase + push_back: same size, shifted content
+    dockingParams.dockableWindows.erase(dockingParams.dockableWindows.begin());
+    dockingParams.dockableWindows.emplace_back("New window");
+    CHECK(dockingParams.dockableWindowOfName("Window 0") == nullptr);
+    REQUIRE(dockingParams.dockableWindowOfName("Window 3") != nullptr);
+    CHECK(dockingParams.dockableWindowOfName("Window 3")->label == "Window 3");
+    CHECK(dockingParams.dockableWindowOfName("New window") == &dockingParams.dockableWindows.back());
+
+    // Rename in place
+    dockingParams.dockableWindows[0].label = "Renamed";
+    CHECK(dockingParams.dockableWindowOfName("Window 1") == nullptr);
+    CHECK(dockingParams.dockableWindowOfName("Renamed") == &dockingParams.dockableWindows[0]);
+
+    // Rename in place, and look up the new label first
+    dockingParams.dockableWindows[1].label = "Renamed again";
+    CHECK(dockingParams.dockableWindowOfName("Renamed again") == &dockingParams.dockableWindows[1]);
+    CHECK(dockingParams.dockableWindowOfName("Window 2") == nullptr);
+    CHECK(dockingParams.dockableWindowOfName("Unknown") == nullptr);
+    CHECK(dockingParams.dockableWindowOfName("Unknown") == nullptr);
+
+    // A copy has its own index
+    DockingParams copy = dockingParams;
+    CHECK(copy.dockableWindowOfName("Renamed") == &copy.dockableWindows[0]);
+
+    CHECK(dockingParams.focusDockableWindow("Window 4"));
+    CHECK(dockingParams.dockableWindowOfName("Window 4")->focusWindowAtNextFrame);
+}
+
+TEST_CASE("DockingParams: is an aggregate")
+{
+    static_assert(std::is_aggregate_v<DockingParams>, "DockingParams shall support brace initialization");
+    DockingParams dockingParams { {}, MakeWindows(2) };
+    CHECK(dockingParams.dockableWindowOfName("Window 1") == &dockingParams.dockableWindows[1]);
+}
+
+TEST_CASE("DockingParams: batched removal")
+{
+    std::vector<DockableWindow> windows = MakeWindows(6);
+    HelloImGui::AddDockableWindowHelper::EraseDockableWindows(windows, {"Window 1", "Window 4", "Unknown"});
+    REQUIRE(windows.size() == 4);
+    CHECK(windows[0].label == "Window 0");
+    CHECK(windows[1].label == "Window 2");
+    CHECK(windows[2].label == "Window 3");
+    CHECK(windows[3].label == "Window 5");
+}
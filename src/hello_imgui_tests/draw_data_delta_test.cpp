@@ -0,0 +1,99 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/draw_data_delta.h"
+
+#include <vector>
+
+using namespace HelloImGui;
+
+
+// A frame with one draw list (a triangle), whose size may be changed
+struct TestFrame
+{
+    ImDrawList drawList { nullptr };
+    ImDrawData drawData;
+
+    TestFrame()
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            ImDrawVert vertex;
+            vertex.pos = ImVec2((float)i, (float)(i * 2));
+            drawList.VtxBuffer.push_back(vertex);
+            drawList.IdxBuffer.push_back((ImDrawIdx)i);
+        }
+        ImDrawCmd cmd;
+        cmd.ClipRect = ImVec4(0.f, 0.f, 100.f, 100.f);
+        cmd.ElemCount = 3;
+        drawList.CmdBuffer.push_back(cmd);
+
+        drawData.CmdLists.push_back(&drawList);
+        drawData.CmdListsCount = 1;
+        drawData.DisplaySize = ImVec2(100.f, 100.f);
+        drawData.FramebufferScale = ImVec2(1.f, 1.f);
+    }
+};
+
+
+TEST_CASE("HashBytes64")
+{
+    std::vector<unsigned char> bytes = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    uint64_t h = HashBytes64(bytes.data(), bytes.size());
+    CHECK(h == HashBytes64(bytes.data(), bytes.size()));
+    CHECK(h != HashBytes64(bytes.data(), bytes.size(), 1));   // seed
+    CHECK(h != HashBytes64(bytes.data(), bytes.size() - 1));  // size
+    bytes[10] = 12;                                            // last byte, in the incomplete 8 bytes block
+    CHECK(h != HashBytes64(bytes.data(), bytes.size()));
+}
+
+TEST_CASE("DrawDataDelta: identical, changed and invalidated frames")
+{
+    TestFrame frame;
+    DrawDataDelta delta;
+
+    // The first frame is always considered as changed
+    auto r = delta.Compare(&frame.drawData);
+    CHECK(!r.isIdentical);
+    CHECK(r.nbDrawLists == 1);
+    CHECK(r.nbChangedDrawLists == 1);
+    CHECK(r.changedBytes == r.totalBytes);
+    delta.MarkSent();
+
+    // Same content
+    r = delta.Compare(&frame.drawData);
+    CHECK(r.isIdentical);
+    CHECK(r.nbChangedDrawLists == 0);
+    CHECK(r.changedBytes == 0);
+
+    // Without MarkSent(), the reference frame stays the same
+    frame.drawList.VtxBuffer[1].pos.x = 50.f;
+    r = delta.Compare(&frame.drawData);
+    CHECK(!r.isIdentical);
+    CHECK(r.nbChangedDrawLists == 1);
+    frame.drawList.VtxBuffer[1].pos.x = 1.f;
+    CHECK(delta.Compare(&frame.drawData).isIdentical);
+
+    // Changed command
+    frame.drawList.CmdBuffer[0].ClipRect.z = 50.f;
+    CHECK(!delta.Compare(&frame.drawData).isIdentical);
+    delta.MarkSent();
+    CHECK(delta.Compare(&frame.drawData).isIdentical);
+
+    // Changed geometry, with the same draw lists
+    frame.drawData.DisplaySize = ImVec2(200.f, 100.f);
+    CHECK(!delta.Compare(&frame.drawData).isIdentical);
+    delta.MarkSent();
+    CHECK(delta.Compare(&frame.drawData).isIdentical);
+
+    // Invalidated
+    delta.Invalidate();
+    CHECK(!delta.Compare(&frame.drawData).isIdentical);
+    delta.MarkSent();
+    CHECK(delta.Compare(&frame.drawData).isIdentical);
+
+    // No draw data
+    CHECK(!delta.Compare(nullptr).isIdentical);
+
+    const auto& stats = delta.GetStats();
+    CHECK(stats.nbFrames == 10);  // the missing draw data is not counted
+    CHECK(stats.nbIdenticalFrames == 5);
+}
@@ -0,0 +1,123 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/frame_pacer.h"
+
+#include <cmath>
+
+using HelloImGui::FramePacer;
+using HelloImGui::FramePacingOptions;
+
+
+// Simulates a main loop: sleep (as requested by the pacer), poll events, render (frameDuration), swap.
+// With vsync, the swap returns at the next vblank (every 1/60s).
+struct SimulatedLoop
+{
+    FramePacer pacer;
+    double now = 0.;
+    bool vsync = true;
+    int nbFrames = 0;
+
+    void RunFrame(double frameDuration)
+    {
+        double sleep = pacer.SecondsToSleepBeforePoll(now);
+        now += sleep;
+        pacer.OnPacingSleep(sleep);
+        pacer.OnEventsPolled(now, true);
+        now += frameDuration;
+        pacer.OnBeforeSwap(now);
+        if (vsync)
+            now = std::ceil(now * 60. - 1e-9) / 60.;
+        pacer.OnPresented(now);
+        ++nbFrames;
+    }
+};
+
+
+TEST_CASE("FramePacer: inactive by default")
+{
+    SimulatedLoop loop;
+    loop.pacer.SetOptions(FramePacingOptions(), 60., true);
+    CHECK(!loop.pacer.IsActive());
+    for (int i = 0; i < 60; ++i)
+        loop.RunFrame(0.003);
+    CHECK(loop.pacer.SecondsToSleepBeforePoll(loop.now) == 0.);
+    // With vsync, the events were polled just after the previous vblank: the latency is a full refresh period
+    CHECK(loop.pacer.GetStats().inputLatencyMs_Mean == doctest::Approx(1000. / 60.).epsilon(0.01));
+}
+
+TEST_CASE("FramePacer: justInTime reduces the input latency, without missing vblanks")
+{
+    SimulatedLoop loop;
+    FramePacingOptions options;
+    options.justInTime = true;
+    options.justInTimeMarginMs = 2.f;
+    loop.pacer.SetOptions(options, 60., true);
+    for (int i = 0; i < 10; ++i)
+        loop.RunFrame(0.003);
+
+    double start = loop.now;
+    for (int i = 0; i < 60; ++i)
+        loop.RunFrame(0.003);
+    // One frame per vblank
+    CHECK(loop.now - start == doctest::Approx(1.).epsilon(0.001));
+
+    auto stats = loop.pacer.GetStats();
+    CHECK(stats.frameDurationMs_Estimated == doctest::Approx(3.).epsilon(0.01));
+    CHECK(stats.inputLatencyMs_Last < 5.5f);
+    CHECK(stats.inputLatencyMs_Mean < 7.f);
+    CHECK(stats.pacingSleepMs_Last > 10.f);
+}
+
+TEST_CASE("FramePacer: justInTime adapts when a frame takes longer")
+{
+    SimulatedLoop loop;
+    FramePacingOptions options;
+    options.justInTime = true;
+    loop.pacer.SetOptions(options, 60., true);
+    for (int i = 0; i < 10; ++i)
+        loop.RunFrame(0.003);
+    // A slower frame misses its vblank once, then the estimate is updated
+    loop.RunFrame(0.008);
+    double start = loop.now;
+    for (int i = 0; i < 60; ++i)
+        loop.RunFrame(0.008);
+    CHECK(loop.now - start == doctest::Approx(1.).epsilon(0.001));
+    CHECK(loop.pacer.GetStats().inputLatencyMs_Last < 10.5f);
+}
+
+TEST_CASE("FramePacer: targetFps limits the frame rate without vsync")
+{
+    SimulatedLoop loop;
+    loop.vsync = false;
+    FramePacingOptions options;
+    options.vsync = false;
+    options.targetFps = 100.f;
+    loop.pacer.SetOptions(options, 60., false);
+    loop.RunFrame(0.001);
+    double start = loop.now;
+    for (int i = 0; i < 100; ++i)
+        loop.RunFrame(0.001);
+    CHECK(loop.now - start == doctest::Approx(1.).epsilon(0.01));
+
+    // justInTime + targetFps: same frame rate, but the events are polled just before the frame
+    options.justInTime = true;
+    loop.pacer.SetOptions(options, 60., false);
+    start = loop.now;
+    for (int i = 0; i < 100; ++i)
+        loop.RunFrame(0.001);
+    CHECK(loop.now - start == doctest::Approx(1.).epsilon(0.01));
+    CHECK(loop.pacer.GetStats().inputLatencyMs_Last == doctest::Approx(1.).epsilon(0.01));
+}
+
+TEST_CASE("FramePacer: presentations without event polling are ignored")
+{
+    FramePacer pacer;
+    pacer.OnEventsPolled(0., true);
+    pacer.OnBeforeSwap(0.002);
+    pacer.OnPresented(0.010);
+    // e.g. a redraw during a resize
+    pacer.OnBeforeSwap(0.020);
+    pacer.OnPresented(0.030);
+    auto stats = pacer.GetStats();
+    CHECK(stats.inputLatencyMs_Mean == doctest::Approx(10.));
+    CHECK(stats.frameDurationMs_Estimated == doctest::Approx(2.));
+}
@@ -0,0 +1,13 @@
+// hello_imgui_benchmarks: micro-benchmarks of hello_imgui internals (prints the measured durations)
+#include <cstdio>
+
+void BenchmarkDockingParams();
+void BenchmarkPixelConversion();
+
+
+int main()
+{
+    BenchmarkDockingParams();
+    BenchmarkPixelConversion();
+    return 0;
+}
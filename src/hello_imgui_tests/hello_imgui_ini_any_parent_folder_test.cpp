@@ -0,0 +1,48 @@
+#include "doctest.h"
+#include "hello_imgui/internal/hello_imgui_ini_any_parent_folder.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace HelloImGui;
+namespace fs = std::filesystem;
+
+
+static void WriteFile(const fs::path& path, const std::string& content)
+{
+    std::ofstream os(path);
+    os << content;
+}
+
+TEST_CASE("HelloImGuiIniAnyParentFolder: merged settings of the current folder and its parents")
+{
+    fs::path previousFolder = fs::current_path();
+    fs::path root = fs::temp_directory_path() / "hello_imgui_ini_any_parent_folder_test";
+    fs::remove_all(root);
+    fs::create_directories(root / "child" / "grandchild");
+    WriteFile(root / "hello_imgui.ini", "[DpiAwareParams]\ndpiWindowSizeFactor=2\nfontRenderingScale=0.5\n[OpenGlOptions]\nMajorVersion=3\n");
+    WriteFile(root / "child" / "hello_imgui.ini", "[DpiAwareParams]\ndpiWindowSizeFactor=1.5\n");
+
+    fs::current_path(root / "child" / "grandchild");
+    CHECK(HelloImGuiIniAnyParentFolder::readFloatValue("DpiAwareParams", "dpiWindowSizeFactor") == 1.5f);
+    CHECK(HelloImGuiIniAnyParentFolder::readFloatValue("DpiAwareParams", "fontRenderingScale") == 0.5f);
+    CHECK(HelloImGuiIniAnyParentFolder::readIntValue("OpenGlOptions", "MajorVersion") == 3);
+    CHECK(HelloImGuiIniAnyParentFolder::readStringValue("OpenGlOptions", "GlslVersion") == std::nullopt);
+    CHECK(HelloImGuiIniAnyParentFolder::readIntValue("NoSuchSection", "MajorVersion") == std::nullopt);
+
+    // The snapshot follows the current folder
+    fs::current_path(root);
+    CHECK(HelloImGuiIniAnyParentFolder::readFloatValue("DpiAwareParams", "dpiWindowSizeFactor") == 2.f);
+
+    // The edits of the files are only seen after ReloadIfChanged()
+    WriteFile(root / "hello_imgui.ini", "[DpiAwareParams]\ndpiWindowSizeFactor=3\n");
+    fs::last_write_time(root / "hello_imgui.ini", fs::last_write_time(root / "hello_imgui.ini") + std::chrono::seconds(10));
+    CHECK(HelloImGuiIniAnyParentFolder::readFloatValue("DpiAwareParams", "dpiWindowSizeFactor") == 2.f);
+    CHECK(HelloImGuiIniAnyParentFolder::ReloadIfChanged());
+    CHECK(HelloImGuiIniAnyParentFolder::readFloatValue("DpiAwareParams", "dpiWindowSizeFactor") == 3.f);
+    CHECK(HelloImGuiIniAnyParentFolder::readFloatValue("DpiAwareParams", "fontRenderingScale") == std::nullopt);
+    CHECK(!HelloImGuiIniAnyParentFolder::ReloadIfChanged());
+
+    fs::current_path(previousFolder);
+    fs::remove_all(root);
+}
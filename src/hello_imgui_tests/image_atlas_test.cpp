@@ -0,0 +1,182 @@
+#include "doctest.h"
+#include "hello_imgui/internal/image_atlas.h"
+#include "hello_imgui/internal/image_atlas_packer.h"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace HelloImGui;
+
+
+static bool Overlap(const ImageAtlasPacker::Rect& a, const ImageAtlasPacker::Rect& b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static bool IsPackingValid(const ImageAtlasPacker& packer)
+{
+    for (const auto& [idA, a]: packer.Rects())
+    {
+        if (a.x < 0 || a.y < 0 || a.x + a.w > packer.PageWidth() || a.y + a.h > packer.PageHeight())
+            return false;
+        for (const auto& [idB, b]: packer.Rects())
+            if (idA != idB && Overlap(a, b))
+                return false;
+    }
+    return true;
+}
+
+TEST_CASE("ImageAtlasPacker: insertion, removal and reuse of the freed space")
+{
+    ImageAtlasPacker packer(128, 128);
+    ImageAtlasPacker::Rect r;
+    // 64 icons of 16x16 fill the page
+    for (int i = 0; i < 64; ++i)
+        CHECK(packer.Insert(i, 16, 16, &r));
+    CHECK(!packer.Insert(100, 16, 16, &r));
+    CHECK(IsPackingValid(packer));
+
+    packer.Remove(10);
+    packer.Remove(11);
+    CHECK(packer.Insert(100, 32, 16, &r));
+    CHECK(IsPackingValid(packer));
+    CHECK(packer.UsedArea() == 64 * 16 * 16);
+
+    // Too large, or duplicate id
+    CHECK(!packer.Insert(101, 129, 8, &r));
+    CHECK(!packer.Insert(100, 8, 8, &r));
+}
+
+TEST_CASE("ImageAtlasPacker: Repack defragments the page")
+{
+    ImageAtlasPacker packer(256, 256);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> sizeDist(4, 40);
+    int nextId = 0;
+    for (int iteration = 0; iteration < 2000; ++iteration)
+    {
+        ImageAtlasPacker::Rect r;
+        packer.Insert(nextId++, sizeDist(rng), sizeDist(rng), &r);
+        // Remove a random rect from time to time
+        if (iteration % 3 == 0 && !packer.IsEmpty())
+        {
+            auto it = packer.Rects().begin();
+            std::advance(it, rng() % packer.Rects().size());
+            packer.Remove(it->first);
+        }
+    }
+    CHECK(IsPackingValid(packer));
+
+    auto rectsBefore = packer.Rects();
+    REQUIRE(packer.Repack());
+    CHECK(IsPackingValid(packer));
+    CHECK(packer.Rects().size() == rectsBefore.size());
+    for (const auto& [id, r]: packer.Rects())
+    {
+        CHECK(r.w == rectsBefore.at(id).w);
+        CHECK(r.h == rectsBefore.at(id).h);
+    }
+}
+
+
+struct FakeTexture: public ImageAbstract
+{
+    std::vector<unsigned char> Pixels;
+    int NbUploads = 0;
+    ImTextureID TextureID() override { return (ImTextureID)(intptr_t)this; }
+    void _impl_StoreTexture(int width, int height, unsigned char* image_data_rgba) override
+    {
+        Width = width;
+        Height = height;
+        Pixels.assign(image_data_rgba, image_data_rgba + (size_t)width * height * 4);
+        ++NbUploads;
+    }
+    void _impl_UploadTexture(int width, int height, unsigned char* image_data_rgba) override
+    {
+        _impl_StoreTexture(width, height, image_data_rgba);
+    }
+    void _impl_ReleaseTexture() override {}
+};
+
+static ImageAtlas MakeFakeAtlas(const ImageAtlasParams& params)
+{
+    return ImageAtlas(params, [](ImageAbstractPtr& texture, int width, int height, unsigned char* image_data_rgba) {
+        if (!texture)
+            texture = std::make_shared<FakeTexture>();
+        texture->_impl_UploadTexture(width, height, image_data_rgba);
+    });
+}
+
+static std::vector<unsigned char> SolidImage(int width, int height, unsigned char value)
+{
+    return std::vector<unsigned char>((size_t)width * height * 4, value);
+}
+
+static uint32_t PixelAtUv(ImageAbstract* texture, ImVec2 uv)
+{
+    auto* fake = static_cast<FakeTexture*>(texture);
+    int x = (int)(uv.x * (float)fake->Width), y = (int)(uv.y * (float)fake->Height);
+    const unsigned char* p = fake->Pixels.data() + ((size_t)y * fake->Width + x) * 4;
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+TEST_CASE("ImageAtlas: the images share a texture, and the uploads are deferred")
+{
+    ImageAtlasParams params;
+    params.enabled = true;
+    params.pageSize = 64;
+    params.maxImageSize = 16;
+    params.maxPages = 1;
+    auto atlas = MakeFakeAtlas(params);
+
+    CHECK(!atlas.CanContain(17, 4));
+
+    auto red = SolidImage(16, 16, 10), blue = SolidImage(8, 8, 20);
+    REQUIRE(atlas.Insert("red", 16, 16, red.data(), 0));
+    REQUIRE(atlas.Insert("blue", 8, 8, blue.data(), 0));
+    CHECK(atlas.NbPages() == 1);
+    CHECK(atlas.HasPendingUploads());
+
+    ImageAndSize redImage, blueImage;
+    REQUIRE(atlas.Find("red", 0, &redImage));
+    REQUIRE(atlas.Find("blue", 0, &blueImage));
+    CHECK(redImage.textureId == blueImage.textureId);
+    CHECK(redImage.size.x == 16.f);
+    CHECK(blueImage.uv1.x - blueImage.uv0.x == doctest::Approx(8.f / 64.f));
+
+    atlas.FlushUploads(1);
+    CHECK(!atlas.HasPendingUploads());
+    auto* texture = (ImageAbstract*)(intptr_t)redImage.textureId;
+    CHECK(PixelAtUv(texture, redImage.uv0) == 0x0A0A0A0Au);
+    CHECK(PixelAtUv(texture, ImVec2(blueImage.uv0.x + 0.01f, blueImage.uv0.y + 0.01f)) == 0x14141414u);
+}
+
+TEST_CASE("ImageAtlas: eviction and defragmentation when the pages are full")
+{
+    ImageAtlasParams params;
+    params.enabled = true;
+    params.pageSize = 36;
+    params.maxImageSize = 16;
+    params.maxPages = 1;
+    params.padding = 1;
+    auto atlas = MakeFakeAtlas(params);
+
+    // 4 images of 16x16 (18x18 with the padding) fill the page
+    auto pixels = SolidImage(16, 16, 1);
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(atlas.Insert("img" + std::to_string(i), 16, 16, pixels.data(), 0));
+    CHECK(!atlas.Insert("new", 16, 16, pixels.data(), 0));
+
+    // img1 is still displayed; the others were not displayed for a long time
+    ImageAndSize image;
+    atlas.Find("img1", 1000, &image);
+    atlas.FlushUploads(1001);
+    CHECK(atlas.NbImages() == 1);
+    CHECK(atlas.Find("img1", 1001, &image));
+    CHECK(!atlas.Find("img0", 1001, &image));
+
+    CHECK(atlas.Insert("new", 16, 16, pixels.data(), 1001));
+    CHECK(atlas.NbImages() == 2);
+}
@@ -0,0 +1,140 @@
+#include "doctest.h"
+#include "hello_imgui/internal/imgui_allocator.h"
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace HelloImGui;
+using ImGuiAllocator::Phase;
+
+
+// Each test starts with tracking enabled, without pool, and with fresh stats
+struct AllocatorTestFixture
+{
+    AllocatorTestFixture()
+    {
+        ImGuiAllocator::Configure(true, false);
+        ImGuiAllocator::SetPhase(Phase::BeforeNewFrame);
+        ImGuiAllocator::ResetStats();
+    }
+    ~AllocatorTestFixture()
+    {
+        ImGuiAllocator::Configure(false, false);
+    }
+};
+
+
+TEST_CASE_FIXTURE(AllocatorTestFixture, "ImGuiAllocator: counts per frame and per phase")
+{
+    size_t liveBytesBefore = ImGuiAllocator::GetStats().liveBytes;
+
+    ImGuiAllocator::SetPhase(Phase::NewFrame);
+    void* a = ImGuiAllocator::Alloc(100, nullptr);
+    ImGuiAllocator::SetPhase(Phase::Gui);
+    void* b = ImGuiAllocator::Alloc(50, nullptr);
+    void* c = ImGuiAllocator::Alloc(10, nullptr);
+    ImGuiAllocator::Free(c, nullptr);
+    memset(a, 1, 100);
+    CHECK(((uintptr_t)a % 16) == 0);
+    CHECK(ImGuiAllocator::OnFrameEnd() == 3);
+
+    auto stats = ImGuiAllocator::GetStats();
+    CHECK(stats.isTracking);
+    CHECK(stats.nbFrames == 1);
+    CHECK(stats.lastFrame.allocations == 3);
+    CHECK(stats.lastFrame.frees == 1);
+    CHECK(stats.lastFrame.bytesAllocated == 160);
+    CHECK(stats.lastFrame_NewFrame.allocations == 1);
+    CHECK(stats.lastFrame_Gui.allocations == 2);
+    CHECK(stats.lastFrame_Gui.frees == 1);
+    CHECK(stats.lastFrame_Render.allocations == 0);
+    CHECK(stats.liveBytes - liveBytesBefore == 150);
+    CHECK(stats.liveBytes_HighWaterMark - liveBytesBefore == 160);
+    CHECK(stats.nbFramesWithoutHeapAllocation == 0);
+
+    // A frame without allocation
+    ImGuiAllocator::Free(a, nullptr);
+    ImGuiAllocator::Free(b, nullptr);
+    CHECK(ImGuiAllocator::OnFrameEnd() == 0);
+    stats = ImGuiAllocator::GetStats();
+    CHECK(stats.nbFrames == 2);
+    CHECK(stats.lastFrame.allocations == 0);
+    CHECK(stats.lastFrame.frees == 2);
+    CHECK(stats.total.allocations == 3);
+    CHECK(stats.total.frees == 3);
+    CHECK(stats.frameAllocations_HighWaterMark == 3);
+    CHECK(stats.frameBytesAllocated_HighWaterMark == 160);
+    CHECK(stats.liveBytes == liveBytesBefore);
+    CHECK(stats.nbFramesWithoutHeapAllocation == 1);
+}
+
+TEST_CASE_FIXTURE(AllocatorTestFixture, "ImGuiAllocator: the size class pool recycles the blocks")
+{
+    ImGuiAllocator::Configure(true, true);
+
+    // Warm up: the pool may need a new slab
+    void* a = ImGuiAllocator::Alloc(40, nullptr);
+    ImGuiAllocator::Free(a, nullptr);
+    ImGuiAllocator::OnFrameEnd();
+    CHECK(ImGuiAllocator::GetStats().poolBytesReserved > 0);
+
+    // Steady state: the same block is reused, and the heap is not used
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        void* b = ImGuiAllocator::Alloc(40, nullptr);
+        CHECK(b == a);
+        void* c = ImGuiAllocator::Alloc(1000, nullptr);
+        ImGuiAllocator::Free(c, nullptr);
+        ImGuiAllocator::Free(b, nullptr);
+        CHECK(ImGuiAllocator::OnFrameEnd() == 0);
+    }
+    auto stats = ImGuiAllocator::GetStats();
+    CHECK(stats.lastFrame.allocations == 2);
+    CHECK(stats.lastFrame.heapAllocations == 0);
+    CHECK(stats.nbFramesWithoutHeapAllocation == 3);
+
+    // Large blocks are not pooled
+    void* large = ImGuiAllocator::Alloc(100000, nullptr);
+    memset(large, 0, 100000);
+    ImGuiAllocator::Free(large, nullptr);
+    CHECK(ImGuiAllocator::OnFrameEnd() == 1);
+}
+
+TEST_CASE_FIXTURE(AllocatorTestFixture, "ImGuiAllocator: the settings can change while blocks are allocated")
+{
+    size_t liveBytesBefore = ImGuiAllocator::GetStats().liveBytes;
+
+    ImGuiAllocator::Configure(false, true);
+    void* untrackedPooled = ImGuiAllocator::Alloc(64, nullptr);
+    ImGuiAllocator::Configure(true, false);
+    void* trackedHeap = ImGuiAllocator::Alloc(64, nullptr);
+    ImGuiAllocator::Configure(true, true);
+    ImGuiAllocator::Free(untrackedPooled, nullptr);  // goes back to the pool, not accounted in the live bytes
+    CHECK(ImGuiAllocator::GetStats().liveBytes - liveBytesBefore == 64);
+    ImGuiAllocator::Configure(false, false);
+    ImGuiAllocator::Free(trackedHeap, nullptr);      // freed by free(), and still accounted
+    CHECK(ImGuiAllocator::GetStats().liveBytes == liveBytesBefore);
+}
+
+TEST_CASE_FIXTURE(AllocatorTestFixture, "ImGuiAllocator: allocations from several threads")
+{
+    ImGuiAllocator::Configure(true, true);
+    const int nbThreads = 4, nbAllocationsPerThread = 1000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nbThreads; ++t)
+        threads.emplace_back([]() {
+            std::vector<void*> blocks;
+            for (int i = 0; i < nbAllocationsPerThread; ++i)
+                blocks.push_back(ImGuiAllocator::Alloc((size_t)(i % 300), nullptr));
+            for (void* block: blocks)
+                ImGuiAllocator::Free(block, nullptr);
+        });
+    for (auto& thread: threads)
+        thread.join();
+    ImGuiAllocator::OnFrameEnd();
+    auto stats = ImGuiAllocator::GetStats();
+    CHECK(stats.lastFrame.allocations == nbThreads * nbAllocationsPerThread);
+    CHECK(stats.lastFrame.frees == nbThreads * nbAllocationsPerThread);
+}
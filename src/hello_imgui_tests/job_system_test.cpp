@@ -0,0 +1,193 @@
+#include "doctest.h"
+#include "hello_imgui/hello_imgui_async.h"
+#include "hello_imgui/internal/job_system.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace HelloImGui;
+
+
+// Runs the continuations on this thread (the "main thread") until the predicate is true
+template<typename Predicate>
+static bool RunContinuationsUntil(JobSystem& jobSystem, Predicate predicate)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        jobSystem.RunMainThreadContinuations();
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+
+
+TEST_CASE("JobSystem: runs all the jobs, including nested ones, before stopping")
+{
+    JobSystem jobSystem;
+    jobSystem.Start(4);
+    CHECK(jobSystem.NbThreads() == 4);
+    CHECK(JobSystem::Current() == &jobSystem);
+
+    std::atomic<int> nbJobsRun { 0 };
+    for (int i = 0; i < 100; ++i)
+        jobSystem.Push([&]() {
+            nbJobsRun += 1;
+            for (int j = 0; j < 10; ++j)
+                JobSystem::Current()->Push([&]() { nbJobsRun += 1; });  // pushed to the queue of this worker
+        });
+    jobSystem.Stop();
+    CHECK(nbJobsRun == 100 * 11);
+    CHECK(!jobSystem.IsRunning());
+    CHECK(JobSystem::Current() == nullptr);
+
+    // Not running: the jobs are run immediately
+    jobSystem.Push([&]() { nbJobsRun += 1; });
+    CHECK(nbJobsRun == 100 * 11 + 1);
+}
+
+TEST_CASE("JobSystem: a lazily started job system starts its workers at the first job")
+{
+    JobSystem jobSystem;
+    jobSystem.StartLazily(2);
+    CHECK(JobSystem::Current() == &jobSystem);
+    CHECK(!jobSystem.IsRunning());
+
+    std::atomic<bool> wasRun { false };
+    jobSystem.Push([&]() { wasRun = true; });
+    CHECK(jobSystem.NbThreads() == 2);
+    jobSystem.Stop();
+    CHECK(wasRun);
+    CHECK(JobSystem::Current() == nullptr);
+
+    // Stopped before any job: no thread was started
+    JobSystem unusedJobSystem;
+    unusedJobSystem.StartLazily(2);
+    unusedJobSystem.Stop();
+    CHECK(!unusedJobSystem.IsRunning());
+    CHECK(JobSystem::Current() == nullptr);
+    int nbJobsRun = 0;
+    unusedJobSystem.Push([&]() { nbJobsRun += 1; });  // run immediately
+    CHECK(nbJobsRun == 1);
+}
+
+TEST_CASE("JobSystem: the idle workers steal the jobs of a busy worker")
+{
+    JobSystem jobSystem;
+    jobSystem.Start(4);
+    std::mutex threadIdsMutex;
+    std::vector<std::thread::id> threadIds;
+    std::atomic<bool> isParentDone { false };
+    // A single job pushes the others to its own queue, then keeps its worker busy
+    jobSystem.Push([&]() {
+        for (int i = 0; i < 8; ++i)
+            JobSystem::Current()->Push([&]() {
+                std::lock_guard<std::mutex> lock(threadIdsMutex);
+                threadIds.push_back(std::this_thread::get_id());
+            });
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::lock_guard<std::mutex> lock(threadIdsMutex);
+            if (threadIds.size() == 8)
+                break;
+        }
+        isParentDone = true;
+    });
+    jobSystem.Stop();
+    CHECK(isParentDone);
+    CHECK(threadIds.size() == 8);
+}
+
+TEST_CASE("JobSystem: the continuations run on the main thread, and wake it up")
+{
+    JobSystem jobSystem;
+    std::atomic<int> nbWakeUps { 0 };
+    jobSystem.SetWakeUpCallback([&]() { nbWakeUps += 1; });
+    jobSystem.Start(2);
+
+    std::thread::id mainThreadId = std::this_thread::get_id();
+    std::thread::id continuationThreadId;
+    jobSystem.Push([&]() {
+        jobSystem.PostToMainThread([&]() { continuationThreadId = std::this_thread::get_id(); });
+    });
+    CHECK(RunContinuationsUntil(jobSystem, [&]() { return continuationThreadId != std::thread::id(); }));
+    CHECK((continuationThreadId == mainThreadId));
+    CHECK(nbWakeUps == 1);
+    CHECK(!jobSystem.HasMainThreadContinuations());
+    jobSystem.Stop();
+}
+
+TEST_CASE("Async: results, continuations and exceptions")
+{
+    JobSystem jobSystem;
+    jobSystem.Start(3);
+
+    SUBCASE("The continuation receives the result")
+    {
+        std::string received;
+        auto result = Async([]() { return std::string("hello"); });
+        result.Then([&](std::string& s) { received = s; });
+        CHECK(RunContinuationsUntil(jobSystem, [&]() { return !received.empty(); }));
+        CHECK(received == "hello");
+        CHECK(result.IsReady());
+        CHECK(result.Get() == "hello");
+    }
+    SUBCASE("Then() may be called after the completion")
+    {
+        auto result = Async([]() { return 42; });
+        CHECK(result.Get() == 42);
+        int received = 0;
+        result.Then([&](int& v) { received = v; });
+        CHECK(received == 0);  // always called by the main loop
+        CHECK(RunContinuationsUntil(jobSystem, [&]() { return received == 42; }));
+    }
+    SUBCASE("void functions")
+    {
+        std::atomic<bool> wasRun { false };
+        bool wasContinued = false;
+        Async([&]() { wasRun = true; }).Then([&]() { wasContinued = true; });
+        CHECK(RunContinuationsUntil(jobSystem, [&]() { return wasContinued; }));
+        CHECK(wasRun);
+    }
+    SUBCASE("Exceptions are rethrown by Get(), and the continuation is not called")
+    {
+        bool wasContinued = false;
+        auto result = Async([]() -> int { throw std::runtime_error("failure"); });
+        result.Then([&](int&) { wasContinued = true; });
+        CHECK_THROWS_AS(result.Get(), std::runtime_error);
+        jobSystem.RunMainThreadContinuations();
+        CHECK(!wasContinued);
+    }
+    SUBCASE("A job may wait for nested jobs (the waiting worker runs them)")
+    {
+        auto result = Async([]() {
+            std::vector<AsyncResult<int>> parts;
+            for (int i = 1; i <= 20; ++i)
+                parts.push_back(Async([i]() { return i * i; }));
+            int sum = 0;
+            for (auto& part: parts)
+                sum += part.Get();
+            return sum;
+        });
+        CHECK(result.Get() == 2870);
+    }
+
+    jobSystem.Stop();
+}
+
+TEST_CASE("Async: without job system, everything runs immediately")
+{
+    REQUIRE(JobSystem::Current() == nullptr);
+    int received = 0;
+    auto result = Async([]() { return 7; });
+    CHECK(result.IsReady());
+    result.Then([&](int& v) { received = v; });
+    CHECK(received == 7);
+}
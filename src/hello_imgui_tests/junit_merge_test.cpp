@@ -0,0 +1,120 @@
+#ifdef HELLOIMGUI_WITH_TEST_ENGINE
+#include "doctest.h"
+#include "hello_imgui_test_engine_integration/test_engine_headless.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace HelloImGui::TestEngineHeadless;
+
+
+static std::string TempFilename(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / ("hello_imgui_junit_merge_test_" + name)).string();
+}
+
+static std::string WriteFile(const std::string& name, const std::string& content)
+{
+    std::string filename = TempFilename(name);
+    std::ofstream os(filename, std::ios::binary);
+    os << content;
+    return filename;
+}
+
+static std::string ReadFile(const std::string& filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+
+static size_t CountOccurrences(const std::string& s, const std::string& what)
+{
+    size_t r = 0;
+    for (size_t pos = s.find(what); pos != std::string::npos; pos = s.find(what, pos + 1))
+        ++r;
+    return r;
+}
+
+
+TEST_CASE("MergeJUnitXmlFiles: merges the test suites and their counts")
+{
+    std::string worker0 = WriteFile("worker0.xml",
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<testsuites tests=\"3\" failures=\"1\" errors=\"0\">\n"
+        "  <testsuite name=\"suite_a\" tests=\"3\" failures=\"1\">\n"
+        "    <testcase name=\"a1\"/>\n"
+        "  </testsuite>\n"
+        "</testsuites>\n");
+    std::string worker1 = WriteFile("worker1.xml",
+        "<testsuites errors=\"2\" tests=\"5\">\n"
+        "  <testsuite name=\"suite_b\" tests=\"5\" errors=\"2\">\n"
+        "  </testsuite>\n"
+        "</testsuites>");
+    std::string output = TempFilename("merged.xml");
+
+    JUnitMergeResult r = MergeJUnitXmlFiles({worker0, worker1}, output);
+    CHECK(r.nbTests == 8);
+    CHECK(r.nbFailures == 3);
+
+    std::string merged = ReadFile(output);
+    CHECK(merged.find("<testsuites tests=\"8\" failures=\"3\" errors=\"0\">") != std::string::npos);
+    CHECK(merged.find("<testsuite name=\"suite_a\"") < merged.find("<testsuite name=\"suite_b\""));
+    CHECK(CountOccurrences(merged, "<testsuites") == 1);
+    CHECK(CountOccurrences(merged, "</testsuites>") == 1);
+    CHECK(CountOccurrences(merged, "<?xml") == 1);
+
+    // Without output file, only the counts are computed
+    std::remove(output.c_str());
+    r = MergeJUnitXmlFiles({worker0, worker1}, "");
+    CHECK(r.nbTests == 8);
+    CHECK(!std::filesystem::exists(output));
+
+    std::remove(worker0.c_str());
+    std::remove(worker1.c_str());
+}
+
+TEST_CASE("MergeJUnitXmlFiles: empty input")
+{
+    std::string output = TempFilename("merged_empty.xml");
+    JUnitMergeResult r = MergeJUnitXmlFiles({}, output);
+    CHECK(r.nbTests == 0);
+    CHECK(r.nbFailures == 0);
+    std::string merged = ReadFile(output);
+    CHECK(merged.find("<testsuites tests=\"0\" failures=\"0\" errors=\"0\">") != std::string::npos);
+    CHECK(CountOccurrences(merged, "<testsuite ") == 0);
+    std::remove(output.c_str());
+}
+
+TEST_CASE("MergeJUnitXmlFiles: a missing or malformed file is reported as a failed suite")
+{
+    std::string valid = WriteFile("valid.xml", "<testsuites tests=\"2\"><testsuite name=\"ok\"/></testsuites>");
+    std::string truncated = WriteFile("truncated.xml", "<testsuites tests=\"4\" failures=\"0\">\n  <testsuite name=\"cut\">");
+    std::string notXml = WriteFile("not_xml.xml", "Segmentation fault");
+    std::string missing = TempFilename("missing.xml");
+    std::remove(missing.c_str());
+    std::string output = TempFilename("merged_malformed.xml");
+
+    JUnitMergeResult r = MergeJUnitXmlFiles({valid, truncated, notXml, missing}, output);
+    CHECK(r.nbTests == 2 + 3);
+    CHECK(r.nbFailures == 3);
+
+    std::string merged = ReadFile(output);
+    CHECK(merged.find("<testsuite name=\"ok\"/>") != std::string::npos);
+    CHECK(merged.find("name=\"cut\"") == std::string::npos);
+    CHECK(merged.find("<testsuite name=\"worker_0\"") == std::string::npos);
+    CHECK(merged.find("<testsuite name=\"worker_1\"") != std::string::npos);
+    CHECK(merged.find("<testsuite name=\"worker_2\"") != std::string::npos);
+    CHECK(merged.find("<testsuite name=\"worker_3\"") != std::string::npos);
+
+    std::remove(valid.c_str());
+    std::remove(truncated.c_str());
+    std::remove(notXml.c_str());
+    std::remove(output.c_str());
+}
+#endif // #ifdef HELLOIMGUI_WITH_TEST_ENGINE
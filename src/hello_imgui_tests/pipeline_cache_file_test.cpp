@@ -0,0 +1,74 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/pipeline_cache_file.h"
+
+#include <cstdio>
+#include <filesystem>
+
+using namespace HelloImGui;
+
+
+static PipelineCacheFile::DeviceKey MakeKey()
+{
+    PipelineCacheFile::DeviceKey key;
+    key.vendorId = 0x10DE;
+    key.deviceId = 0x2684;
+    key.driverVersion = 0x89B40000;
+    for (int i = 0; i < 16; ++i)
+        key.pipelineCacheUuid[i] = (uint8_t)(i * 17);
+    return key;
+}
+
+TEST_CASE("PipelineCacheFile: round trip")
+{
+    auto key = MakeKey();
+    std::vector<uint8_t> cacheData = { 1, 2, 3, 4, 5, 250, 0, 42 };
+    std::vector<uint8_t> loaded;
+    CHECK(PipelineCacheFile::Deserialize(PipelineCacheFile::Serialize(key, cacheData), key, &loaded));
+    CHECK(loaded == cacheData);
+}
+
+TEST_CASE("PipelineCacheFile: the cache is rejected for another device or driver")
+{
+    auto key = MakeKey();
+    auto fileContent = PipelineCacheFile::Serialize(key, { 1, 2, 3 });
+    std::vector<uint8_t> loaded;
+
+    auto otherDriver = key;
+    otherDriver.driverVersion += 1;
+    CHECK(!PipelineCacheFile::Deserialize(fileContent, otherDriver, &loaded));
+
+    auto otherUuid = key;
+    otherUuid.pipelineCacheUuid[15] ^= 1;
+    CHECK(!PipelineCacheFile::Deserialize(fileContent, otherUuid, &loaded));
+    CHECK(loaded.empty());
+}
+
+TEST_CASE("PipelineCacheFile: corrupted or truncated files are rejected")
+{
+    auto key = MakeKey();
+    auto fileContent = PipelineCacheFile::Serialize(key, { 1, 2, 3, 4 });
+    std::vector<uint8_t> loaded;
+
+    auto corrupted = fileContent;
+    corrupted.back() ^= 0xFF;
+    CHECK(!PipelineCacheFile::Deserialize(corrupted, key, &loaded));
+
+    auto truncated = fileContent;
+    truncated.pop_back();
+    CHECK(!PipelineCacheFile::Deserialize(truncated, key, &loaded));
+
+    CHECK(!PipelineCacheFile::Deserialize({}, key, &loaded));
+}
+
+TEST_CASE("PipelineCacheFile: save and load")
+{
+    auto key = MakeKey();
+    std::string filename = (std::filesystem::temp_directory_path() / "hello_imgui_pipeline_cache_test.bin").string();
+    std::vector<uint8_t> cacheData(10000);
+    for (size_t i = 0; i < cacheData.size(); ++i)
+        cacheData[i] = (uint8_t)(i * 31);
+    CHECK(PipelineCacheFile::Save(filename, key, cacheData));
+    CHECK(PipelineCacheFile::Load(filename, key) == cacheData);
+    std::remove(filename.c_str());
+    CHECK(PipelineCacheFile::Load(filename, key).empty());
+}
@@ -0,0 +1,47 @@
+#include "benchmark_utils.h"
+#include "hello_imgui/pixel_conversion.h"
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace HelloImGui::PixelConversion;
+
+
+// Pixel conversions of a 1920x1080 image: scalar kernels vs the best instruction set supported by the CPU
+void BenchmarkPixelConversion()
+{
+    const size_t nbPixels = 1920 * 1080;
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> distribution(0, 65535);
+    std::vector<uint8_t> bytes(nbPixels * 4);
+    for (auto& v: bytes)
+        v = (uint8_t)(distribution(rng) & 0xFF);
+    std::vector<uint16_t> values16(nbPixels);
+    for (auto& v: values16)
+        v = (uint16_t)distribution(rng);
+    std::vector<float> valuesFloat(values16.begin(), values16.end());
+    std::vector<uint8_t> out(nbPixels * 4);
+
+    struct Conversion { const char* Name; std::function<void()> Fn; };
+    std::vector<Conversion> conversions = {
+        {"RgbToRgba", [&]() { RgbToRgba(bytes.data(), out.data(), nbPixels); }},
+        {"RgbaToRgb", [&]() { RgbaToRgb(bytes.data(), out.data(), nbPixels); }},
+        {"BgraToRgba", [&]() { BgraToRgba(bytes.data(), out.data(), nbPixels); }},
+        {"GrayToRgba", [&]() { GrayToRgba(bytes.data(), out.data(), nbPixels); }},
+        {"FloatToRgba", [&]() { FloatToRgba(valuesFloat.data(), out.data(), nbPixels, 0.f, 65535.f); }},
+        {"Uint16ToRgba", [&]() { Uint16ToRgba(values16.data(), out.data(), nbPixels, 0.f, 65535.f); }},
+    };
+
+    SimdLevel bestLevel = GetSimdLevel();
+    for (const auto& conversion: conversions)
+    {
+        SetSimdLevel(SimdLevel::Scalar);
+        double msScalar = MeasureMs(conversion.Fn);
+        SetSimdLevel(bestLevel);
+        double msBest = MeasureMs(conversion.Fn);
+        printf("PixelConversion, 1920x1080: %s: scalar %.3f ms, %s %.3f ms\n",
+               conversion.Name, msScalar, SimdLevelName(bestLevel), msBest);
+    }
+}
@@ -0,0 +1,147 @@
+#include "doctest.h"
+#include "hello_imgui/pixel_conversion.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace HelloImGui::PixelConversion;
+
+
+// Restores the default instruction set at the end of a test
+struct ScopedSimdLevel
+{
+    SimdLevel Previous = GetSimdLevel();
+    explicit ScopedSimdLevel(SimdLevel level) { SetSimdLevel(level); }
+    ~ScopedSimdLevel() { SetSimdLevel(Previous); }
+};
+
+static std::vector<SimdLevel> SupportedSimdLevels()
+{
+    std::vector<SimdLevel> r;
+    for (SimdLevel level: {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON})
+    {
+        ScopedSimdLevel scopedLevel(level);
+        if (GetSimdLevel() == level)
+            r.push_back(level);
+    }
+    return r;
+}
+
+template<typename T>
+static std::vector<T> RandomValues(size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<T> r(count);
+    for (auto& v: r)
+        v = (T)(rng() & 0xFFFF);
+    return r;
+}
+
+
+TEST_CASE("PixelConversion: channel layouts")
+{
+    const uint8_t rgb[] = {1, 2, 3, 4, 5, 6};
+    uint8_t rgba[8];
+    RgbToRgba(rgb, rgba, 2);
+    CHECK(std::vector<uint8_t>(rgba, rgba + 8) == std::vector<uint8_t>{1, 2, 3, 255, 4, 5, 6, 255});
+
+    uint8_t rgbBack[6];
+    RgbaToRgb(rgba, rgbBack, 2);
+    CHECK(std::vector<uint8_t>(rgbBack, rgbBack + 6) == std::vector<uint8_t>(rgb, rgb + 6));
+
+    uint8_t bgra[8] = {10, 20, 30, 40, 50, 60, 70, 80};
+    BgraToRgba(bgra, bgra, 2);  // in place
+    CHECK(std::vector<uint8_t>(bgra, bgra + 8) == std::vector<uint8_t>{30, 20, 10, 40, 70, 60, 50, 80});
+
+    const uint8_t gray[] = {7, 200};
+    GrayToRgba(gray, rgba, 2);
+    CHECK(std::vector<uint8_t>(rgba, rgba + 8) == std::vector<uint8_t>{7, 7, 7, 255, 200, 200, 200, 255});
+}
+
+TEST_CASE("PixelConversion: windowing")
+{
+    const float values[] = {-1.f, 0.f, 0.5f, 1.f, 2.f, std::numeric_limits<float>::quiet_NaN()};
+    uint8_t rgba[6 * 4];
+    FloatToRgba(values, rgba, 6, 0.f, 1.f);
+    CHECK(rgba[0 * 4] == 0);    // clamped
+    CHECK(rgba[1 * 4] == 0);
+    CHECK(rgba[2 * 4] == 128);  // 127.5 is rounded up
+    CHECK(rgba[3 * 4] == 255);
+    CHECK(rgba[4 * 4] == 255);  // clamped
+    CHECK(rgba[5 * 4] == 0);    // NaN
+    CHECK(rgba[2 * 4 + 1] == 128);
+    CHECK(rgba[2 * 4 + 3] == 255);
+
+    auto window = MinMax(values, 6);
+    CHECK(window.minValue == -1.f);
+    CHECK(window.maxValue == 2.f);
+
+    const uint16_t values16[] = {1000, 2000, 3000};
+    window = MinMax(values16, 3);
+    CHECK(window.minValue == 1000.f);
+    CHECK(window.maxValue == 3000.f);
+    Uint16ToRgba(values16, rgba, 3, window.minValue, window.maxValue);
+    CHECK(rgba[0] == 0);
+    CHECK(rgba[4] == 128);
+    CHECK(rgba[8] == 255);
+}
+
+TEST_CASE("PixelConversion: FlipVertically")
+{
+    std::vector<uint8_t> pixels = {1, 2, 3,  4, 5, 6,  7, 8, 9};  // 1 pixel of 3 bytes per row
+    FlipVertically(pixels.data(), 1, 3, 3);
+    CHECK(pixels == std::vector<uint8_t>{7, 8, 9,  4, 5, 6,  1, 2, 3});
+
+    // Rows larger than the internal swap buffer
+    size_t width = 3000, height = 3;
+    std::vector<uint8_t> image(width * height * 4);
+    for (size_t i = 0; i < image.size(); ++i)
+        image[i] = (uint8_t)(i / (width * 4) + i * 7);
+    auto flipped = image;
+    FlipVertically(flipped.data(), width, height, 4);
+    FlipVertically(flipped.data(), width, height, 4);
+    CHECK(flipped == image);
+}
+
+TEST_CASE("PixelConversion: the SIMD kernels give the same results as the scalar ones")
+{
+    auto levels = SupportedSimdLevels();
+    SimdLevel bestLevel = GetSimdLevel();
+
+    // Odd sizes, in order to test the remaining pixels processed by the scalar kernels
+    for (size_t nbPixels: {0, 1, 7, 9, 17, 33, 1001})
+    {
+        auto bytes = RandomValues<uint8_t>(nbPixels * 4, 1);
+        auto values16 = RandomValues<uint16_t>(nbPixels, 2);
+        std::vector<float> valuesFloat(nbPixels);
+        for (size_t i = 0; i < nbPixels; ++i)
+            valuesFloat[i] = (float)values16[i] / 1000.f - 10.f;
+        if (nbPixels > 5)
+            valuesFloat[5] = std::numeric_limits<float>::quiet_NaN();
+
+        std::vector<std::vector<uint8_t>> reference;
+        for (SimdLevel level: levels)
+        {
+            ScopedSimdLevel scopedLevel(level);
+            std::vector<std::vector<uint8_t>> results(6);
+            results[0].resize(nbPixels * 4); RgbToRgba(bytes.data(), results[0].data(), nbPixels);
+            results[1].resize(nbPixels * 3); RgbaToRgb(bytes.data(), results[1].data(), nbPixels);
+            results[2].resize(nbPixels * 4); BgraToRgba(bytes.data(), results[2].data(), nbPixels);
+            results[3].resize(nbPixels * 4); GrayToRgba(bytes.data(), results[3].data(), nbPixels);
+            results[4].resize(nbPixels * 4); FloatToRgba(valuesFloat.data(), results[4].data(), nbPixels, -5.f, 50.f);
+            results[5].resize(nbPixels * 4); Uint16ToRgba(values16.data(), results[5].data(), nbPixels, 1000.f, 60000.f);
+            if (reference.empty())
+                reference = results;
+            for (size_t k = 0; k < results.size(); ++k)
+            {
+                INFO("level=" << std::string(SimdLevelName(level)) << ", nbPixels=" << nbPixels << ", conversion #" << k);
+                CHECK(results[k] == reference[k]);
+            }
+        }
+    }
+    CHECK(GetSimdLevel() == bestLevel);  // restored by ScopedSimdLevel
+}
@@ -0,0 +1,98 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/remote_broadcast_thread.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace HelloImGui;
+
+
+// Creates a snapshot of an empty frame, whose destruction thread is recorded
+static DrawDataSnapshotPtr MakeSnapshot(uint64_t frameId, std::vector<std::thread::id>* destructionThreads)
+{
+    ImDrawData drawData;
+    return DrawDataSnapshotPtr(
+        new DrawDataSnapshot(&drawData, frameId),
+        [destructionThreads](const DrawDataSnapshot* snapshot) {
+            destructionThreads->push_back(std::this_thread::get_id());
+            delete snapshot;
+        });
+}
+
+template<typename Predicate>
+static bool WaitUntil(Predicate predicate)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!predicate())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+
+
+TEST_CASE("RemoteBroadcastThread: only the latest frame is published, snapshots are released on the main thread")
+{
+    // The publish function is blocked until the test opens the gate
+    std::mutex gateMutex;
+    std::condition_variable gateCondition;
+    bool isGateOpen = false;
+    std::mutex publishedMutex;
+    std::vector<uint64_t> publishedFrameIds;
+    std::atomic<int> nbPublishStarted { 0 };
+
+    std::vector<std::thread::id> destructionThreads;  // only modified on the main thread (checked below)
+    const std::thread::id mainThreadId = std::this_thread::get_id();
+
+    RemoteBroadcastThread broadcastThread;
+    broadcastThread.Start([&](const DrawDataSnapshot& snapshot) {
+        nbPublishStarted += 1;
+        {
+            std::unique_lock<std::mutex> lock(gateMutex);
+            gateCondition.wait(lock, [&]() { return isGateOpen; });
+        }
+        std::lock_guard<std::mutex> lock(publishedMutex);
+        publishedFrameIds.push_back(snapshot.FrameId());
+    });
+    CHECK(broadcastThread.IsRunning());
+
+    // Frame 1 is taken by the broadcast thread, which stays blocked in the publish function
+    broadcastThread.Submit(MakeSnapshot(1, &destructionThreads));
+    REQUIRE(WaitUntil([&]() { return nbPublishStarted == 1; }));
+
+    // Frame 2 is replaced by frame 3 before being published: it is destroyed by Submit(), on the main thread
+    broadcastThread.Submit(MakeSnapshot(2, &destructionThreads));
+    broadcastThread.Submit(MakeSnapshot(3, &destructionThreads));
+    CHECK(destructionThreads.size() == 1);
+
+    {
+        std::lock_guard<std::mutex> lock(gateMutex);
+        isGateOpen = true;
+    }
+    gateCondition.notify_all();
+    REQUIRE(WaitUntil([&]() { return broadcastThread.GetStats().publishedFrames == 2; }));
+
+    {
+        std::lock_guard<std::mutex> lock(publishedMutex);
+        CHECK(publishedFrameIds == std::vector<uint64_t>{1, 3});
+    }
+    auto stats = broadcastThread.GetStats();
+    CHECK(stats.submittedFrames == 3);
+    CHECK(stats.skippedFrames == 1);
+
+    // The published frames are released by the next Submit(), or by Stop()
+    CHECK(destructionThreads.size() == 1);
+    broadcastThread.Submit(MakeSnapshot(4, &destructionThreads));
+    CHECK(destructionThreads.size() == 3);
+    broadcastThread.Stop();
+    CHECK(!broadcastThread.IsRunning());
+    CHECK(destructionThreads.size() == 4);
+    for (const auto& threadId: destructionThreads)
+        CHECK((threadId == mainThreadId));
+}
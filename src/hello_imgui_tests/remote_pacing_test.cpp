@@ -0,0 +1,158 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/remote_pacing_controller.h"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+
+// A loopback simulation of remote clients, with a simulated clock:
+// each client is connected through a link with a given latency and bandwidth.
+// Frames are serialized on the link (a frame waits until the previous one was transmitted),
+// and the acknowledgement comes back after the link latency.
+struct SimulatedLink
+{
+    SimulatedLink(int clientId_, double latencySeconds_, double bytesPerSecond_)
+        : clientId(clientId_), latencySeconds(latencySeconds_), bytesPerSecond(bytesPerSecond_) {}
+
+    int clientId;
+    double latencySeconds;
+    double bytesPerSecond;
+
+    double linkFreeTime = 0.;
+    struct InFlight { uint64_t frameId; double ackArrivalTime; };
+    std::deque<InFlight> inFlight;
+    int maxQueuedOnLink = 0;
+
+    void Send(uint64_t frameId, double now, double frameBytes)
+    {
+        double transmitStart = std::max(now, linkFreeTime);
+        linkFreeTime = transmitStart + frameBytes / bytesPerSecond;
+        double arrivalTime = linkFreeTime + latencySeconds;
+        inFlight.push_back({frameId, arrivalTime + latencySeconds});
+        maxQueuedOnLink = std::max(maxQueuedOnLink, (int)inFlight.size());
+    }
+};
+
+static void RunLoopbackSimulation(HelloImGui::RemotePacingController& controller,
+                                  std::vector<SimulatedLink>& links,
+                                  double durationSeconds,
+                                  double frameBytes)
+{
+    const double dt = 0.001;
+    double nextProduceTime = 0.;
+    for (auto& link: links)
+        controller.OnClientConnected(link.clientId, 0.);
+
+    for (double now = 0.; now < durationSeconds; now += dt)
+    {
+        // Deliver acknowledgements
+        for (auto& link: links)
+        {
+            while (!link.inFlight.empty() && link.inFlight.front().ackArrivalTime <= now)
+            {
+                controller.OnFrameAcknowledged(link.clientId, link.inFlight.front().frameId, now);
+                link.inFlight.pop_front();
+            }
+        }
+
+        // Produce frames at the rate recommended by the controller
+        if (now < nextProduceTime)
+            continue;
+        nextProduceTime = now + 1. / controller.ProduceFps();
+
+        std::vector<SimulatedLink*> readyLinks;
+        for (auto& link: links)
+            if (controller.ShallSendToClient(link.clientId, now))
+                readyLinks.push_back(&link);
+        if (readyLinks.empty())
+            continue;
+        uint64_t frameId = controller.OnFrameProduced();
+        for (auto* link: readyLinks)
+        {
+            controller.OnFrameSentToClient(link->clientId, frameId, now);
+            link->Send(frameId, now, frameBytes);
+        }
+    }
+}
+
+static HelloImGui::RemotePacingController::ClientStats StatsOf(HelloImGui::RemotePacingController& controller, int clientId)
+{
+    for (const auto& stats: controller.Stats())
+        if (stats.clientId == clientId)
+            return stats;
+    return {};
+}
+
+
+TEST_CASE("RemotePacingController: a fast link is served at the max rate")
+{
+    HelloImGui::RemotePacingController controller;
+    std::vector<SimulatedLink> links = { {1, 0.002, 100e6} };
+    RunLoopbackSimulation(controller, links, 5., 50e3);
+
+    auto stats = StatsOf(controller, 1);
+    CHECK(stats.targetFps > 50.);
+    CHECK(controller.ProduceFps() > 50.);
+    CHECK(stats.roundTripSeconds < 0.02);
+}
+
+TEST_CASE("RemotePacingController: a slow link lowers the produce rate and does not queue frames")
+{
+    HelloImGui::RemotePacingController controller;
+    // 50KB frames on a 500KB/s link: at most 10 frames per second can go through
+    std::vector<SimulatedLink> links = { {1, 0.020, 500e3} };
+    RunLoopbackSimulation(controller, links, 10., 50e3);
+
+    auto stats = StatsOf(controller, 1);
+    CHECK(stats.ackFps < 11.);
+    CHECK(stats.ackFps > 7.);
+    CHECK(controller.ProduceFps() < 15.);
+    // Stale frames were dropped instead of being queued on the link
+    CHECK(links[0].maxQueuedOnLink <= controller.GetParams().maxFramesInFlight);
+    CHECK(stats.roundTripSeconds > 0.14);
+}
+
+TEST_CASE("RemotePacingController: a slow client does not hold back a fast one")
+{
+    HelloImGui::RemotePacingController controller;
+    std::vector<SimulatedLink> links = { {1, 0.002, 100e6}, {2, 0.100, 250e3} };
+    RunLoopbackSimulation(controller, links, 10., 50e3);
+
+    auto fastStats = StatsOf(controller, 1);
+    auto slowStats = StatsOf(controller, 2);
+    CHECK(fastStats.ackedFrames > 4 * slowStats.ackedFrames);
+    CHECK(slowStats.ackFps < 6.);
+    CHECK(controller.ProduceFps() > 50.);
+    CHECK(links[1].maxQueuedOnLink <= controller.GetParams().maxFramesInFlight);
+}
+
+TEST_CASE("RemotePacingController: the rate recovers when a client disconnects")
+{
+    HelloImGui::RemotePacingController controller;
+    controller.OnClientConnected(1, 0.);
+    uint64_t frameId = controller.OnFrameProduced();
+    controller.OnFrameSentToClient(1, frameId, 0.);
+    CHECK(controller.ShallSendToClient(1, 1.) == true);
+    controller.OnFrameSentToClient(1, controller.OnFrameProduced(), 1.);
+    // Two frames in flight: the next one is dropped
+    CHECK(controller.ShallSendToClient(1, 2.) == false);
+    CHECK(StatsOf(controller, 1).droppedFrames == 1);
+
+    controller.OnClientDisconnected(1);
+    CHECK(!controller.HasClients());
+    CHECK(controller.ProduceFps() == controller.GetParams().maxFps);
+}
+
+TEST_CASE("RemotePacingController: a client that never acknowledges is still served")
+{
+    HelloImGui::RemotePacingController controller;
+    controller.OnClientConnected(1, 0.);
+    for (double now = 0.; now < 1.; now += 0.1)
+        if (controller.ShallSendToClient(1, now))
+            controller.OnFrameSentToClient(1, controller.OnFrameProduced(), now);
+    CHECK(StatsOf(controller, 1).sentFrames == 2);
+
+    double afterTimeout = controller.GetParams().ackTimeoutSeconds + 0.1;
+    CHECK(controller.ShallSendToClient(1, afterTimeout) == true);
+}
@@ -0,0 +1,84 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/remote_texture_registry.h"
+
+#include <vector>
+
+using HelloImGui::RemoteTextureRegistry;
+
+
+TEST_CASE("RemoteTextureRegistry: unchanged textures are not sent again")
+{
+    RemoteTextureRegistry registry;
+    std::vector<unsigned char> atlas(512 * 256, 7);
+
+    auto first = registry.Submit(1, RemoteTextureRegistry::PixelFormat::Alpha8, 512, 256, atlas.data());
+    CHECK(first.kind == RemoteTextureRegistry::UpdateKind::Full);
+    CHECK(first.bytes == atlas.size());
+
+    auto second = registry.Submit(1, RemoteTextureRegistry::PixelFormat::Alpha8, 512, 256, atlas.data());
+    CHECK(second.kind == RemoteTextureRegistry::UpdateKind::None);
+    CHECK(registry.GetStats().bytesSaved == atlas.size());
+
+    // After a reconnection, the texture shall be sent again
+    registry.Invalidate();
+    auto third = registry.Submit(1, RemoteTextureRegistry::PixelFormat::Alpha8, 512, 256, atlas.data());
+    CHECK(third.kind == RemoteTextureRegistry::UpdateKind::Full);
+}
+
+TEST_CASE("RemoteTextureRegistry: a partial change is reported as a dirty rect")
+{
+    RemoteTextureRegistry registry;
+    const int width = 200, height = 100;
+    std::vector<unsigned char> rgba(width * height * 4, 0);
+    registry.Submit(1, RemoteTextureRegistry::PixelFormat::Rgba32, width, height, rgba.data());
+
+    // Change two pixels: (40, 10) and (70, 70)
+    rgba[(10 * width + 40) * 4] = 255;
+    rgba[(70 * width + 70) * 4 + 3] = 255;
+    auto update = registry.Submit(1, RemoteTextureRegistry::PixelFormat::Rgba32, width, height, rgba.data());
+    CHECK(update.kind == RemoteTextureRegistry::UpdateKind::DirtyRect);
+    CHECK(update.dirtyRect.x == 32);
+    CHECK(update.dirtyRect.y == 0);
+    CHECK(update.dirtyRect.w == 64);
+    CHECK(update.dirtyRect.h == 96);
+    CHECK(update.bytes == 64 * 96 * 4);
+
+    // A change in the last partial tile is clipped to the texture
+    rgba[(99 * width + 199) * 4] = 1;
+    update = registry.Submit(1, RemoteTextureRegistry::PixelFormat::Rgba32, width, height, rgba.data());
+    CHECK(update.dirtyRect.x == 192);
+    CHECK(update.dirtyRect.y == 96);
+    CHECK(update.dirtyRect.w == 8);
+    CHECK(update.dirtyRect.h == 4);
+
+    // A size change requires a full update
+    update = registry.Submit(1, RemoteTextureRegistry::PixelFormat::Rgba32, width, height / 2, rgba.data());
+    CHECK(update.kind == RemoteTextureRegistry::UpdateKind::Full);
+}
+
+TEST_CASE("RemoteTextureRegistry: user textures are streamed within a byte budget")
+{
+    RemoteTextureRegistry registry;
+    std::vector<unsigned char> small(16 * 16 * 4, 1), big(256 * 256 * 4, 2);
+    registry.SetUserTexture(10, RemoteTextureRegistry::PixelFormat::Rgba32, 256, 256, big.data());
+    registry.SetUserTexture(11, RemoteTextureRegistry::PixelFormat::Rgba32, 16, 16, small.data());
+    registry.SetUserTexture(12, RemoteTextureRegistry::PixelFormat::Rgba32, 16, 16, small.data());
+
+    // A texture bigger than the budget is still sent, alone
+    auto batch = registry.TakeUserTextures(1024);
+    REQUIRE(batch.size() == 1);
+    CHECK(batch[0]->key == 10);
+
+    batch = registry.TakeUserTextures(big.size());
+    CHECK(batch.size() == 2);
+    CHECK(!registry.HasPendingUserTextures());
+
+    // Replacing a texture queues it again; removing it drops it from the queue
+    registry.SetUserTexture(11, RemoteTextureRegistry::PixelFormat::Rgba32, 16, 16, small.data());
+    registry.RemoveUserTexture(11);
+    CHECK(!registry.HasPendingUserTextures());
+
+    // After a reconnection, all user textures are streamed again
+    registry.Invalidate();
+    CHECK(registry.GetStats().nbPendingUserTextures == 2);
+}
@@ -0,0 +1,53 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/resize_coalescer.h"
+
+using HelloImGui::ResizeCoalescer;
+
+
+TEST_CASE("ResizeCoalescer: redraws are capped during an interactive resize")
+{
+    ResizeCoalescer coalescer;
+    coalescer.SetParams({60., 0.1});
+
+    // The user drags the window border during 0.5 second: one resize event per millisecond
+    double now = 0.;
+    std::size_t nbRedraws = 0;
+    for (int i = 0; i < 500; ++i)
+    {
+        now = i * 0.001;
+        coalescer.OnResizeEvent(now);
+        if (coalescer.ShallRedrawPreviousFrame(now))
+            ++nbRedraws;
+        CHECK(coalescer.IsResizing(now));
+    }
+    CHECK(coalescer.GetStats().nbResizeEvents == 500);
+    CHECK(nbRedraws == coalescer.GetStats().nbRedraws);
+    CHECK(nbRedraws >= 29);
+    CHECK(nbRedraws <= 31);  // 0.5s at 60 fps
+
+    // The last resize event is redrawn at the next allowed slot
+    CHECK(coalescer.SecondsUntilNextEvent(now) > 0.);
+    CHECK(coalescer.SecondsUntilNextEvent(now) <= 1. / 60.);
+    now += coalescer.SecondsUntilNextEvent(now);
+    CHECK(coalescer.ShallRedrawPreviousFrame(now));
+    CHECK(!coalescer.ShallRedrawPreviousFrame(now));
+
+    // Then nothing happens until the size is stable
+    CHECK(coalescer.IsResizing(now));
+    double untilStable = coalescer.SecondsUntilNextEvent(now);
+    CHECK(untilStable == doctest::Approx(0.499 + 0.1 - now));
+    now += untilStable + 1e-6;
+    CHECK(!coalescer.IsResizing(now));
+}
+
+TEST_CASE("ResizeCoalescer: a single resize event is redrawn immediately")
+{
+    ResizeCoalescer coalescer;
+    CHECK(!coalescer.IsResizing(10.));
+    CHECK(!coalescer.ShallRedrawPreviousFrame(10.));
+    coalescer.OnResizeEvent(10.);
+    CHECK(coalescer.SecondsUntilNextEvent(10.) == 0.);
+    CHECK(coalescer.ShallRedrawPreviousFrame(10.));
+    CHECK(coalescer.IsResizing(10.05));
+    CHECK(!coalescer.IsResizing(10.2));
+}
@@ -0,0 +1,52 @@
+#include "doctest.h"
+#include "hello_imgui/internal/startup_tracer.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace HelloImGui;
+
+
+static std::string ReadFile(const std::string& filename)
+{
+    std::ifstream is(filename);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+
+
+TEST_CASE("StartupTracer: records scoped events from several threads into a Chrome trace")
+{
+    std::string traceFilename = (std::filesystem::temp_directory_path() / "hello_imgui_startup_trace_test.json").string();
+
+    { StartupTracer::ScopedEvent ignored("Before start"); }
+    StartupTracer::Start();
+    CHECK(StartupTracer::IsRecording());
+    {
+        StartupTracer::ScopedEvent traceEvent("Setup \"main\"");
+        std::thread worker([]() {
+            StartupTracer::SetThreadName("Worker");
+            StartupTracer::ScopedEvent workerEvent("Read file");
+        });
+        worker.join();
+    }
+    StartupTracer::AddInstantEvent("First visible frame");
+
+    REQUIRE(StartupTracer::StopAndSave(traceFilename));
+    CHECK(!StartupTracer::IsRecording());
+    { StartupTracer::ScopedEvent ignored("After stop"); }
+
+    std::string trace = ReadFile(traceFilename);
+    std::remove(traceFilename.c_str());
+    CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+    CHECK(trace.find("\"name\": \"Setup \\\"main\\\"\", \"ph\": \"X\"") != std::string::npos);
+    CHECK(trace.find("\"name\": \"Read file\", \"ph\": \"X\"") != std::string::npos);
+    CHECK(trace.find("\"args\": {\"name\": \"Worker\"}") != std::string::npos);
+    CHECK(trace.find("\"name\": \"First visible frame\", \"ph\": \"i\"") != std::string::npos);
+    CHECK(trace.find("Before start") == std::string::npos);
+    CHECK(trace.find("After stop") == std::string::npos);
+}
@@ -0,0 +1,172 @@
+#include "doctest.h"
+#include "hello_imgui/internal/backend_impls/viewports_renderer.h"
+
+#include <string>
+#include <vector>
+
+using namespace HelloImGui;
+
+
+// The fake platform and renderer callbacks log their calls, e.g. "render 2", "swap 2"
+static std::vector<std::string> gCalls;
+
+static void FakeRenderWindow(ImGuiViewport* viewport, void*) { gCalls.push_back("render " + std::to_string(viewport->ID)); }
+static void FakeSwapBuffers(ImGuiViewport* viewport, void*) { gCalls.push_back("swap " + std::to_string(viewport->ID)); }
+
+
+// A secondary viewport whose draw data contains one draw list (a triangle)
+struct FakeViewport
+{
+    ImDrawList drawList { nullptr };
+    ImDrawData drawData;
+    ImGuiViewport viewport;
+
+    FakeViewport(ImGuiID id, int handle)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            ImDrawVert vertex;
+            vertex.pos = ImVec2((float)i, (float)(i * 2));
+            drawList.VtxBuffer.push_back(vertex);
+            drawList.IdxBuffer.push_back((ImDrawIdx)i);
+        }
+        ImDrawCmd cmd;
+        cmd.ClipRect = ImVec4(0.f, 0.f, 100.f, 100.f);
+        cmd.ElemCount = 3;
+        drawList.CmdBuffer.push_back(cmd);
+        drawData.CmdLists.push_back(&drawList);
+        drawData.CmdListsCount = 1;
+        drawData.DisplaySize = ImVec2(100.f, 100.f);
+        drawData.FramebufferScale = ImVec2(1.f, 1.f);
+
+        viewport.ID = id;
+        viewport.DrawData = &drawData;
+        viewport.PlatformHandle = (void*)(size_t)handle;
+    }
+};
+
+
+// Adds the fake viewports to the platform IO of a new ImGui context (after the main viewport),
+// and removes them before the context is destroyed
+struct FakePlatformIO
+{
+    ImGuiContext* context;
+    ImGuiViewport mainViewport;
+    int nbOriginalViewports;
+
+    FakePlatformIO(std::vector<FakeViewport*> viewports)
+    {
+        context = ImGui::CreateContext();
+        ImGuiPlatformIO& platformIo = ImGui::GetPlatformIO();
+        nbOriginalViewports = platformIo.Viewports.Size;
+        if (platformIo.Viewports.Size == 0)
+            platformIo.Viewports.push_back(&mainViewport);
+        for (auto* fakeViewport: viewports)
+            platformIo.Viewports.push_back(&fakeViewport->viewport);
+        platformIo.Platform_RenderWindow = FakeRenderWindow;
+        platformIo.Platform_SwapBuffers = FakeSwapBuffers;
+        gCalls.clear();
+    }
+    ~FakePlatformIO()
+    {
+        ImGuiPlatformIO& platformIo = ImGui::GetPlatformIO();
+        platformIo.Viewports.resize(nbOriginalViewports);
+        platformIo.Platform_RenderWindow = nullptr;
+        platformIo.Platform_SwapBuffers = nullptr;
+        ImGui::DestroyContext(context);
+    }
+};
+
+
+TEST_CASE("ViewportsRenderer: renders all the viewports, then presents them")
+{
+    FakeViewport viewport2(2, 1), viewport3(3, 2), viewportMinimized(4, 3);
+    viewportMinimized.viewport.Flags |= ImGuiViewportFlags_IsMinimized;
+    FakePlatformIO platformIo({&viewport2, &viewport3, &viewportMinimized});
+
+    ViewportsRenderer renderer;
+    std::vector<ImGuiID> firstRenders;
+    auto onFirstRender = [&](ImGuiViewport* viewport) { firstRenders.push_back(viewport->ID); };
+
+    renderer.RenderPlatformWindows(false, onFirstRender);
+    CHECK(gCalls == std::vector<std::string>{"render 2", "render 3", "swap 2", "swap 3"});
+    renderer.RenderPlatformWindows(false, onFirstRender);
+    CHECK(gCalls.size() == 8);  // unchanged frames are rendered when not skipping them
+    CHECK(firstRenders == std::vector<ImGuiID>{2, 3});
+
+    auto stats = renderer.GetStats();
+    REQUIRE(stats.size() == 3);
+    CHECK(stats[0].viewportId == 2);
+    CHECK(stats[0].nbRenderedFrames == 2);
+    CHECK(stats[0].nbSkippedPresents == 0);
+    CHECK(stats[2].nbRenderedFrames == 0);  // minimized
+}
+
+TEST_CASE("ViewportsRenderer: skips the unchanged viewports")
+{
+    FakeViewport viewport2(2, 1), viewport3(3, 2);
+    FakePlatformIO platformIo({&viewport2, &viewport3});
+    ViewportsRenderer renderer;
+
+    // The first frame is always rendered
+    renderer.RenderPlatformWindows(true, {});
+    CHECK(gCalls.size() == 4);
+
+    // Nothing changed
+    gCalls.clear();
+    renderer.RenderPlatformWindows(true, {});
+    CHECK(gCalls.empty());
+
+    // Only viewport 3 changed
+    viewport3.drawList.VtxBuffer[1].pos.x = 50.f;
+    renderer.RenderPlatformWindows(true, {});
+    CHECK(gCalls == std::vector<std::string>{"render 3", "swap 3"});
+
+    // Invalidate() forces all viewports to be rendered
+    gCalls.clear();
+    renderer.Invalidate();
+    renderer.RenderPlatformWindows(true, {});
+    CHECK(gCalls.size() == 4);
+
+    // A new platform window is always rendered
+    gCalls.clear();
+    viewport2.viewport.PlatformHandle = (void*)(size_t)10;
+    renderer.RenderPlatformWindows(true, {});
+    CHECK(gCalls == std::vector<std::string>{"render 2", "swap 2"});
+
+    auto stats = renderer.GetStats();
+    REQUIRE(stats.size() == 2);
+    CHECK(stats[0].nbRenderedFrames == 1);  // restarted with the new platform window
+    CHECK(stats[1].nbRenderedFrames == 3);
+    CHECK(stats[1].nbSkippedPresents == 2);
+}
+
+TEST_CASE("ViewportsRenderer: the frames presented without skipping are not used as reference")
+{
+    FakeViewport viewport2(2, 1);
+    FakePlatformIO platformIo({&viewport2});
+    ViewportsRenderer renderer;
+
+    renderer.RenderPlatformWindows(true, {});    // content A
+    viewport2.drawList.VtxBuffer[1].pos.x = 50.f;
+    renderer.RenderPlatformWindows(false, {});   // content B
+    viewport2.drawList.VtxBuffer[1].pos.x = 1.f;
+    gCalls.clear();
+    renderer.RenderPlatformWindows(true, {});    // content A again: B is on screen
+    CHECK(gCalls == std::vector<std::string>{"render 2", "swap 2"});
+}
+
+TEST_CASE("ViewportsRenderer: forgets the destroyed viewports")
+{
+    FakeViewport viewport2(2, 1), viewport3(3, 2);
+    FakePlatformIO platformIo({&viewport2, &viewport3});
+    ViewportsRenderer renderer;
+    renderer.RenderPlatformWindows(true, {});
+    CHECK(renderer.GetStats().size() == 2);
+
+    ImGui::GetPlatformIO().Viewports.resize(ImGui::GetPlatformIO().Viewports.Size - 1);
+    renderer.RenderPlatformWindows(true, {});
+    auto stats = renderer.GetStats();
+    REQUIRE(stats.size() == 1);
+    CHECK(stats[0].viewportId == 2);
+}
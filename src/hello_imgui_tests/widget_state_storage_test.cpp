@@ -0,0 +1,57 @@
+#include "doctest.h"
+#include "hello_imgui/internal/widget_state_storage.h"
+
+using HelloImGui::WidgetStateStorage;
+
+
+TEST_CASE("WidgetStateStorage: states are kept while they are used")
+{
+    WidgetStateStorage<int> storage(10);
+    *storage.Get(42, 0) = 1;
+    *storage.Get(43, 0) = 2;
+    CHECK(storage.Size() == 2);
+
+    for (int frame = 1; frame < 100; ++frame)
+        CHECK(*storage.Get(42, frame) == 1);
+
+    // 43 was recycled, and is value-initialized when used again
+    CHECK(storage.Size() == 1);
+    CHECK(*storage.Get(43, 100) == 0);
+}
+
+TEST_CASE("WidgetStateStorage: dynamic ids do not accumulate")
+{
+    WidgetStateStorage<int> storage(5);
+    ImGuiID nextId = 1;
+    size_t maxCapacity = 0;
+    for (int frame = 0; frame < 1000; ++frame)
+    {
+        // 50 widgets with new ids at each frame (e.g. rows of a table that scrolls), plus a permanent one
+        for (int i = 0; i < 50; ++i)
+            *storage.Get(nextId++, frame) = frame;
+        *storage.Get(0xFFFFFFFFu, frame) += 1;
+        if (storage.Capacity() > maxCapacity)
+            maxCapacity = storage.Capacity();
+    }
+    CHECK(storage.Size() <= 50 * 9 + 1);
+    CHECK(maxCapacity <= 2048);
+    CHECK(*storage.Get(0xFFFFFFFFu, 1000) == 1000);
+
+    // Once the dynamic widgets are gone, the table shrinks
+    for (int frame = 1001; frame < 1100; ++frame)
+        storage.Get(0xFFFFFFFFu, frame);
+    CHECK(storage.Size() == 1);
+    CHECK(storage.Capacity() == 16);
+}
+
+TEST_CASE("WidgetStateStorage: a stale entry is reinitialized, even before being recycled")
+{
+    WidgetStateStorage<int> storage(10);
+    *storage.Get(42, 0) = 1;
+    // The collection of frame 10 keeps 42 (idle during 10 frames), the next one is at frame 15
+    storage.Get(43, 5);
+    storage.Get(43, 10);
+    CHECK(storage.Size() == 2);
+    CHECK(*storage.Get(42, 11) == 0);
+    CHECK(storage.Size() == 2);
+}